@@ -31,18 +31,154 @@
 #include "portapack_persistent_memory.hpp"
 #include "utility.hpp"
 #include "file_path.hpp"
+#include "work_queue.hpp"
 
 #include <algorithm>
 #include <cstring>
 #include <string_view>
 
+#include <ch.h>
+
 namespace fs = std::filesystem;
 using namespace portapack;
+using settings_store::Block;
 
 namespace {
 fs::path get_settings_path(const std::string& app_name) {
     return settings_dir / app_name + u".ini";
 }
+
+const fs::path store_path = settings_dir / u"app_settings.bin";
+
+/* The binary store, shared by the UI thread and the worker writing it
+ * behind. Everything below takes the mutex. */
+MUTEX_DECL(store_mutex);
+settings_store::Index<File> store_index{};
+bool store_index_loaded = false;
+/* Saved, not yet written. */
+std::vector<Block> store_pending{};
+
+void lock_store() {
+    chMtxLock(&store_mutex);
+}
+
+void unlock_store() {
+    chMtxUnlock();
+}
+
+/* Lazily, on the first app opened. A missing file is an empty store. */
+bool load_store_index(File& f) {
+    if (!store_index_loaded) {
+        store_index_loaded = store_index.load(f);
+        if (!store_index_loaded)
+            store_index = {};
+    }
+    return store_index_loaded;
+}
+
+/* One INI line per record, in the format load_settings() reads. */
+bool write_ini(const Block& block) {
+    File f;
+    auto path = get_settings_path(std::string{block.app_name()});
+
+    ensure_directory(settings_dir);
+    auto error = f.create(path);
+    if (error)
+        return false;
+
+    return block.for_each([&f](const Block::Record& record) {
+        BoundSetting::write(f, record.name, record.type, record.value);
+    });
+}
+
+void write_pending() {
+    if (store_pending.empty())
+        return;
+
+    std::vector<Block> failed{};
+    {
+        File f;
+        ensure_directory(settings_dir);
+        const bool opened = !f.open(store_path, false, true) && load_store_index(f);
+
+        for (auto& block : store_pending) {
+            const auto app_hash = settings_store::hash(block.app_name());
+            if (!opened || !store_index.write(f, app_hash, block))
+                failed.push_back(std::move(block));
+        }
+    }
+    store_pending.clear();
+
+    // A full or broken store still leaves the settings somewhere. One
+    // file open at a time, for the worker's stack.
+    for (const auto& block : failed)
+        write_ini(block);
+}
+
+/* The settings of 'store_name', pending or stored. */
+bool read_block(std::string_view store_name, Block& block) {
+    const auto app_hash = settings_store::hash(store_name);
+    bool found = false;
+
+    lock_store();
+    const auto pending = std::find_if(store_pending.begin(), store_pending.end(), [app_hash](const Block& pending) {
+        return settings_store::hash(pending.app_name()) == app_hash;
+    });
+    if (pending != store_pending.end()) {
+        block = *pending;
+        found = true;
+    } else {
+        File f;
+        found = !f.open(store_path) && load_store_index(f) && store_index.read(f, app_hash, block);
+    }
+    unlock_store();
+
+    return found && block.app_name() == store_name;
+}
+
+void queue_block(Block block) {
+    const auto app_hash = settings_store::hash(block.app_name());
+
+    lock_store();
+    auto pending = std::find_if(store_pending.begin(), store_pending.end(), [app_hash](const Block& pending) {
+        return settings_store::hash(pending.app_name()) == app_hash;
+    });
+    if (pending != store_pending.end())
+        *pending = std::move(block);
+    else
+        store_pending.push_back(std::move(block));
+    unlock_store();
+
+    static const int owner = 0;
+    const auto write = []() {
+        lock_store();
+        write_pending();
+        unlock_store();
+    };
+    if (!WorkQueue::post(&owner, write, {}))
+        write();  // Queue full.
+}
+
+Block encode(std::string_view store_name, const SettingBindings& bindings) {
+    Block block{store_name};
+    for (const auto& bound_setting : bindings)
+        bound_setting.encode(block);
+    return block;
+}
+
+bool decode(const Block& block, SettingBindings& bindings) {
+    std::vector<uint32_t> name_hashes{};
+    name_hashes.reserve(bindings.size());
+    for (const auto& bound_setting : bindings)
+        name_hashes.push_back(settings_store::hash(bound_setting.name()));
+
+    return block.for_each([&](const Block::Record& record) {
+        const auto it = std::find(name_hashes.begin(), name_hashes.end(), record.name_hash);
+        if (it != name_hashes.end())
+            bindings[it - name_hashes.begin()].decode(record.type, record.value);
+    });
+}
+
 }  // namespace
 
 void BoundSetting::parse(std::string_view value) {
@@ -106,6 +242,94 @@ void BoundSetting::write(File& file) const {
     file.write("\r\n", 2);
 }
 
+void BoundSetting::encode(Block& block) const {
+    const auto type = static_cast<uint8_t>(type_);
+    switch (type_) {
+        case SettingType::I64:
+            block.add(name_, type, target_, sizeof(int64_t));
+            break;
+        case SettingType::I32:
+            block.add(name_, type, target_, sizeof(int32_t));
+            break;
+        case SettingType::U32:
+            block.add(name_, type, target_, sizeof(uint32_t));
+            break;
+        case SettingType::U8:
+            block.add(name_, type, target_, sizeof(uint8_t));
+            break;
+        case SettingType::String: {
+            const auto& str = as<std::string>();
+            block.add(name_, type, str.data(), str.length());
+            break;
+        }
+        case SettingType::Bool: {
+            const uint8_t value = as<bool>() ? 1 : 0;
+            block.add(name_, type, &value, sizeof(value));
+            break;
+        }
+    }
+}
+
+void BoundSetting::decode(uint8_t type, std::string_view value) {
+    if (type != static_cast<uint8_t>(type_))
+        return;
+
+    switch (type_) {
+        case SettingType::I64:
+        case SettingType::I32:
+        case SettingType::U32:
+        case SettingType::U8: {
+            const size_t size = (type_ == SettingType::I64)   ? sizeof(int64_t)
+                                : (type_ == SettingType::U8) ? sizeof(uint8_t)
+                                                             : sizeof(uint32_t);
+            if (value.size() == size)
+                memcpy(target_, value.data(), size);
+            break;
+        }
+        case SettingType::String:
+            as<std::string>() = value;
+            break;
+        case SettingType::Bool:
+            if (value.size() == 1)
+                as<bool>() = (value[0] != 0);
+            break;
+    }
+}
+
+void BoundSetting::write(File& file, std::string_view name, uint8_t type, std::string_view value) {
+    int64_t i64 = 0;
+    int32_t i32 = 0;
+    uint32_t u32 = 0;
+    uint8_t u8 = 0;
+    std::string str{};
+    bool b = false;
+
+    BoundSetting bound_setting{name, &i64};
+    switch (static_cast<SettingType>(type)) {
+        case SettingType::I64:
+            break;
+        case SettingType::I32:
+            bound_setting = {name, &i32};
+            break;
+        case SettingType::U32:
+            bound_setting = {name, &u32};
+            break;
+        case SettingType::U8:
+            bound_setting = {name, &u8};
+            break;
+        case SettingType::String:
+            bound_setting = {name, &str};
+            break;
+        case SettingType::Bool:
+            bound_setting = {name, &b};
+            break;
+        default:
+            return;
+    }
+    bound_setting.decode(type, value);
+    bound_setting.write(file);
+}
+
 SettingsStore::SettingsStore(std::string_view store_name, SettingBindings bindings)
     : store_name_{store_name}, bindings_{bindings} {
     reload();
@@ -116,14 +340,22 @@ SettingsStore::~SettingsStore() {
 }
 
 void SettingsStore::reload() {
-    load_settings(store_name_, bindings_);
+    load_settings(store_name_, bindings_, stored_hash_);
 }
 
 void SettingsStore::save() const {
-    save_settings(store_name_, bindings_);
+    save_settings(store_name_, bindings_, stored_hash_);
 }
 
-bool load_settings(std::string_view store_name, SettingBindings& bindings) {
+bool load_settings(std::string_view store_name, SettingBindings& bindings, uint32_t& stored_hash) {
+    Block block{};
+    if (read_block(store_name, block) && decode(block, bindings)) {
+        stored_hash = settings_store::hash(block.bytes().data(), block.bytes().size());
+        return true;
+    }
+
+    // Not in the store yet; the first save puts it there.
+    stored_hash = 0;
     File f;
     auto path = get_settings_path(std::string{store_name});
 
@@ -153,19 +385,64 @@ bool load_settings(std::string_view store_name, SettingBindings& bindings) {
     return true;
 }
 
+bool save_settings(std::string_view store_name, const SettingBindings& bindings, uint32_t& stored_hash) {
+    auto block = encode(store_name, bindings);
+    const auto hash = settings_store::hash(block.bytes().data(), block.bytes().size());
+    if (hash == stored_hash)
+        return true;
+
+    stored_hash = hash;
+    queue_block(std::move(block));
+    return true;
+}
+
+bool load_settings(std::string_view store_name, SettingBindings& bindings) {
+    uint32_t stored_hash = 0;
+    return load_settings(store_name, bindings, stored_hash);
+}
+
 bool save_settings(std::string_view store_name, const SettingBindings& bindings) {
+    uint32_t stored_hash = 0;
+    return save_settings(store_name, bindings, stored_hash);
+}
+
+bool export_settings_to_ini() {
+    bool ok = true;
+
+    lock_store();
+    write_pending();
     File f;
-    auto path = get_settings_path(std::string{store_name});
+    if (!f.open(store_path) && load_store_index(f)) {
+        for (const auto& slot : store_index.slots()) {
+            Block block{};
+            ok = store_index.read(f, slot.app_hash, block) && write_ini(block) && ok;
+        }
+    }
+    unlock_store();
 
-    ensure_directory(settings_dir);
-    auto error = f.create(path);
-    if (error)
-        return false;
+    return ok;
+}
 
-    for (const auto& bound_setting : bindings)
-        bound_setting.write(f);
+void import_settings_from_ini() {
+    lock_store();
+    store_pending.clear();
+    store_index = {};
+    store_index_loaded = false;
+    delete_file(store_path);
+    unlock_store();
+}
 
-    return true;
+bool import_settings_from_ini(std::string_view store_name) {
+    bool ok = true;
+
+    lock_store();
+    write_pending();
+    File f;
+    if (!f.open(store_path, false) && load_store_index(f))
+        ok = store_index.remove(f, settings_store::hash(store_name));
+    unlock_store();
+
+    return ok;
 }
 
 namespace app_settings {
@@ -219,6 +496,7 @@ void copy_from_radio_model(AppSettings& settings) {
         settings.am_config_index = receiver_model.am_configuration();
         settings.nbfm_config_index = receiver_model.nbfm_configuration();
         settings.wfm_config_index = receiver_model.wfm_configuration();
+        settings.wfm_stereo = receiver_model.wfm_stereo();
         settings.wfmam_config_index = receiver_model.wfmam_configuration();
     }
 
@@ -244,7 +522,8 @@ SettingsManager::SettingsManager(
     : app_name_{app_name},
       settings_{},
       bindings_{},
-      loaded_{false} {
+      loaded_{false},
+      stored_hash_{0} {
     settings_.mode = mode;
     settings_.options = options;
 
@@ -273,6 +552,7 @@ SettingsManager::SettingsManager(
         bindings_.emplace_back("am_config_index"sv, &settings_.am_config_index);
         bindings_.emplace_back("nbfm_config_index"sv, &settings_.nbfm_config_index);
         bindings_.emplace_back("wfm_config_index"sv, &settings_.wfm_config_index);
+        bindings_.emplace_back("wfm_stereo"sv, &settings_.wfm_stereo);
         bindings_.emplace_back("wfmam_config_index"sv, &settings_.wfmam_config_index);
         bindings_.emplace_back("squelch"sv, &settings_.squelch);
     }
@@ -288,7 +568,7 @@ SettingsManager::SettingsManager(
     // or doesn't include all parameters). Settings in the file can overwrite all, or a subset of parameters.
     copy_from_radio_model(settings_);
 
-    loaded_ = load_settings(app_name_, bindings_);
+    loaded_ = load_settings(app_name_, bindings_, stored_hash_);
 
     // Only copy to the radio if load was successful.
     if (loaded_)
@@ -298,7 +578,7 @@ SettingsManager::SettingsManager(
 SettingsManager::~SettingsManager() {
     copy_from_radio_model(settings_);
 
-    save_settings(app_name_, bindings_);
+    save_settings(app_name_, bindings_, stored_hash_);
 }
 
 }  // namespace app_settings
@@ -34,12 +34,13 @@
 
 #include "file.hpp"
 #include "max283x.hpp"
+#include "settings_store.hpp"
 #include "string_format.hpp"
 
 // Bring in the string_view literal.
 using std::literals::operator""sv;
 
-#define COMMON_APP_SETTINGS_COUNT 19
+#define COMMON_APP_SETTINGS_COUNT 20
 
 /* Represents a named setting bound to a variable instance. */
 /* Using void* instead of std::variant, because variant is a pain to dispatch over. */
@@ -77,6 +78,13 @@ class BoundSetting {
     void parse(std::string_view value);
     void write(File& file) const;
 
+    /* To and from the binary store. A value stored with another type is
+     * ignored. */
+    void encode(settings_store::Block& block) const;
+    void decode(uint8_t type, std::string_view value);
+    /* A value from the binary store as write() would write it. */
+    static void write(File& file, std::string_view name, uint8_t type, std::string_view value);
+
    private:
     template <typename T>
     constexpr auto& as() const {
@@ -102,11 +110,28 @@ class SettingsStore {
    private:
     std::string_view store_name_;
     SettingBindings bindings_;
+    mutable uint32_t stored_hash_{0};
 };
 
+/* Settings live in one binary file for all apps, SETTINGS/app_settings.bin.
+ * An app that has nothing there yet loads its INI file instead, so old
+ * settings carry over. Saving only queues the write, which a worker
+ * thread does after the app is gone.
+ *
+ * 'stored_hash' identifies the settings as last loaded or saved; saving
+ * settings that hash the same writes nothing. */
+bool load_settings(std::string_view store_name, SettingBindings& bindings, uint32_t& stored_hash);
+bool save_settings(std::string_view store_name, const SettingBindings& bindings, uint32_t& stored_hash);
 bool load_settings(std::string_view store_name, SettingBindings& bindings);
 bool save_settings(std::string_view store_name, const SettingBindings& bindings);
 
+/* Writes the INI file of every app in the binary store. */
+bool export_settings_to_ini();
+/* Empties the binary store, so every app loads its INI file next time. */
+void import_settings_from_ini();
+/* Drops one app from the binary store, so it loads its INI file next time. */
+bool import_settings_from_ini(std::string_view store_name);
+
 namespace app_settings {
 
 enum class Mode : uint8_t {
@@ -139,6 +164,7 @@ struct AppSettings {
     uint8_t am_config_index = 0;
     uint8_t nbfm_config_index = 0;
     uint8_t wfm_config_index = 0;
+    bool wfm_stereo = false;
     uint8_t wfmam_config_index = 0;
     uint8_t squelch = 80;
     uint8_t volume;
@@ -180,6 +206,7 @@ class SettingsManager {
     AppSettings settings_;
     SettingBindings bindings_;
     bool loaded_;
+    uint32_t stored_hash_;
 };
 
 }  // namespace app_settings
@@ -105,6 +105,7 @@ WFMOptionsView::WFMOptionsView(
     add_children({
         &label_config,
         &options_config,
+        &check_stereo,
     });
 
     freqman_set_bandwidth_option(WFM_MODULATION, options_config);  // adding the common message from freqman.cpp to the options_config
@@ -112,6 +113,11 @@ WFMOptionsView::WFMOptionsView(
     options_config.on_change = [this](size_t, OptionsField::value_t n) {
         receiver_model.set_wfm_configuration(n);
     };
+
+    check_stereo.set_value(receiver_model.wfm_stereo());
+    check_stereo.on_select = [](Checkbox&, bool v) {
+        receiver_model.set_wfm_stereo(v);
+    };
 }
 
 /* WFMAMAptOptionsView *******************************************************/
@@ -130,6 +130,11 @@ class WFMOptionsView : public View {
         {
             // Using common messages from freqman_ui.cpp
         }};
+    Checkbox check_stereo{
+        {UI_POS_X(9), UI_POS_Y(0)},
+        6,
+        "Stereo",
+        /*small*/ true};
 };
 
 class WFMAMAptOptionsView : public View {
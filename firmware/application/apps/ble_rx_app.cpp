@@ -816,11 +816,10 @@ void BLERxView::on_data(BlePacketData* packet) {
     // If found store into tempEntry to modify.
     auto it = find(recent, key);
     if (it != recent.end()) {
-        recent.push_front(*it);
-        recent.erase(it);
+        recent.move_to_front(it);
     } else {
+        // Drops the last entry when full.
         recent.emplace_front(key);
-        truncate_entries(recent);
     }
 
     if (updateEntry(packet, recent.front(), (ADV_PDU_TYPE)packet->type)) {
@@ -107,6 +107,14 @@ CaptureAppView::CaptureAppView(NavigationView& nav)
     record_view.on_error = [&nav](std::string message) {
         nav.display_modal("Error", message);
     };
+
+    // Select on the waterfall saves what it still holds of the past rows.
+    waterfall.on_history_saved = [&nav](const std::filesystem::path& path, Optional<File::Error> error) {
+        if (error)
+            nav.display_modal("Error", error->what());
+        else
+            nav.display_modal("Saved", path.filename().string());
+    };
 }
 
 CaptureAppView::CaptureAppView(
@@ -116,7 +116,7 @@ class CaptureAppView : public View {
         16384,
         3};
 
-    spectrum::WaterfallView waterfall{};
+    spectrum::WaterfallView waterfall{false, true};
 
     MessageHandlerRegistration message_handler_freqchg{
         Message::ID::FreqChangeCommand,
@@ -241,8 +241,7 @@ class POCSAGAppView : public View {
     void on_stats(const POCSAGStatsMessage* stats);
 
     uint32_t last_address = 0;
-    pocsag::EccContainer ecc{};
-    pocsag::POCSAGState pocsag_state{&ecc};
+    pocsag::POCSAGState pocsag_state{};
     POCSAGLogger logger{};
     uint16_t packet_count = 0;
 
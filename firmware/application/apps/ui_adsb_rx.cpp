@@ -110,11 +110,20 @@ void RecentEntriesTable<AircraftRecentEntries>::draw(
 /* ADSBLogger ********************************************/
 
 void ADSBLogger::log(const ADSBLogEntry& log_entry) {
+    if (packed_)
+        log_packed(log_entry);
+    else
+        log_text(log_entry);
+}
+
+void ADSBLogger::log_text(const ADSBLogEntry& log_entry) {
     std::string log_line;
     log_line.reserve(100);
 
-    log_line = log_entry.raw_data;
-    log_line += " ICAO:" + log_entry.icao;
+    log_line = to_string_hex_array(log_entry.raw_data, log_entry.raw_size);
+    if (log_entry.raw_size < 14)  // 56 bits, padded to line up with 112.
+        log_line.append(14, ' ');
+    log_line += " ICAO:" + to_string_hex(log_entry.icao, 6);
 
     if (log_entry.sqwk)
         log_line += " Squawk:" + to_string_dec_uint(log_entry.sqwk, 4, '0');
@@ -142,6 +151,39 @@ void ADSBLogger::log(const ADSBLogEntry& log_entry) {
     log_file.write_entry(log_line);
 }
 
+void ADSBLogger::log_packed(const ADSBLogEntry& log_entry) {
+    using namespace packet_log::adsb;
+
+    packet_log::Record record{packet_log::Type::ADSB, rtc_time::now()};
+    record.raw(log_entry.raw_data, log_entry.raw_size)
+        .field(ICAO, int32_t(log_entry.icao));
+
+    if (log_entry.sqwk)
+        record.field(Squawk, int32_t(log_entry.sqwk));
+
+    if (!log_entry.callsign.empty())
+        record.field(Callsign, log_entry.callsign);
+
+    if (log_entry.pos.alt_valid)
+        record.field(Altitude, log_entry.pos.altitude);
+
+    if (log_entry.pos.pos_valid)
+        record.field(Latitude, packet_log::degrees_e7(log_entry.pos.latitude))
+            .field(Longitude, packet_log::degrees_e7(log_entry.pos.longitude));
+
+    if (log_entry.vel.valid)
+        record.field(VelocityType, int32_t(log_entry.vel_type))
+            .field(Heading, int32_t(log_entry.vel.heading))
+            .field(SpeedType, int32_t(log_entry.vel.type))
+            .field(Speed, log_entry.vel.speed)
+            .field(VerticalRate, log_entry.vel.v_rate);
+
+    if (log_entry.sil != 0)
+        record.field(SIL, int32_t(log_entry.sil));
+
+    packet_log_file.write(record);
+}
+
 /* ADSBRxAircraftDetailsView *****************************/
 
 ADSBRxAircraftDetailsView::ADSBRxAircraftDetailsView(
@@ -163,20 +205,33 @@ ADSBRxAircraftDetailsView::ADSBRxAircraftDetailsView(
     text_icao_address.set(entry.icao_str);
 
     // Try getting the aircraft information from icao24.db
-    database db{};
-    database::AircraftDBRecord aircraft_record;
-    auto return_code = db.retrieve_aircraft_record(&aircraft_record, entry.icao_str);
-    switch (return_code) {
+    auto lookup = [this, icao = std::string{entry.icao_str}]() {
+        database db{};
+        aircraft_result_ = db.retrieve_aircraft_record(&aircraft_record_, icao);
+    };
+    if (!lookup_.post(lookup, [this]() { show_aircraft_record(); })) {
+        // Queue full, look it up here.
+        lookup();
+        show_aircraft_record();
+    }
+
+    button_close.on_select = [&nav](Button&) {
+        nav.pop();
+    };
+}
+
+void ADSBRxAircraftDetailsView::show_aircraft_record() {
+    switch (aircraft_result_) {
         case DATABASE_RECORD_FOUND:
-            text_registration.set(aircraft_record.aircraft_registration);
-            text_manufacturer.set(aircraft_record.aircraft_manufacturer);
-            text_model.set(aircraft_record.aircraft_model);
-            text_owner.set(aircraft_record.aircraft_owner);
-            text_operator.set(aircraft_record.aircraft_operator);
+            text_registration.set(aircraft_record_.aircraft_registration);
+            text_manufacturer.set(aircraft_record_.aircraft_manufacturer);
+            text_model.set(aircraft_record_.aircraft_model);
+            text_owner.set(aircraft_record_.aircraft_owner);
+            text_operator.set(aircraft_record_.aircraft_operator);
 
             // Check for ICAO type, e.g. L2J
-            if (strlen(aircraft_record.icao_type) == 3) {
-                switch (aircraft_record.icao_type[0]) {
+            if (strlen(aircraft_record_.icao_type) == 3) {
+                switch (aircraft_record_.icao_type[0]) {
                     case 'L':
                         text_type.set("Landplane");
                         break;
@@ -197,8 +252,8 @@ ADSBRxAircraftDetailsView::ADSBRxAircraftDetailsView(
                         break;
                 }
 
-                text_number_of_engines.set(std::string{1, aircraft_record.icao_type[1]});
-                switch (aircraft_record.icao_type[2]) {
+                text_number_of_engines.set(std::string{1, aircraft_record_.icao_type[1]});
+                switch (aircraft_record_.icao_type[2]) {
                     case 'P':
                         text_engine_type.set("Piston engine");
                         break;
@@ -215,22 +270,22 @@ ADSBRxAircraftDetailsView::ADSBRxAircraftDetailsView(
             }
 
             // Check for ICAO type designator
-            else if (strlen(aircraft_record.icao_type) == 4) {
-                if (strcmp(aircraft_record.icao_type, "SHIP") == 0)
+            else if (strlen(aircraft_record_.icao_type) == 4) {
+                if (strcmp(aircraft_record_.icao_type, "SHIP") == 0)
                     text_type.set("Airship");
-                else if (strcmp(aircraft_record.icao_type, "BALL") == 0)
+                else if (strcmp(aircraft_record_.icao_type, "BALL") == 0)
                     text_type.set("Balloon");
-                else if (strcmp(aircraft_record.icao_type, "GLID") == 0)
+                else if (strcmp(aircraft_record_.icao_type, "GLID") == 0)
                     text_type.set("Glider / sailplane");
-                else if (strcmp(aircraft_record.icao_type, "ULAC") == 0)
+                else if (strcmp(aircraft_record_.icao_type, "ULAC") == 0)
                     text_type.set("Micro/ultralight aircraft");
-                else if (strcmp(aircraft_record.icao_type, "GYRO") == 0)
+                else if (strcmp(aircraft_record_.icao_type, "GYRO") == 0)
                     text_type.set("Micro/ultralight autogyro");
-                else if (strcmp(aircraft_record.icao_type, "UHEL") == 0)
+                else if (strcmp(aircraft_record_.icao_type, "UHEL") == 0)
                     text_type.set("Micro/ultralight helicopter");
-                else if (strcmp(aircraft_record.icao_type, "SHIP") == 0)
+                else if (strcmp(aircraft_record_.icao_type, "SHIP") == 0)
                     text_type.set("Airship");
-                else if (strcmp(aircraft_record.icao_type, "PARA") == 0)
+                else if (strcmp(aircraft_record_.icao_type, "PARA") == 0)
                     text_type.set("Powered parachute/paraplane");
             }
             break;
@@ -243,10 +298,6 @@ ADSBRxAircraftDetailsView::ADSBRxAircraftDetailsView(
             text_manufacturer.set("No icao24.db file");
             break;
     }
-
-    button_close.on_select = [&nav](Button&) {
-        nav.pop();
-    };
 }
 
 void ADSBRxAircraftDetailsView::focus() {
@@ -355,26 +406,27 @@ void ADSBRxDetailsView::refresh_ui() {
     // The following won't change for a given airborne aircraft.
     // Try getting the airline's name from airlines.db.
     if (!airline_checked && !entry_.callsign.empty()) {
-        airline_checked = true;
-
-        database db;
-        database::AirlinesDBRecord airline_record;
-        std::string airline_code = entry_.callsign.substr(0, 3);
-        auto return_code = db.retrieve_airline_record(&airline_record, airline_code);
-
-        switch (return_code) {
-            case DATABASE_RECORD_FOUND:
-                text_airline.set(airline_record.airline);
-                text_country.set(airline_record.country);
-                break;
-            case DATABASE_RECORD_NOT_FOUND:
-                // text_airline.set("-"); // It's what it is constructed with
-                // text_country.set("-"); // It's what it is constructed with
-                break;
-            case DATABASE_NOT_FOUND:
-                text_airline.set("No airlines.db file");
-                break;
-        }
+        // Queue full: tries again on the next refresh.
+        airline_checked = lookup_.post(
+            [this, airline_code = entry_.callsign.substr(0, 3)]() {
+                database db{};
+                airline_result_ = db.retrieve_airline_record(&airline_record_, airline_code);
+            },
+            [this]() {
+                switch (airline_result_) {
+                    case DATABASE_RECORD_FOUND:
+                        text_airline.set(airline_record_.airline);
+                        text_country.set(airline_record_.country);
+                        break;
+                    case DATABASE_RECORD_NOT_FOUND:
+                        // text_airline.set("-"); // It's what it is constructed with
+                        // text_country.set("-"); // It's what it is constructed with
+                        break;
+                    case DATABASE_NOT_FOUND:
+                        text_airline.set("No airlines.db file");
+                        break;
+                }
+            });
     }
 
     auto age = entry_.age;
@@ -427,8 +479,8 @@ ADSBRxView::ADSBRxView(NavigationView& nav) {
         on_tick_second();
     };
 
-    logger = std::make_unique<ADSBLogger>();
-    logger->append(logs_dir / u"ADSB.TXT");
+    logger = std::make_unique<ADSBLogger>(log_packed);
+    logger->append(logs_dir / (log_packed ? u"ADSB.PKT" : u"ADSB.TXT"));
 
     receiver_model.enable();
     baseband::set_adsb();
@@ -496,14 +548,9 @@ void ADSBRxView::on_frame(const ADSBFrameMessage* message) {
     ADSBLogEntry log_entry;
     uint8_t* raw_data = frame.get_raw_data();
 
-    if (df & 0x10)  // 112 bits
-        log_entry.raw_data = to_string_hex_array(raw_data, 14);
-    else {  // 56 bits
-        log_entry.raw_data = to_string_hex_array(raw_data, 7);
-        log_entry.raw_data.append(14, ' ');
-    }
-
-    log_entry.icao = entry.icao_str;
+    log_entry.raw_data = raw_data;
+    log_entry.raw_size = (df & 0x10) ? 14 : 7;  // 112 or 56 bits
+    log_entry.icao = ICAO_address;
 
     // 17: // Extended squitter
     // 18: // Extended squitter/non-transponder
@@ -675,9 +722,8 @@ void ADSBRxView::update_recent_entries(int age_delta) {
     for (auto& entry : recent)
         entry.inc_age(age_delta);
 
-    // Sort and truncate the entries, grouped by state, newest first.
+    // Sort the entries, grouped by state, newest first.
     sort_entries_by_state();
-    truncate_entries(recent);
     remove_expired_entries();
 }
 
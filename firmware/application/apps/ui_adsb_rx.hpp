@@ -36,6 +36,7 @@
 #include "radio_state.hpp"
 #include "recent_entries.hpp"
 #include "string_format.hpp"
+#include "work_queue.hpp"
 
 using namespace adsb;
 
@@ -168,13 +169,14 @@ struct AircraftRecentEntry {
     }
 };
 
-// NB: uses std::list underneath so assuming refs are NOT invalidated.
+// NB: entries are not moved in memory, so refs are NOT invalidated.
 using AircraftRecentEntries = RecentEntries<AircraftRecentEntry>;
 
 /* Holds data for logging. */
 struct ADSBLogEntry {
-    std::string raw_data{};
-    std::string icao{};
+    uint8_t* raw_data{};
+    size_t raw_size{};
+    uint32_t icao{};
     std::string callsign{};
     adsb_pos pos{};
     adsb_vel vel{};
@@ -184,16 +186,25 @@ struct ADSBLogEntry {
 };
 
 // TODO: Make logging optional.
-/* Logs entries to a log file. */
+/* Logs entries to a text log file or, if 'packed', to a packet log, see
+ * packet_log.hpp. */
 class ADSBLogger {
    public:
+    ADSBLogger(bool packed)
+        : packed_{packed} {}
+
     Optional<File::Error> append(const std::filesystem::path& filename) {
-        return log_file.append(filename);
+        return packed_ ? packet_log_file.append(filename) : log_file.append(filename);
     }
     void log(const ADSBLogEntry& log_entry);
 
    private:
+    bool packed_;
     LogFile log_file{};
+    PacketLogFile packet_log_file{};
+
+    void log_text(const ADSBLogEntry& log_entry);
+    void log_packed(const ADSBLogEntry& log_entry);
 };
 
 /* Shows detailed information about an aircraft. */
@@ -207,6 +218,11 @@ class ADSBRxAircraftDetailsView : public View {
     std::string title() const override { return "AC Details"; }
 
    private:
+    void show_aircraft_record();
+
+    database::AircraftDBRecord aircraft_record_{};
+    int aircraft_result_{DATABASE_NOT_FOUND};
+
     Labels labels{
         {{UI_POS_X(0), 1 * 16}, "ICAO:", Theme::getInstance()->fg_light->foreground},
         {{UI_POS_X(0), 2 * 16}, "Registration:", Theme::getInstance()->fg_light->foreground},
@@ -257,6 +273,9 @@ class ADSBRxAircraftDetailsView : public View {
     Button button_close{
         {UI_POS_X_CENTER(12), UI_POS_Y(16), UI_POS_WIDTH(12), UI_POS_HEIGHT(3)},
         "Back"};
+
+    // Looks up icao24.db off the UI thread. Last, see WorkClient.
+    WorkClient lookup_{};
 };
 
 /* Shows detailed information about an aircraft's flight. */
@@ -297,6 +316,8 @@ class ADSBRxDetailsView : public View {
     // if removed from the recent entries list.
     AircraftRecentEntry entry_{AircraftRecentEntry::invalid_key};
     bool airline_checked{false};
+    database::AirlinesDBRecord airline_record_{};
+    int airline_result_{DATABASE_NOT_FOUND};
 
     Labels labels{
         {{UI_POS_X(0), 1 * 16}, "ICAO:", Theme::getInstance()->fg_light->foreground},
@@ -362,6 +383,9 @@ class ADSBRxDetailsView : public View {
             const auto message = static_cast<const OrientationDataMessage*>(p);
             this->on_orientation(message);
         }};
+
+    // Looks up airlines.db off the UI thread. Last, see WorkClient.
+    WorkClient lookup_{};
 };
 
 /* Main ADSB application view and message dispatch. */
@@ -384,8 +408,14 @@ class ADSBRxView : public View {
         2'500'000 /* bandwidth */,
         2'000'000 /* sampling rate */,
         ReceiverModel::Mode::SpectrumAnalysis};
+    bool log_packed{false};  // LOGS/ADSB.PKT rather than ADSB.TXT.
+
     app_settings::SettingsManager settings_{
-        "rx_adsb", app_settings::Mode::RX};
+        "rx_adsb"sv,
+        app_settings::Mode::RX,
+        {
+            {"log_packed"sv, &log_packed},
+        }};
 
     std::unique_ptr<ADSBLogger> logger{};
 
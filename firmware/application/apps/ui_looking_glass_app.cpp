@@ -107,13 +107,56 @@ void GlassView::on_marker_change() {
     plot_marker(marker_pixel_index);  // Refresh marker on screen
 }
 
-void GlassView::retune() {
-    // Start a new sweep.
+// Number of slices on_channel_spectrum() takes to fill a line.
+size_t GlassView::sweep_slice_count() const {
+    // process_bins() makes at most one pixel per bin.
+    size_t bins = screen_width;
+    if (each_bin_size < marker_pixel_step)
+        bins = (screen_width * marker_pixel_step + each_bin_size - 1) / each_bin_size;
+
+    const size_t bins_per_slice = bin_length + ignore_dc;
+    return (bins + bins_per_slice - 1) / bins_per_slice;
+}
+
+// The baseband keeps streaming and steps through the slices of a line by
+// itself, asking for each retune with a SpectrumSweepRetuneMessage.
+void GlassView::update_sweep() {
+    sweep_hop_count = 0;
+    if (shown && mode != LOOKING_GLASS_SINGLEPASS)
+        sweep_hop_count = sweep_slice_count();
+
+    baseband::set_spectrum_sweep(f_center_ini, looking_glass_step, sweep_hop_count, sweep_discard);
+}
+
+void GlassView::on_sweep_retune(size_t hop) {
+    // Left over from a sweep that was stopped since.
+    if (hop >= sweep_hop_count)
+        return;
+
     // Tune rx for this new slice directly because the model
     // saves to persistent memory which is slower.
-    radio::set_tuning_frequency(f_center);
-    chThdSleepMilliseconds(5);             // stabilize freq
-    baseband::spectrum_streaming_start();  // Do the RX
+    radio::set_tuning(radio::compile_tuning(f_center_ini + hop * looking_glass_step));
+    baseband::spectrum_sweep_tuned(hop);
+
+    // Slices come in faster than the frame rate while sweeping.
+    process_spectra();
+}
+
+void GlassView::process_spectra() {
+    if (!fifo)
+        return;
+
+    ChannelSpectrum channel_spectrum;
+    while (fifo->out(channel_spectrum))
+        on_channel_spectrum(channel_spectrum);
+}
+
+void GlassView::restart_line() {
+    f_center = f_center_ini;
+    pixel_index = 0;
+    bins_hz_size = 0;
+    max_power = 0;
+    range_max_power = 0;
 }
 
 void GlassView::reset_live_view() {
@@ -182,10 +225,9 @@ bool GlassView::process_bins(uint8_t* powerlevel) {
         if (!pixel_index)  // Received indication that a waterfall line has been completed
         {
             bins_hz_size = 0;  // Since this is an entire pixel line, we don't carry "Pixels into next bin"
-            if (mode != LOOKING_GLASS_SINGLEPASS) {
-                f_center = f_center_ini;
-                retune();
-            } else
+            if (mode != LOOKING_GLASS_SINGLEPASS)
+                f_center = f_center_ini;  // The baseband wraps around to the first slice by itself.
+            else
                 baseband::spectrum_streaming_start();
             return true;  // signal a new line
         }
@@ -197,7 +239,15 @@ bool GlassView::process_bins(uint8_t* powerlevel) {
 // Apparently, the spectrum object returns an array of SPEC_NB_BINS (256) bins
 // Each having the radio signal power for its corresponding frequency slot
 void GlassView::on_channel_spectrum(const ChannelSpectrum& spectrum) {
-    baseband::spectrum_streaming_stop();
+    if (mode == LOOKING_GLASS_SINGLEPASS) {
+        baseband::spectrum_streaming_stop();
+    } else if (spectrum.center_frequency != f_center) {
+        // A slice was dropped or is left over from the previous range,
+        // start over with the next line.
+        if (spectrum.center_frequency != f_center_ini)
+            return;
+        restart_line();
+    }
     // Convert bins of this spectrum slice into a representative max_power and when enough, into pixels
     // we actually need screen_width (240) of those bins
     for (uint8_t bin = 0; bin < bin_length; bin++) {
@@ -226,20 +276,23 @@ void GlassView::on_channel_spectrum(const ChannelSpectrum& spectrum) {
     }
     if (mode != LOOKING_GLASS_SINGLEPASS) {
         f_center += looking_glass_step;
-        retune();
     } else {
         baseband::spectrum_streaming_start();
     }
 }
 
 void GlassView::on_hide() {
+    shown = false;
+    update_sweep();
     baseband::spectrum_streaming_stop();
     display.scroll_disable();
 }
 
 void GlassView::on_show() {
+    shown = true;
     display.scroll_set_area(109, screen_height - 1);  // Restart scroll on the correct coordinates
     baseband::spectrum_streaming_start();
+    update_sweep();
 }
 
 void GlassView::on_range_changed() {
@@ -296,6 +349,7 @@ void GlassView::on_range_changed() {
     f_center = f_center_ini;  // Reset sweep into first slice
     baseband::set_spectrum(looking_glass_bandwidth, trigger);
     receiver_model.set_target_frequency(f_center);  // tune rx for this slice
+    update_sweep();
 }
 
 void GlassView::plot_marker(uint8_t pos) {
@@ -85,6 +85,7 @@ class GlassView : public View {
     uint8_t iq_phase_calibration_value{15};  // initial default RX IQ phase calibration value , used for both max2837 & max2839
     int32_t beep_squelch = 20;               // range from -100 to +20, >=20 disabled
     bool beep_enabled = false;               // activate on bip button click
+    uint8_t sweep_discard = 4;               // buffers (102.4us each) dropped after every retune while the synthesizers settle
     app_settings::SettingsManager settings_{
         "rx_glass"sv,
         app_settings::Mode::RX,
@@ -100,6 +101,7 @@ class GlassView : public View {
             {"iq_phase_calibration"sv, &iq_phase_calibration_value},  // we are saving and restoring that CAL from Settings.
             {"beep_squelch"sv, &beep_squelch},
             {"beep_enabled"sv, &beep_enabled},
+            {"sweep_discard"sv, &sweep_discard},
         }};
 
     struct preset_entry {
@@ -119,7 +121,11 @@ class GlassView : public View {
     void get_max_power(const ChannelSpectrum& spectrum, uint8_t bin, uint8_t& max_power);
     rf::Frequency get_freq_from_bin_pos(uint8_t pos);
     void on_marker_change();
-    void retune();
+    void update_sweep();
+    size_t sweep_slice_count() const;
+    void on_sweep_retune(size_t hop);
+    void restart_line();
+    void process_spectra();
     bool process_bins(uint8_t* powerlevel);
     void on_channel_spectrum(const ChannelSpectrum& spectrum);
     void do_timers();
@@ -136,6 +142,8 @@ class GlassView : public View {
     rf::Frequency search_span{0};
     rf::Frequency f_center{0};
     rf::Frequency f_center_ini{0};
+    size_t sweep_hop_count{0};  // Slices in a line, the baseband sweeps through them by itself.
+    bool shown{false};
 
     rf::Frequency marker{0};
     uint8_t marker_pixel_index{0};
@@ -311,12 +319,14 @@ class GlassView : public View {
     MessageHandlerRegistration message_handler_frame_sync{
         Message::ID::DisplayFrameSync,
         [this](const Message* const) {
-            if (this->fifo) {
-                ChannelSpectrum channel_spectrum;
-                while (fifo->out(channel_spectrum)) {
-                    this->on_channel_spectrum(channel_spectrum);
-                }
-            }
+            this->process_spectra();
+        }};
+
+    MessageHandlerRegistration message_handler_sweep_retune{
+        Message::ID::SpectrumSweepRetune,
+        [this](const Message* const p) {
+            const auto message = *reinterpret_cast<const SpectrumSweepRetuneMessage*>(p);
+            this->on_sweep_retune(message.hop);
         }};
 
     MessageHandlerRegistration message_handler_freqchg{
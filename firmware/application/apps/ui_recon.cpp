@@ -39,6 +39,9 @@
 #include "portapack_persistent_memory.hpp"
 #include "utility.hpp"
 #include "replay_thread.hpp"
+#include "radio.hpp"
+
+#include <algorithm>
 
 using namespace portapack;
 using namespace tonekey;
@@ -126,6 +129,7 @@ void ReconView::recon_stop_recording(bool exiting) {
 }
 
 void ReconView::clear_freqlist_for_ui_action() {
+    stop_survey();
     recon_stop_recording(false);
     if (field_mode.selected_index_value() != SPEC_MODULATION)
         audio::output::stop();
@@ -143,6 +147,7 @@ void ReconView::reset_indexes() {
     last_entry.bandwidth = freqman_invalid_index;
     last_entry.step = freqman_invalid_index;
     current_index = 0;
+    survey_hits.clear();
 }
 
 void ReconView::update_description() {
@@ -233,6 +238,7 @@ void ReconView::load_persisted_settings() {
     load_repeaters = persistent_memory::recon_load_repeaters();
     update_ranges = persistent_memory::recon_update_ranges_when_recon();
     auto_record_locked = persistent_memory::recon_auto_record_locked();
+    wideband_assist = persistent_memory::recon_wideband_assist();
 }
 
 void ReconView::audio_output_start() {
@@ -922,8 +928,10 @@ void ReconView::on_statistics_update(const ChannelStatistics& statistics) {
     }
     if (recon || stepper != 0 || index_stepper != 0) {
         if (!timer || stepper != 0 || index_stepper != 0) {
+            // The survey either moved to its next hit or is still running.
+            const bool surveyed = recon && !stepper && !index_stepper && wideband_assist && survey_next();
             // IF THERE IS A FREQUENCY LIST ...
-            if (frequency_list.size() > 0) {
+            if (!surveyed && frequency_list.size() > 0) {
                 has_looped = false;
                 entry_has_changed = false;
                 if (recon || stepper != 0 || index_stepper != 0) {
@@ -1094,6 +1102,7 @@ void ReconView::on_statistics_update(const ChannelStatistics& statistics) {
 }
 
 void ReconView::recon_pause() {
+    stop_survey();
     timer = 0;
     freq_lock = 0;
     recon = false;
@@ -1118,6 +1127,7 @@ void ReconView::recon_resume() {
 }
 
 void ReconView::on_index_delta(int32_t v) {
+    stop_survey();
     if (v > 0) {
         fwd = true;
         button_dir.set_text("FW>");
@@ -1134,6 +1144,7 @@ void ReconView::on_index_delta(int32_t v) {
 }
 
 void ReconView::on_stepper_delta(int32_t v) {
+    stop_survey();
     if (v > 0) {
         fwd = true;
         button_dir.set_text("FW>");
@@ -1154,6 +1165,8 @@ size_t ReconView::change_mode(freqman_index_t new_mod) {
         return 0;
     field_mode.on_change = [this](size_t, OptionsField::value_t) {};
     field_bw.on_change = [this](size_t, OptionsField::value_t) {};
+    survey_active = false;
+    survey_fifo = nullptr;
     recon_stop_recording(false);
     if (record_view != nullptr) {
         remove_child(record_view.get());
@@ -1273,6 +1286,115 @@ size_t ReconView::change_mode(freqman_index_t new_mod) {
     return freqman_entry_get_step_value(def_step);
 }
 
+/* Moves on to the next channel the last survey flagged, or starts a new
+ * survey. Returns false when the list can't be surveyed and recon has to
+ * step through it as usual. */
+bool ReconView::survey_next() {
+    if (survey_active)
+        return true;
+
+    if (survey_hits.empty())
+        return start_survey();
+
+    current_index = survey_hits.back();
+    survey_hits.pop_back();
+    if (!current_is_valid())
+        return false;
+    freq = current_entry().frequency_a;
+    timer = 0;
+    return true;
+}
+
+bool ReconView::start_survey() {
+    if (recon_tx || is_repeat_active() || is_recording)
+        return false;
+
+    // Ranges and ham radio entries are stepped, only fixed channels can be surveyed.
+    std::vector<ReconSurvey::Channel> channels{};
+    for (size_t i = 0; i < frequency_list.size(); i++) {
+        const auto& entry = *frequency_list[i];
+        if (entry.type != freqman_type::Single && entry.type != freqman_type::Repeater)
+            return false;
+        channels.push_back({i, entry.frequency_a});
+    }
+    if (channels.empty())
+        return false;
+
+    survey.set_channels(std::move(channels));
+    if (survey.centers().size() > WidebandSpectrumSweepConfigMessage::max_centers)
+        return false;
+    survey_plan = radio::compile_tuning(survey.centers());
+    survey_hits.clear();
+
+    if (field_mode.selected_index_value() != SPEC_MODULATION)
+        audio::output::stop();
+    receiver_model.disable();
+    baseband::shutdown();
+    baseband::run_image(portapack::spi_flash::image_tag_wideband_spectrum);
+    receiver_model.set_modulation(ReceiverModel::Mode::SpectrumAnalysis);
+    receiver_model.set_sampling_rate(survey.sampling_rate());
+    receiver_model.set_baseband_bandwidth(ReconSurvey::default_baseband_bandwidth);
+    baseband::set_spectrum(survey.sampling_rate(), survey_trigger);
+    receiver_model.enable();
+
+    survey_active = true;
+    baseband::spectrum_streaming_start();
+    baseband::set_spectrum_sweep(survey.centers().data(), survey.centers().size(), survey_discard);
+    desc_cycle.set("...wideband survey...");
+    return true;
+}
+
+/* Back to the audio image, ready for the per-channel squelch check. */
+void ReconView::stop_survey() {
+    if (!survey_active)
+        return;
+
+    // change_mode() does nothing while transmitting, repeating or recording.
+    survey_active = false;
+    survey_fifo = nullptr;
+    baseband::set_spectrum_sweep(0, 0, 0, 0);
+    change_mode(field_mode.selected_index_value());
+    // change_mode() put the default bandwidth back.
+    last_entry.bandwidth = freqman_invalid_index;
+    update_description();
+}
+
+void ReconView::on_survey_retune(size_t hop) {
+    // Left over from a survey that was stopped since.
+    if (!survey_active || hop >= survey_plan.size())
+        return;
+
+    radio::set_tuning(survey_plan[hop]);
+    baseband::spectrum_sweep_tuned(hop);
+
+    ChannelSpectrum spectrum;
+    while (survey_active && survey_fifo && survey_fifo->out(spectrum))
+        on_survey_spectrum(spectrum);
+}
+
+void ReconView::on_survey_spectrum(const ChannelSpectrum& spectrum) {
+    const auto window = survey.window_at(spectrum.center_frequency);
+    if (window < 0)
+        return;
+
+    survey.find_hits(window, spectrum.db, survey_hits);
+    if ((size_t)window + 1 < survey.windows().size())
+        return;
+
+    // Full pass. With nothing heard, the sweep just goes on.
+    if (survey_hits.empty()) {
+        if (!continuous)
+            recon_pause();
+        return;
+    }
+
+    std::reverse(survey_hits.begin(), survey_hits.end());
+    stop_survey();
+    survey_next();
+    handle_retune();
+    recon_redraw();
+}
+
 void ReconView::handle_coded_squelch(const uint32_t value) {
     if (field_mode.selected_index() == NFM_MODULATION)
         text_ctcss.set(tone_key_string_by_value(value, text_ctcss.parent_rect().width() / 8));
@@ -1290,6 +1412,8 @@ void ReconView::handle_remove_current_item() {
     if (mode() != recon_mode::Manual) {
         if (current_is_valid()) {
             frequency_list.erase(frequency_list.begin() + current_index);
+            // The indexes after it moved.
+            survey_hits.clear();
         }
     }
 
@@ -47,6 +47,8 @@
 #include "ui_navigation.hpp"
 #include "ui_freq_field.hpp"
 #include "ui_spectrum.hpp"
+#include "recon_survey.hpp"
+#include "tuning.hpp"
 
 #include <string>
 #include <memory>
@@ -109,6 +111,14 @@ class ReconView : public View {
     // placeholder for possible void recon_start_recording();
     void recon_stop_recording(bool exiting);
 
+    // Wideband assist: surveys the whole list a receiver window at a time
+    // and only steps through the channels that showed activity.
+    bool survey_next();
+    bool start_survey();
+    void stop_survey();
+    void on_survey_retune(size_t hop);
+    void on_survey_spectrum(const ChannelSpectrum& spectrum);
+
     // Returns true if 'current_index' is in bounds of frequency_list.
     bool current_is_valid();
     freqman_entry& current_entry();
@@ -178,6 +188,15 @@ class ReconView : public View {
     systime_t chrono_start{};
     systime_t chrono_end{};
 
+    static constexpr size_t survey_trigger = 7;  // 8 buffers (512us each at 4Msps) per window
+    static constexpr size_t survey_discard = 2;  // buffers dropped after every retune
+    bool wideband_assist{false};
+    bool survey_active{false};
+    ReconSurvey survey{};
+    std::vector<tuning::Hop> survey_plan{};
+    std::vector<size_t> survey_hits{};  // List indexes, next one last.
+    ChannelSpectrumFIFO* survey_fifo{nullptr};
+
     const std::filesystem::path repeat_rec_file = u"RECON_REPEAT.C16";
     const std::filesystem::path repeat_rec_meta = u"RECON_REPEAT.TXT";
     const size_t repeat_read_size{16384};
@@ -411,6 +430,21 @@ class ReconView : public View {
             on_statistics_update(static_cast<const ChannelStatisticsMessage*>(p)->statistics);
         }};
 
+    MessageHandlerRegistration message_handler_survey_config{
+        Message::ID::ChannelSpectrumConfig,
+        [this](const Message* const p) {
+            const auto message = *reinterpret_cast<const ChannelSpectrumConfigMessage*>(p);
+            if (survey_active)
+                survey_fifo = message.fifo;
+        }};
+
+    MessageHandlerRegistration message_handler_survey_retune{
+        Message::ID::SpectrumSweepRetune,
+        [this](const Message* const p) {
+            const auto message = *reinterpret_cast<const SpectrumSweepRetuneMessage*>(p);
+            on_survey_retune(message.hop);
+        }};
+
     MessageHandlerRegistration message_handler_replay_thread_error{
         Message::ID::ReplayThreadDone,
         [this](const Message* p) {
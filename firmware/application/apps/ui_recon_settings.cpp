@@ -46,11 +46,13 @@ ReconSetupViewMain::ReconSetupViewMain(NavigationView& nav, Rect parent_rect, st
                   &button_choose_output_name,
                   &checkbox_autosave_freqs,
                   &checkbox_autostart_recon,
-                  &checkbox_clear_output});
+                  &checkbox_clear_output,
+                  &checkbox_wideband_assist});
 
     checkbox_autosave_freqs.set_value(persistent_memory::recon_autosave_freqs());
     checkbox_autostart_recon.set_value(persistent_memory::recon_autostart_recon());
     checkbox_clear_output.set_value(persistent_memory::recon_clear_output());
+    checkbox_wideband_assist.set_value(persistent_memory::recon_wideband_assist());
 
     text_input_file.set(_input_file);
     button_choose_output_name.set_text(_output_file);
@@ -93,6 +95,7 @@ void ReconSetupViewMain::save(std::string& input_file, std::string& output_file)
     persistent_memory::set_recon_autosave_freqs(checkbox_autosave_freqs.value());
     persistent_memory::set_recon_autostart_recon(checkbox_autostart_recon.value());
     persistent_memory::set_recon_clear_output(checkbox_clear_output.value());
+    persistent_memory::set_recon_wideband_assist(checkbox_wideband_assist.value());
     input_file = _input_file;
     output_file = _output_file;
 };
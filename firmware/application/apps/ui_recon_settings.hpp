@@ -101,6 +101,11 @@ class ReconSetupViewMain : public View {
         {1 * 8, 11 * 16 - 4},
         3,
         "clear output at start"};
+
+    Checkbox checkbox_wideband_assist{
+        {1 * 8, 13 * 16 - 4},
+        15,
+        "wideband assist"};
 };
 
 class ReconSetupViewMore : public View {
@@ -178,7 +178,7 @@ class SearchView : public View {
                                   {"Time", 8},
                                   {"Duration", 11}}};
     SearchRecentEntries recent{};
-    RecentEntriesView<RecentEntries<SearchRecentEntry>> recent_entries_view{columns, recent};
+    RecentEntriesView<SearchRecentEntries> recent_entries_view{columns, recent};
 
     Labels labels{
         {{UI_POS_X(1), UI_POS_Y(0)}, "Min:      Max:       ", Theme::getInstance()->fg_light->foreground},
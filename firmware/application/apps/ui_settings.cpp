@@ -764,6 +764,10 @@ AppSettingsView::AppSettingsView(
 
     ensure_directory(settings_dir);
 
+    // The INI files are only current for apps that aren't in the binary
+    // store, so bring them all up to date first.
+    export_settings_to_ini();
+
     for (const auto& entry : std::filesystem::directory_iterator(settings_dir, u"*.ini")) {
         auto path = settings_dir / entry.path();
 
@@ -771,6 +775,8 @@ AppSettingsView::AppSettingsView(
                             ui::Theme::getInstance()->fg_darkcyan->foreground,
                             &bitmap_icon_file_text,
                             [this, path](KeyEvent) {
+                                // The app loads the edited INI file from now on.
+                                import_settings_from_ini(path.stem().string());
                                 nav_.push<TextEditorView>(path);
                             }});
     }
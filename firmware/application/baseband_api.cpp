@@ -91,14 +91,15 @@ void NBFMConfig::apply(const uint8_t squelch_level) const {
     audio::set_rate(audio::Rate::Hz_24000);
 }
 
-void WFMConfig::apply() const {
+void WFMConfig::apply(const bool stereo) const {
     const WFMConfigureMessage message{
         decim_0,             // 	Dynamic array 24 taps : taps_200k_decim_0 , 	taps_180k_wfm_decim_0, taps_80k_wfm_decim_0
         decim_1,             // 	Dynamic array 16 taps : taps_200k_decim_1 or 	taps_180k_wfm_decim_1, taps_80k_wfm_decim_1
         taps_64_lp_156_198,  // Fixed channel audio filter 15khz
         75000,
         audio_48k_hpf_30hz_config,
-        audio_48k_deemph_2122_6_config};
+        audio_48k_deemph_2122_6_config,
+        stereo};
     send_message(&message);
     audio::set_rate(audio::Rate::Hz_48000);
 }
@@ -318,6 +319,28 @@ void set_spectrum(const size_t sampling_rate, const size_t trigger) {
     send_message(&message);
 }
 
+void set_spectrum_sweep(const int64_t first_center, const int64_t step, const size_t hop_count, const size_t discard) {
+    const WidebandSpectrumSweepConfigMessage message{
+        first_center, step, hop_count, discard};
+    send_message(&message);
+}
+
+void set_spectrum_sweep(const int64_t* const centers, const size_t hop_count, const size_t discard) {
+    const WidebandSpectrumSweepConfigMessage message{
+        centers, hop_count, discard};
+    send_message(&message);
+}
+
+void spectrum_sweep_tuned(const size_t hop) {
+    const SpectrumSweepTunedMessage message{hop};
+    send_message(&message);
+}
+
+void set_channelizer(const uint32_t sampling_rate, const std::array<int16_t, ChannelizerConfigureMessage::max_monitored>& monitored, const uint8_t squelch_level, const int16_t recorded) {
+    const ChannelizerConfigureMessage message{sampling_rate, monitored, squelch_level, recorded};
+    send_message(&message);
+}
+
 void set_wefax_config(uint8_t lpm = 120, uint8_t ioc = 0) {
     const WeFaxRxConfigureMessage message{lpm, ioc};
     send_message(&message);
@@ -357,6 +380,7 @@ void run_image(const spi_flash::image_tag_t image_tag) {
         chDbgPanic("BBRunning");
     }
 
+    const auto start = halGetCounterValue();
     creg::m4txevent::clear();
     shared_memory.clear_baseband_ready();
 
@@ -374,6 +398,8 @@ void run_image(const spi_flash::image_tag_t image_tag) {
         if (count == 0)
             chDbgPanic("Baseband Sync Fail");
     }
+
+    m4_image_stats().last_start_us = uint64_t(halGetCounterValue() - start) * 1000000U / halGetCounterFrequency();
 }
 
 void run_prepared_image(const uint32_t m4_code) {
@@ -59,7 +59,7 @@ struct WFMConfig {
     const fir_taps_real<24> decim_0;  // To handle all 3 WFM filters , 200k, 180k and 80K-
     const fir_taps_real<16> decim_1;
 
-    void apply() const;
+    void apply(const bool stereo) const;
 };
 
 struct WFMAMConfig {
@@ -96,6 +96,10 @@ void set_adsb();
 void set_jammer(const bool run, const jammer::JammerType type, const uint32_t speed);
 void set_rds_data(const uint16_t message_length);
 void set_spectrum(const size_t sampling_rate, const size_t trigger);
+void set_spectrum_sweep(const int64_t first_center, const int64_t step, const size_t hop_count, const size_t discard);
+void set_spectrum_sweep(const int64_t* const centers, const size_t hop_count, const size_t discard);
+void spectrum_sweep_tuned(const size_t hop);
+void set_channelizer(const uint32_t sampling_rate, const std::array<int16_t, ChannelizerConfigureMessage::max_monitored>& monitored, const uint8_t squelch_level, const int16_t recorded);
 void set_siggen_tone(const uint32_t tone);
 void set_siggen_config(const uint32_t bw, const uint32_t shape, const uint32_t duration);
 void set_spectrum_painter_config(const uint16_t width, const uint16_t height, bool update, int32_t bw);
@@ -23,6 +23,7 @@
 #include "baseband_api.hpp"
 #include "core_control.hpp"
 #include "hal.h"
+#include "image_blocks.hpp"
 #include "lpc43xx_cpp.hpp"
 #include "lz4.h"
 #include "message.hpp"
@@ -32,34 +33,59 @@
 using namespace lpc43xx;
 using namespace portapack;
 
+namespace {
+
+M4ImageResidency<spi_flash::image_tag_t> m4_image_resident{};
+M4ImageStats m4_image_stats_{};
+
+uint32_t elapsed_us(const halrtcnt_t start) {
+    return uint64_t(halGetCounterValue() - start) * 1000000U / halGetCounterFrequency();
+}
+
+}  // namespace
+
 void m4_init(const spi_flash::image_tag_t image_tag, const memory::region_t to, const bool full_reset) {
-    const spi_flash::chunk_t* chunk = reinterpret_cast<const spi_flash::chunk_t*>(spi_flash::images.base());
-    while (chunk->tag) {
-        if (chunk->tag == image_tag) {
-            const void* src = &chunk->data[0];
-            void* dst = reinterpret_cast<void*>(to.base());
-
-            /* extract and initialize M4 code RAM */
-            unlz4_len(src, dst, chunk->compressed_data_size);
-
-            /* M4 core is assumed to be sleeping with interrupts off, so we can mess
-             * with its address space and RAM without concern.
-             */
-            LPC_CREG->M4MEMMAP = to.base();
-
-            /* Reset M4 core and optionally all peripherals */
-            LPC_RGU->RESET_CTRL[0] = (full_reset) ? (1 << 1)    // PERIPH_RST
-                                                  : (1 << 13);  // M4_RST
-
-            return;
-        }
-        chunk = chunk->next();
+    const auto start = halGetCounterValue();
+    const auto region = reinterpret_cast<const uint32_t*>(to.base());
+    const size_t region_words = to.size() / sizeof(uint32_t);
+
+    if (m4_image_resident.holds(image_tag, region, region_words)) {
+        m4_image_stats_.reused++;
+        m4_image_stats_.last_load_bytes = 0;
+    } else {
+        m4_image_resident.invalidate();
+
+        const spi_flash::chunk_t* chunk = reinterpret_cast<const spi_flash::chunk_t*>(spi_flash::images.base());
+        while (chunk->tag && !(chunk->tag == image_tag))
+            chunk = chunk->next();
+
+        if (!chunk->tag)
+            chDbgPanic("NoImg");
+
+        /* extract and initialize M4 code RAM */
+        image_blocks::Unpacker unpacker{reinterpret_cast<void*>(to.base()), to.size(), unlz4_len};
+        if (!unpacker.unpack(&chunk->data[0], chunk->length))
+            chDbgPanic("ImgCRC");
+
+        m4_image_resident.unpacked(image_tag, region, region_words);
+        m4_image_stats_.unpacked++;
+        m4_image_stats_.last_load_bytes = unpacker.unpacked_size();
     }
+    m4_image_stats_.last_load_us = elapsed_us(start);
+
+    /* M4 core is assumed to be sleeping with interrupts off, so we can mess
+     * with its address space and RAM without concern.
+     */
+    LPC_CREG->M4MEMMAP = to.base();
 
-    chDbgPanic("NoImg");
+    /* Reset M4 core and optionally all peripherals */
+    LPC_RGU->RESET_CTRL[0] = (full_reset) ? (1 << 1)    // PERIPH_RST
+                                          : (1 << 13);  // M4_RST
 }
 
 void m4_init_prepared(const uint32_t m4_code, const bool full_reset) {
+    m4_image_resident.invalidate();
+
     /* M4 core is assumed to be sleeping with interrupts off, so we can mess
      * with its address space and RAM without concern.
      */
@@ -72,6 +98,14 @@ void m4_init_prepared(const uint32_t m4_code, const bool full_reset) {
     return;
 }
 
+void m4_image_invalidate() {
+    m4_image_resident.invalidate();
+}
+
+M4ImageStats& m4_image_stats() {
+    return m4_image_stats_;
+}
+
 void m4_request_shutdown() {
     baseband::shutdown();
 }
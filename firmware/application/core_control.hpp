@@ -24,11 +24,16 @@
 
 #include <cstddef>
 
+#include "m4_image.hpp"
 #include "memory_map.hpp"
 #include "spi_image.hpp"
 
+/* Unpacks the image into 'to', unless it is there already, and starts it. */
 void m4_init(const portapack::spi_flash::image_tag_t image_tag, const portapack::memory::region_t to, const bool full_reset);
 void m4_init_prepared(const uint32_t m4_code, const bool full_reset);
+/* Whoever writes M4 code RAM without m4_init() calls this first. */
+void m4_image_invalidate();
+M4ImageStats& m4_image_stats();
 void m4_request_shutdown();
 
 void m0_halt();
@@ -34,6 +34,7 @@
 #include "irq_controls.hpp"
 
 #include "buffer_exchange.hpp"
+#include "work_queue.hpp"
 
 #include "ch.h"
 
@@ -162,6 +163,10 @@ void EventDispatcher::dispatch(const eventmask_t events) {
         handle_local_queue();
     }
 
+    if (events & EVT_MASK_WORK_DONE) {
+        WorkQueue::on_work_done();
+    }
+
     if (events & EVT_MASK_RTC_TICK) {
         // delay error message by 2 seconds to wait for LCD being ready
         if (portapack::init_error != nullptr && ++delayed_error > 1)
@@ -46,6 +46,7 @@ constexpr auto EVT_MASK_TOUCH = EVENT_MASK(5);
 constexpr auto EVT_MASK_APPLICATION = EVENT_MASK(6);
 constexpr auto EVT_MASK_LOCAL = EVENT_MASK(7);
 constexpr auto EVT_MASK_USB = EVENT_MASK(8);
+constexpr auto EVT_MASK_WORK_DONE = EVENT_MASK(9);
 
 class EventDispatcher {
    public:
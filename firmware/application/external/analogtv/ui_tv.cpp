@@ -22,8 +22,6 @@
 
 #include "ui_tv.hpp"
 
-#include "spectrum_color_lut.hpp"
-
 #include "portapack.hpp"
 using namespace portapack;
 
@@ -31,7 +29,7 @@ using namespace portapack;
 
 #include "string_format.hpp"
 
-#include <cmath>
+#include <algorithm>
 #include <array>
 
 namespace ui::external_app::analogtv {
@@ -81,16 +79,6 @@ void TimeScopeView::on_audio_spectrum(const AudioSpectrum* spectrum) {
 
 void TVView::on_show() {
     clear();
-
-    const auto screen_r = screen_rect();
-    display.scroll_set_area(screen_r.top(), screen_r.bottom());
-}
-
-void TVView::on_hide() {
-    /* TODO: Clear region to eliminate brief flash of content at un-shifted
-     * position?
-     */
-    display.scroll_disable();
 }
 
 void TVView::paint(Painter& painter) {
@@ -98,69 +86,21 @@ void TVView::paint(Painter& painter) {
     (void)painter;
 }
 
-void TVView::on_adjust_xcorr(uint8_t xcorr) {
-    x_correction = xcorr;
-}
-
-void TVView::on_channel_spectrum(
-    const ChannelSpectrum& spectrum) {
-    // portapack has limitations
-    //  1.screen resolution (less than 240x320) 2.samples each call back (128 or 256)
-    //  3.memory size (for ui::Color, the buffer size
-    // spectrum.db[i] is 256 long
-    // 768x625 ->128x625 ->128x312 -> 128x104
-    // originally @6MHz sample rate, the PAL should be 768x625
-    // I reduced sample rate to 2MHz(3 times less samples), then calculate mag (effectively decimate by 2)
-    // the resolution is now changed to 128x625. The total decimation factor is 6, which changes how many samples in a line
-    // However 625 is too large for the screen, also interlaced scanning is harder to realize in portapack than normal computer.
-    // So I decided to simply drop half of the lines, once y is larger than 625/2=312.5 or 312, I recognize it as a new frame.
-    // then the resolution is changed to 128x312
-    // 128x312 is now able to put into a 240x320 screen, but the buffer for a whole frame is 128x312=39936, which is too large
-    // according to my test, I can only make a buffer with a length of 13312 of type ui::Color. which is 1/3 of what I wanted.
-    // So now the resolution is changed to 128x104, the height is shrinked to 1/3 of the original height.
-    // I was expecting to see 1/3 height of original video.
-
-    // Look how nice is that! I am now able to meet the requirements of 1 and 3 for portapack. Also the length of a line is 128
-    // Each call back gives me 256 samples which is exactly 2 lines. What a coincidence!
-
-    // After some experiment, I did some improvements.
-    // 1.I found that instead of 1/3 of the frame is shown, I got 3 whole frames shrinked into one window.
-    // So I made the height twice simply by painting 2 identical lines in the place of original lines
-    // 2.I found sometimes there is an horizontal offset, so I added x_correction to move the frame back to center manually
-    // 3.I changed video_buffer's type, from ui::Color to uint_8, since I don't need 3 digit to represent a grey scale value.
-    // I was hoping that by doing this, I can have a longer buffer like 39936, then the frame will looks better vertically
-    // however this is useless until now.
-
-    for (size_t i = 0; i < 256; i++) {
-        // video_buffer[i+count*256] = spectrum_rgb4_lut[spectrum.db[i]];
-        video_buffer_int[i + count * 256] = 255 - spectrum.db[i];
-    }
-    count = count + 1;
-    if (count == 52 - 1) {
-        ui::Color line_buffer[128];
-        Coord line;
-        uint32_t bmp_px;
-
-        /*for (line = 0; line < 104; line++)
-                {
-                        for (bmp_px = 0; bmp_px < 128; bmp_px++)
-                        {
-                                //line_buffer[bmp_px] = video_buffer[bmp_px+line*128];
-                                line_buffer[bmp_px] = spectrum_rgb4_lut[video_buffer_int[bmp_px+line*128 + x_correction]];
-                        }
-
-                        display.render_line({ 0, line + 100 }, 128, line_buffer);
-                }*/
-        for (line = 0; line < 208; line = line + 2) {
-            for (bmp_px = 0; bmp_px < 128; bmp_px++) {
-                // line_buffer[bmp_px] = video_buffer[bmp_px+line*128];
-                line_buffer[bmp_px] = spectrum_rgb4_lut[video_buffer_int[bmp_px + line / 2 * 128 + x_correction]];
-            }
-
-            display.render_line({0, line + 100}, 128, line_buffer);
-            display.render_line({0, line + 101}, 128, line_buffer);
+/* Pixels are doubled across the screen, rows are drawn as they come as
+ * far as the view goes. */
+void TVView::on_field(const AnalogTvField& field) {
+    const auto r = screen_rect();
+    const size_t rows = std::min<size_t>(field.lines, r.height());
+    const size_t columns = std::min<size_t>(field.width, r.width() / 2);
+
+    std::array<Color, 2 * AnalogTvField::width> line_buffer;
+    for (size_t y = 0; y < rows; y++) {
+        const auto* const row = &field.pixels[y * field.width];
+        for (size_t x = 0; x < columns; x++) {
+            const uint8_t v = row[x];
+            line_buffer[2 * x] = line_buffer[2 * x + 1] = Color(v, v, v);
         }
-        count = 0;
+        display.render_line({r.left(), Coord(r.top() + y)}, 2 * columns, line_buffer.data());
     }
 }
 
@@ -174,16 +114,7 @@ void TVView::clear() {
 
 TVWidget::TVWidget() {
     add_children({&tv_view,
-                  &field_xcorr});
-    field_xcorr.set_value(10);
-}
-
-void TVWidget::on_show() {
-    baseband::spectrum_streaming_start();
-}
-
-void TVWidget::on_hide() {
-    baseband::spectrum_streaming_stop();
+                  &text_sync});
 }
 
 void TVWidget::show_audio_spectrum_view(const bool show) {
@@ -224,10 +155,15 @@ void TVWidget::paint(Painter& painter) {
     (void)painter;
 }
 
-void TVWidget::on_channel_spectrum(const ChannelSpectrum& spectrum) {
-    tv_view.on_channel_spectrum(spectrum);
-    tv_view.on_adjust_xcorr(field_xcorr.value());
-    sampling_rate = spectrum.sampling_rate;
+void TVWidget::on_field(const AnalogTvField& field) {
+    tv_view.on_field(field);
+
+    const uint8_t state = field.field_locked ? 2 : field.line_locked ? 1 : 0;
+    if (state != sync_state) {
+        static constexpr const char* labels[] = {"No sync", "H sync", "Synced"};
+        sync_state = state;
+        text_sync.set(labels[state]);
+    }
 }
 
 void TVWidget::on_audio_spectrum() {
@@ -74,15 +74,9 @@ class TimeScopeView : public View {
 class TVView : public Widget {
    public:
     void on_show() override;
-    void on_hide() override;
 
     void paint(Painter& painter) override;
-    void on_channel_spectrum(const ChannelSpectrum& spectrum);
-    void on_adjust_xcorr(uint8_t xcorr);
-    // ui::Color video_buffer[13312];
-    uint8_t video_buffer_int[13312 + 128]{0};  // 128 is for the over length caused by x_correction
-    uint32_t count = 0;
-    uint8_t x_correction = 0;
+    void on_field(const AnalogTvField& field);
 
    private:
     void clear();
@@ -99,20 +93,11 @@ class TVWidget : public View {
     TVWidget& operator=(const TVWidget&) = delete;
     TVWidget& operator=(TVWidget&&) = delete;
 
-    void on_show() override;
-    void on_hide() override;
-
     void set_parent_rect(const Rect new_parent_rect) override;
 
     void show_audio_spectrum_view(const bool show);
 
     void paint(Painter& painter) override;
-    NumberField field_xcorr{
-        {UI_POS_X(0), UI_POS_Y(0)},
-        5,
-        {0, 128},
-        1,
-        ' '};
 
    private:
     void update_widgets_rect();
@@ -122,23 +107,29 @@ class TVWidget : public View {
     static constexpr Dim scale_height = 20;
 
     TVView tv_view{};
+    Text text_sync{
+        {UI_POS_X(0), UI_POS_Y(0), UI_POS_WIDTH(8), UI_POS_HEIGHT(1)},
+        "No sync"};
+    uint8_t sync_state{0};
 
-    ChannelSpectrumFIFO* channel_fifo{nullptr};
     AudioSpectrum* audio_spectrum_data{nullptr};
     bool audio_spectrum_update{false};
 
     std::unique_ptr<TimeScopeView> audio_spectrum_view{};
 
-    int sampling_rate{0};
     int32_t cursor_position{0};
     ui::Rect tv_normal_rect{};
     ui::Rect tv_reduced_rect{};
 
-    MessageHandlerRegistration message_handler_channel_spectrum_config{
-        Message::ID::ChannelSpectrumConfig,
+    MessageHandlerRegistration message_handler_field{
+        Message::ID::AnalogTvField,
         [this](const Message* const p) {
-            const auto message = *reinterpret_cast<const ChannelSpectrumConfigMessage*>(p);
-            this->channel_fifo = message.fifo;
+            const auto message = *reinterpret_cast<const AnalogTvFieldMessage*>(p);
+            // Read in place, a field is far too big to copy.
+            while (const auto field = message.fifo->out_slot()) {
+                this->on_field(*field);
+                message.fifo->release_out();
+            }
         }};
     MessageHandlerRegistration message_handler_audio_spectrum{
         Message::ID::AudioSpectrum,
@@ -150,19 +141,13 @@ class TVWidget : public View {
     MessageHandlerRegistration message_handler_frame_sync{
         Message::ID::DisplayFrameSync,
         [this](const Message* const) {
-            if (this->channel_fifo) {
-                ChannelSpectrum channel_spectrum;
-                while (channel_fifo->out(channel_spectrum)) {
-                    this->on_channel_spectrum(channel_spectrum);
-                }
-            }
             if (this->audio_spectrum_update) {
                 this->audio_spectrum_update = false;
                 this->on_audio_spectrum();
             }
         }};
 
-    void on_channel_spectrum(const ChannelSpectrum& spectrum);
+    void on_field(const AnalogTvField& field);
     void on_audio_spectrum();
 };
 
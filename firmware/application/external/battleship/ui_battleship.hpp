@@ -159,8 +159,7 @@ class BattleshipView : public View {
     bool is_transmitting{false};
 
     // POCSAG decoding state
-    pocsag::EccContainer ecc{};
-    pocsag::POCSAGState pocsag_state{&ecc};
+    pocsag::POCSAGState pocsag_state{};
     uint32_t last_address{0};
 
     // UI Elements - Menu/Settings Screen
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "ui.hpp"
+#include "ui_chanmon.hpp"
+#include "ui_navigation.hpp"
+#include "external_app.hpp"
+
+namespace ui::external_app::chanmon {
+void initialize_app(ui::NavigationView& nav) {
+    nav.push<ChannelMonitorView>();
+}
+}  // namespace ui::external_app::chanmon
+
+extern "C" {
+
+__attribute__((section(".external_app.app_chanmon.application_information"), used)) application_information_t _application_information_chanmon = {
+    /*.memory_location = */ (uint8_t*)0x00000000,
+    /*.externalAppEntry = */ ui::external_app::chanmon::initialize_app,
+    /*.header_version = */ CURRENT_HEADER_VERSION,
+    /*.app_version = */ VERSION_MD5,
+
+    /*.app_name = */ "Chan Mon",
+    /*.bitmap_data = */ {
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+        0x40,
+        0x04,
+        0x40,
+        0x04,
+        0x44,
+        0x04,
+        0x44,
+        0x44,
+        0x44,
+        0x44,
+        0x44,
+        0x44,
+        0x44,
+        0x54,
+        0x55,
+        0x54,
+        0x55,
+        0xFC,
+        0x7F,
+        0x00,
+        0x00,
+        0xCC,
+        0x0C,
+        0x00,
+        0x00,
+        0x00,
+        0x00,
+    },
+    /*.icon_color = */ ui::Color::green().v,
+    /*.menu_location = */ app_location_t::RX,
+    /*.desired_menu_position = */ -1,
+
+    /*.m4_app_tag = portapack::spi_flash::image_tag_channelizer */ {'P', 'C', 'H', 'Z'},
+    /*.m4_app_offset = */ 0x00000000,  // will be filled at compile time
+};
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "ui_chanmon.hpp"
+
+#include "audio.hpp"
+#include "baseband_api.hpp"
+#include "portapack.hpp"
+#include "string_format.hpp"
+
+#include <algorithm>
+
+using namespace portapack;
+
+namespace ui::external_app::chanmon {
+
+namespace {
+
+// Activity levels are in half dB steps, 255 at full scale.
+constexpr int32_t level_to_db(uint8_t level) {
+    return (int32_t(level) - 255) / 2;
+}
+
+constexpr uint8_t db_to_level(int32_t db) {
+    return std::clamp<int32_t>(255 + 2 * db, 0, 255);
+}
+
+constexpr uint8_t level_floor = db_to_level(-100);
+
+}  // namespace
+
+/* ChannelActivityView **************************************************/
+
+ChannelActivityView::ChannelActivityView(Rect parent_rect)
+    : Widget{parent_rect} {
+    set_focusable(true);
+}
+
+void ChannelActivityView::set_activity(const ChannelizerActivityMessage& message) {
+    levels_ = message.level;
+    open_mask_ = message.open_mask;
+    set_dirty();
+}
+
+void ChannelActivityView::set_monitored(const Monitored& monitored) {
+    monitored_ = monitored;
+    set_dirty();
+}
+
+uint8_t ChannelActivityView::level(int32_t offset) const {
+    return levels_[offset & (levels_.size() - 1)];
+}
+
+void ChannelActivityView::paint(Painter& painter) {
+    const auto r = screen_rect();
+    const int bar_area = r.height() - mark_height;
+    const auto background = Theme::getInstance()->bg_darkest->background;
+
+    for (int32_t offset = min_offset; offset <= max_offset; offset++) {
+        const int x = r.left() + offset - min_offset;
+        if (x >= r.right())
+            break;
+
+        const auto value = std::max(level(offset), level_floor) - level_floor;
+        const int height = value * bar_area / (255 - level_floor);
+        const int16_t channel = offset & (levels_.size() - 1);
+
+        Color mark = background;
+        for (size_t n = 0; n < monitored_.size(); n++) {
+            if (monitored_[n] == channel)
+                mark = (open_mask_ & (1 << n)) ? Color::green() : Color::yellow();
+        }
+
+        Color bar = Color::cyan();
+        if (offset == cursor_)
+            bar = has_focus() ? Color::white() : Color::grey();
+        else if (offset == 0)
+            bar = Color::dark_grey();  // DC spike.
+
+        painter.fill_rectangle({x, r.top(), 1, bar_area - height}, offset == cursor_ ? Color::dark_grey() : background);
+        painter.fill_rectangle({x, r.top() + bar_area - height, 1, height}, bar);
+        painter.fill_rectangle({x, r.top() + bar_area, 1, mark_height}, mark);
+    }
+}
+
+void ChannelActivityView::move_cursor(int32_t delta) {
+    cursor_ = std::clamp(cursor_ + delta, min_offset, max_offset);
+    set_dirty();
+    if (on_change)
+        on_change(cursor_);
+}
+
+bool ChannelActivityView::on_encoder(const EncoderEvent delta) {
+    move_cursor(delta);
+    return true;
+}
+
+bool ChannelActivityView::on_key(const KeyEvent key) {
+    switch (key) {
+        case KeyEvent::Left:
+            move_cursor(-1);
+            return true;
+        case KeyEvent::Right:
+            move_cursor(1);
+            return true;
+        case KeyEvent::Select:
+            if (on_select)
+                on_select();
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* ChannelMonitorView ***************************************************/
+
+ChannelMonitorView::ChannelMonitorView(NavigationView& nav)
+    : nav_{nav} {
+    add_children({
+        &labels,
+        &field_lna,
+        &field_vga,
+        &field_rf_amp,
+        &field_volume,
+        &field_frequency,
+        &field_spacing,
+        &field_squelch,
+        &button_monitor,
+        &activity,
+        &text_cursor,
+        &record_view,
+    });
+    for (auto& text : text_monitored)
+        add_child(&text);
+
+    for (auto& offset : monitored) {
+        if (offset < ChannelActivityView::min_offset || offset > ChannelActivityView::max_offset)
+            offset = unused;
+    }
+
+    field_spacing.set_by_value(spacing_index);
+    field_spacing.on_change = [this](size_t, OptionsField::value_t v) {
+        spacing_index = v;
+        field_frequency.set_step(spacing());
+        start();
+    };
+    field_frequency.set_step(spacing());
+    field_frequency.updated = [this](rf::Frequency) {
+        update_cursor_text();
+        update_monitored_text(0);
+    };
+
+    field_squelch.set_value(squelch_db);
+    field_squelch.on_change = [this](int32_t v) {
+        squelch_db = v;
+        configure();
+    };
+
+    activity.on_change = [this](int32_t) {
+        update_cursor_text();
+        if (!record_view.is_active())
+            configure();
+    };
+    activity.on_select = [this]() {
+        toggle_monitor(activity.cursor());
+    };
+    button_monitor.on_select = [this](Button&) {
+        toggle_monitor(activity.cursor());
+    };
+
+    record_view.set_filename_date_frequency(true);
+    record_view.on_error = [&nav](std::string message) {
+        nav.display_modal("Error", message);
+    };
+    record_view.set_sampling_rate(12000);
+
+    start();
+}
+
+ChannelMonitorView::~ChannelMonitorView() {
+    record_view.stop();
+    audio::output::stop();
+    receiver_model.disable();
+    baseband::shutdown();
+}
+
+void ChannelMonitorView::focus() {
+    activity.focus();
+}
+
+uint32_t ChannelMonitorView::sampling_rate() const {
+    constexpr std::array<uint32_t, 3> rates{2'133'333, 2'560'000, 3'200'000};
+    return rates[std::min<size_t>(spacing_index, rates.size() - 1)];
+}
+
+uint32_t ChannelMonitorView::spacing() const {
+    return sampling_rate() / ChannelizerConfigureMessage::channel_count;
+}
+
+rf::Frequency ChannelMonitorView::channel_frequency(int32_t offset) const {
+    return field_frequency.value() + (rf::Frequency)offset * sampling_rate() / ChannelizerConfigureMessage::channel_count;
+}
+
+ChannelActivityView::Monitored ChannelMonitorView::monitored_channels() const {
+    ChannelActivityView::Monitored channels{};
+    for (size_t n = 0; n < max_monitored; n++)
+        channels[n] = (monitored[n] == unused) ? -1 : monitored[n] & (ChannelizerConfigureMessage::channel_count - 1);
+    return channels;
+}
+
+void ChannelMonitorView::start() {
+    record_view.stop();
+    audio::output::stop();
+    receiver_model.disable();
+    baseband::shutdown();
+
+    baseband::run_prepared_image(portapack::memory::map::m4_code.base());
+    receiver_model.set_modulation(ReceiverModel::Mode::Capture);
+    receiver_model.set_sampling_rate(sampling_rate());
+    receiver_model.set_baseband_bandwidth(sampling_rate() >= 3'000'000 ? 2'500'000 : 1'750'000);
+    configure();
+
+    audio::set_rate(audio::Rate::Hz_12000);
+    audio::output::start();
+    receiver_model.set_headphone_volume(receiver_model.headphone_volume());  // WM8731 hack.
+    receiver_model.enable();
+
+    update_cursor_text();
+    update_monitored_text(0);
+}
+
+void ChannelMonitorView::configure() {
+    const auto channels = monitored_channels();
+    if (!record_view.is_active())
+        recorded = activity.cursor() & (ChannelizerConfigureMessage::channel_count - 1);
+    baseband::set_channelizer(sampling_rate(), channels, db_to_level(squelch_db), recorded);
+    activity.set_monitored(channels);
+}
+
+void ChannelMonitorView::toggle_monitor(int32_t offset) {
+    auto it = std::find(monitored.begin(), monitored.end(), offset);
+    if (it == monitored.end())
+        it = std::find(monitored.begin(), monitored.end(), unused);
+
+    if (it == monitored.end()) {
+        nav_.display_modal("Monitor", "All " + to_string_dec_uint(max_monitored) + " monitors in use.\nDeselect one first.");
+        return;
+    }
+
+    *it = (*it == offset) ? unused : offset;
+    configure();
+    update_monitored_text(0);
+}
+
+void ChannelMonitorView::update_cursor_text() {
+    const auto offset = activity.cursor();
+    text_cursor.set(
+        to_string_dec_int(offset, 4) + " " +
+        to_string_short_freq(channel_frequency(offset)) + " " +
+        to_string_dec_int(level_to_db(activity.level(offset)), 4) + "dB");
+}
+
+void ChannelMonitorView::update_monitored_text(uint8_t open_mask) {
+    for (size_t n = 0; n < max_monitored; n++) {
+        const auto offset = monitored[n];
+        if (offset == unused) {
+            text_monitored[n].set(to_string_dec_uint(n + 1) + " -");
+            continue;
+        }
+        text_monitored[n].set(
+            to_string_dec_uint(n + 1) + " " +
+            to_string_short_freq(channel_frequency(offset)) +
+            ((open_mask & (1 << n)) ? " OPEN" : ""));
+    }
+}
+
+void ChannelMonitorView::on_activity(const ChannelizerActivityMessage& message) {
+    activity.set_activity(message);
+    update_cursor_text();
+    update_monitored_text(message.open_mask);
+}
+
+}  // namespace ui::external_app::chanmon
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef __UI_CHANMON_H__
+#define __UI_CHANMON_H__
+
+#include "ui.hpp"
+#include "ui_navigation.hpp"
+#include "ui_receiver.hpp"
+#include "ui_freq_field.hpp"
+#include "ui_record_view.hpp"
+#include "app_settings.hpp"
+#include "radio_state.hpp"
+#include "message.hpp"
+
+#include <array>
+#include <functional>
+
+namespace ui::external_app::chanmon {
+
+/* One column per channel, the monitored ones marked under their bar
+ * (green while above squelch). The encoder moves the cursor. */
+class ChannelActivityView : public Widget {
+   public:
+    static constexpr size_t max_monitored = ChannelizerConfigureMessage::max_monitored;
+    using Monitored = std::array<int16_t, max_monitored>;
+
+    // Shown channel offsets. The others are in the baseband filter's roll off anyway.
+    static constexpr int32_t min_offset = -120;
+    static constexpr int32_t max_offset = 119;
+
+    std::function<void(int32_t)> on_change{};
+    std::function<void()> on_select{};
+
+    ChannelActivityView(Rect parent_rect);
+
+    void set_activity(const ChannelizerActivityMessage& message);
+    void set_monitored(const Monitored& monitored);
+
+    int32_t cursor() const { return cursor_; }
+    uint8_t level(int32_t offset) const;
+
+    void paint(Painter& painter) override;
+    bool on_encoder(const EncoderEvent delta) override;
+    bool on_key(const KeyEvent key) override;
+
+   private:
+    static constexpr int mark_height = 4;
+
+    std::array<uint8_t, ChannelizerConfigureMessage::channel_count> levels_{};
+    Monitored monitored_{-1, -1, -1, -1};
+    uint8_t open_mask_{0};
+    int32_t cursor_{0};
+
+    void move_cursor(int32_t delta);
+};
+
+class ChannelMonitorView : public View {
+   public:
+    ChannelMonitorView(NavigationView& nav);
+    ~ChannelMonitorView();
+
+    void focus() override;
+
+    std::string title() const override { return "Chan Mon"; };
+
+   private:
+    static constexpr size_t max_monitored = ChannelActivityView::max_monitored;
+
+    NavigationView& nav_;
+    RxRadioState radio_state_{ReceiverModel::Mode::Capture};
+
+    uint8_t spacing_index{2};
+    int32_t squelch_db{-70};
+    static constexpr int32_t unused = 1000;  // Out of the channel offsets.
+    std::array<int32_t, max_monitored> monitored{unused, unused, unused, unused};
+    int16_t recorded{0};  // Follows the cursor while not recording.
+
+    app_settings::SettingsManager settings_{
+        "rx_chanmon"sv,
+        app_settings::Mode::RX,
+        {
+            {"spacing"sv, &spacing_index},
+            {"squelch"sv, &squelch_db},
+            {"monitor1"sv, &monitored[0]},
+            {"monitor2"sv, &monitored[1]},
+            {"monitor3"sv, &monitored[2]},
+            {"monitor4"sv, &monitored[3]},
+        }};
+
+    Labels labels{
+        {{UI_POS_X(0), UI_POS_Y(0)}, "LNA:   VGA:   AMP:  ", Theme::getInstance()->fg_light->foreground},
+        {{UI_POS_X_RIGHT(6), UI_POS_Y(0)}, "VOL:  ", Theme::getInstance()->fg_light->foreground},
+        {{UI_POS_X(12), UI_POS_Y(1)}, "Spacing:", Theme::getInstance()->fg_light->foreground},
+        {{UI_POS_X(0), UI_POS_Y(2)}, "Squelch:    dB", Theme::getInstance()->fg_light->foreground},
+    };
+
+    LNAGainField field_lna{
+        {UI_POS_X(4), UI_POS_Y(0)}};
+
+    VGAGainField field_vga{
+        {UI_POS_X(11), UI_POS_Y(0)}};
+
+    RFAmpField field_rf_amp{
+        {UI_POS_X(18), UI_POS_Y(0)}};
+
+    AudioVolumeField field_volume{
+        {UI_POS_X_RIGHT(2), UI_POS_Y(0)}};
+
+    RxFrequencyField field_frequency{
+        {UI_POS_X(0), UI_POS_Y(1)},
+        nav_};
+
+    OptionsField field_spacing{
+        {UI_POS_X(21), UI_POS_Y(1)},
+        5,
+        {
+            {"8.33k", 0},
+            {"10k", 1},
+            {"12.5k", 2},
+        }};
+
+    NumberField field_squelch{
+        {UI_POS_X(9), UI_POS_Y(2)},
+        3,
+        {-120, 0},
+        1,
+        ' ',
+    };
+
+    Button button_monitor{
+        {UI_POS_X_RIGHT(9), UI_POS_Y(2), UI_POS_WIDTH(9), UI_POS_DEFAULT_HEIGHT},
+        "MONITOR"};
+
+    ChannelActivityView activity{
+        {UI_POS_X(0), UI_POS_Y(4), screen_width, 8 * 16}};
+
+    Text text_cursor{
+        {UI_POS_X(0), UI_POS_Y(12), screen_width, UI_POS_DEFAULT_HEIGHT},
+        ""};
+
+    std::array<Text, max_monitored> text_monitored{{
+        {{UI_POS_X(0), UI_POS_Y(13), screen_width, UI_POS_DEFAULT_HEIGHT}, ""},
+        {{UI_POS_X(0), UI_POS_Y(14), screen_width, UI_POS_DEFAULT_HEIGHT}, ""},
+        {{UI_POS_X(0), UI_POS_Y(15), screen_width, UI_POS_DEFAULT_HEIGHT}, ""},
+        {{UI_POS_X(0), UI_POS_Y(16), screen_width, UI_POS_DEFAULT_HEIGHT}, ""},
+    }};
+
+    // Records the channel under the cursor when recording starts.
+    RecordView record_view{
+        {UI_POS_X(0), UI_POS_Y_BOTTOM(2), UI_POS_MAXWIDTH, UI_POS_DEFAULT_HEIGHT},
+        u"AUD",
+        u"AUDIO",
+        RecordView::FileType::WAV,
+        4096,
+        4};
+
+    uint32_t sampling_rate() const;
+    uint32_t spacing() const;
+    rf::Frequency channel_frequency(int32_t offset) const;
+    ChannelActivityView::Monitored monitored_channels() const;
+
+    void start();
+    void configure();
+    void toggle_monitor(int32_t offset);
+    void update_cursor_text();
+    void update_monitored_text(uint8_t open_mask);
+    void on_activity(const ChannelizerActivityMessage& message);
+
+    MessageHandlerRegistration message_handler_activity{
+        Message::ID::ChannelizerActivity,
+        [this](const Message* const p) {
+            on_activity(*static_cast<const ChannelizerActivityMessage*>(p));
+        }};
+};
+
+}  // namespace ui::external_app::chanmon
+
+#endif /*__UI_CHANMON_H__*/
@@ -65,6 +65,10 @@ struct ERTKey {
     }
 };
 
+inline uint32_t recent_entries_hash(const ERTKey& key) {
+    return recent_entries_hash(key.id) * 31 + recent_entries_hash(key.commodity_type);
+}
+
 struct ERTRecentEntry {
     using Key = ERTKey;
 
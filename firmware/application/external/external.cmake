@@ -264,6 +264,10 @@ set(EXTCPPSRC
 	#adult_toys_controller  144 bytes 
 	external/adult_toys_controller/main.cpp
 	external/adult_toys_controller/ui_adult_toys_controller.cpp
+
+	#chanmon
+	external/chanmon/main.cpp
+	external/chanmon/ui_chanmon.cpp
 )
 
 set(EXTAPPLIST
@@ -330,4 +334,5 @@ set(EXTAPPLIST
 	bht_tx
 	morse_practice
 	adult_toys_controller
+	chanmon
 )
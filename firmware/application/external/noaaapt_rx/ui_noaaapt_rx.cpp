@@ -59,8 +59,14 @@ NoaaAptRxView::NoaaAptRxView(NavigationView& nav)
                   &txt_status,
                   //&check_wav,  // enable this or the record view, but not both. yet it has some error, says "Invalid object" a lot. so disabled it
                   //&record_view,  //
+                  &check_png,
                   &button_ss});
 
+    check_png.set_value(save_png);
+    check_png.on_select = [this](Checkbox&, bool v) {
+        save_png = v;
+    };
+
     record_view.set_filename_date_frequency(true);
     record_view.on_error = [&nav](std::string message) {
         nav.display_modal("Error", message);
@@ -83,8 +89,8 @@ NoaaAptRxView::NoaaAptRxView(NavigationView& nav)
     txt_status.set("Waiting for signal.");
 
     button_ss.on_select = [this](Button&) {
-        if (bmp.is_loaded()) {
-            bmp.close();
+        if (image.is_open()) {
+            image.close();
             button_ss.set_text(LanguageHelper::currentMessages[LANG_START]);
             if (check_wav.value()) {
                 record_view.stop();
@@ -95,7 +101,8 @@ NoaaAptRxView::NoaaAptRxView(NavigationView& nav)
             record_view.start();
         }
         ensure_directory("/BMP");
-        bmp.create("/BMP/noaa_" + to_string_timestamp(rtc_time::now()) + ".bmp", NOAAAPT_PX_SIZE, 1);
+        const auto format = save_png ? image::Format::PNG : image::Format::BMP;
+        image.create("/BMP/noaa_" + to_string_timestamp(rtc_time::now()) + (save_png ? ".png" : ".bmp"), NOAAAPT_PX_SIZE, format);
 
         button_ss.set_text(LanguageHelper::currentMessages[LANG_STOP]);
     };
@@ -105,7 +112,7 @@ NoaaAptRxView::NoaaAptRxView(NavigationView& nav)
 NoaaAptRxView::~NoaaAptRxView() {
     stopping = true;
     receiver_model.set_hidden_offset(0);
-    bmp.close();
+    image.close();
     receiver_model.disable();
     baseband::shutdown();
     audio::output::stop();
@@ -124,32 +131,26 @@ void NoaaAptRxView::on_status(NoaaAptRxStatusDataMessage msg) {
     } else if (msg.state == 1) {
         tmp = "Synced.";
     } else if (msg.state == 2) {
-        tmp = "Image arriving.";
+        tmp = "Sync lost.";
     }
     txt_status.set(tmp);
 }
 
 // this stores and displays the image. keep it as simple as you can. a bit more complexity will kill the sync
-void NoaaAptRxView::on_image(NoaaAptRxImageDataMessage msg) {
+void NoaaAptRxView::on_line(const NoaaAptLine& line) {
     if ((line_num) >= UI_POS_HEIGHT_REMAINING(NOAA_IMG_START_ROW)) line_num = 0;  // for draw reset
 
-    for (uint16_t i = 0; i < msg.cnt; i += 1) {
-        Color pxl = {msg.image[i], msg.image[i], msg.image[i]};
-        bmp.write_next_px(pxl);
-        line_in_part++;
-        if (line_in_part == NOAAAPT_PX_SIZE) {
-            line_in_part = 0;
-            line_num++;
-            bmp.expand_y_delta(1);
-        }
+    for (const auto word : line.words) {
+        Color pxl = {word, word, word};
+        image.write_pixel(pxl);
+    }
 
-        uint16_t xpos = line_in_part / (NOAAAPT_PX_SIZE / 240);
-        if (xpos >= 240) xpos = 239;
-        line_buffer[xpos] = pxl;
-        if ((line_in_part == 0)) {
-            portapack::display.render_line({0, line_num + NOAA_IMG_START_ROW * 16}, 240, line_buffer);
-        }
+    for (size_t x = 0; x < 240; x++) {
+        const auto word = line.words[x * NOAAAPT_PX_SIZE / 240];
+        line_buffer[x] = {word, word, word};
     }
+    portapack::display.render_line({0, line_num + NOAA_IMG_START_ROW * 16}, 240, line_buffer);
+    line_num++;
 }
 
 }  // namespace ui::external_app::noaaapt_rx
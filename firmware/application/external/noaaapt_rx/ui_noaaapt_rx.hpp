@@ -34,7 +34,7 @@
 #include "log_file.hpp"
 #include "utility.hpp"
 #include "ui_fileman.hpp"
-#include "bmpfile.hpp"
+#include "image_sink.hpp"
 #include "file_path.hpp"
 
 using namespace ui;
@@ -59,26 +59,29 @@ class NoaaAptRxView : public View {
    private:
     void on_settings_changed();
     void on_status(NoaaAptRxStatusDataMessage msg);
-    void on_image(NoaaAptRxImageDataMessage msg);
+    void on_line(const NoaaAptLine& line);
 
     bool stopping = false;
 
-    uint16_t line_num = 0;      // nth line
-    uint16_t line_in_part = 0;  // got multiple parts of a line, so keep track of it
+    uint16_t line_num = 0;  // nth line
+    NoaaAptLineFIFO* line_fifo{nullptr};
     uint8_t delayer = 0;
     ui::Color line_buffer[240];
     std::filesystem::path filetohandle = "";
 
     bool paused = false;  // when freq field is shown for example, we need to pause
 
-    BMPFile bmp{};
+    bool save_png{false};
+    ImageSink image{};
 
     NavigationView& nav_;
     RxRadioState radio_state_{};
     app_settings::SettingsManager settings_{
         "rx_noaaapt",
         app_settings::Mode::RX,
-        {}};
+        {
+            {"save_png"sv, &save_png},
+        }};
 
     RFAmpField field_rf_amp{
         {UI_POS_X(13), UI_POS_Y(0)}};
@@ -109,6 +112,12 @@ class NoaaAptRxView : public View {
         "Save WAV too",
         true};
 
+    Checkbox check_png{
+        {UI_POS_X(0), UI_POS_Y(2)},
+        11,
+        "Save as PNG",
+        false};
+
     Text txt_status{
         {UI_POS_X(0), UI_POS_Y(1), UI_POS_WIDTH(20), UI_POS_DEFAULT_HEIGHT},
     };
@@ -125,12 +134,23 @@ class NoaaAptRxView : public View {
             on_status(message);
         }};
 
-    MessageHandlerRegistration message_handler_image{
-        Message::ID::NoaaAptRxImageData,
+    MessageHandlerRegistration message_handler_line_config{
+        Message::ID::NoaaAptRxLineConfig,
         [this](const Message* const p) {
-            if (stopping || paused) return;
-            const auto message = *reinterpret_cast<const NoaaAptRxImageDataMessage*>(p);
-            on_image(message);
+            const auto message = *reinterpret_cast<const NoaaAptRxLineConfigMessage*>(p);
+            line_fifo = message.fifo;
+        }};
+
+    MessageHandlerRegistration message_handler_frame_sync{
+        Message::ID::DisplayFrameSync,
+        [this](const Message* const) {
+            if (!line_fifo) return;
+            // Read in place, a line is too big for the stack.
+            while (const auto line = line_fifo->out_slot()) {
+                if (!stopping && !paused)
+                    on_line(*line);
+                line_fifo->release_out();
+            }
         }};
 };
 
@@ -59,8 +59,14 @@ WeFaxRxView::WeFaxRxView(NavigationView& nav)
                   &labels,
                   &options_lpm,
                   &options_ioc,
+                  &check_png,
                   &button_ss});
 
+    check_png.set_value(save_png);
+    check_png.on_select = [this](Checkbox&, bool v) {
+        save_png = v;
+    };
+
     options_lpm.on_change = [this](size_t index, int32_t v) {
         lpm_index = (uint8_t)index;
         (void)v;
@@ -88,13 +94,14 @@ WeFaxRxView::WeFaxRxView(NavigationView& nav)
     txt_status.set("Waiting for signal.");
 
     button_ss.on_select = [this](Button&) {
-        if (bmp.is_loaded()) {
-            bmp.close();
+        if (image.is_open()) {
+            image.close();
             button_ss.set_text(LanguageHelper::currentMessages[LANG_START]);
             return;
         }
         ensure_directory("/BMP");
-        bmp.create("/BMP/wefax_" + to_string_timestamp(rtc_time::now()) + ".bmp", WEFAX_PX_SIZE, 1);
+        const auto format = save_png ? image::Format::PNG : image::Format::BMP;
+        image.create("/BMP/wefax_" + to_string_timestamp(rtc_time::now()) + (save_png ? ".png" : ".bmp"), WEFAX_PX_SIZE, format);
         button_ss.set_text(LanguageHelper::currentMessages[LANG_STOP]);
     };
 
@@ -105,7 +112,7 @@ WeFaxRxView::WeFaxRxView(NavigationView& nav)
 WeFaxRxView::~WeFaxRxView() {
     stopping = true;
     receiver_model.set_hidden_offset(0);
-    bmp.close();
+    image.close();
     receiver_model.disable();
     baseband::shutdown();
     audio::output::stop();
@@ -134,12 +141,11 @@ void WeFaxRxView::on_image(WeFaxRxImageDataMessage msg) {
 
     for (uint16_t i = 0; i < msg.cnt; i += 1) {
         Color pxl = {msg.image[i], msg.image[i], msg.image[i]};
-        bmp.write_next_px(pxl);
+        image.write_pixel(pxl);
         line_in_part++;
         if (line_in_part == WEFAX_PX_SIZE) {
             line_in_part = 0;
             line_num++;
-            bmp.expand_y_delta(1);
         }
 
         uint16_t xpos = line_in_part / (WEFAX_PX_SIZE / 240);
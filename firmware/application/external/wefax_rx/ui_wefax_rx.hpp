@@ -34,7 +34,7 @@
 #include "log_file.hpp"
 #include "utility.hpp"
 #include "ui_fileman.hpp"
-#include "bmpfile.hpp"
+#include "image_sink.hpp"
 #include "file_path.hpp"
 
 using namespace ui;
@@ -71,7 +71,8 @@ class WeFaxRxView : public View {
 
     bool paused = false;  // when freq field is shown for example, we need to pause
 
-    BMPFile bmp{};
+    bool save_png{false};
+    ImageSink image{};
 
     NavigationView& nav_;
     RxRadioState radio_state_{};
@@ -81,6 +82,7 @@ class WeFaxRxView : public View {
         {
             {"ioc_index"sv, &ioc_index},
             {"lpm_index"sv, &lpm_index},
+            {"save_png"sv, &save_png},
         }};
 
     RFAmpField field_rf_amp{
@@ -123,6 +125,12 @@ class WeFaxRxView : public View {
             {"228", 1},
         }};
 
+    Checkbox check_png{
+        {23 * 8, 1 * 16},
+        3,
+        "PNG",
+        /*small*/ true};
+
     Text txt_status{
         {UI_POS_X(0), 2 * 16, 20 * 8, 16},
     };
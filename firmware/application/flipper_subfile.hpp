@@ -24,6 +24,12 @@
 
 #include "metadata_file.hpp"
 
+#include "convert.hpp"
+#include "string_format.hpp"
+
+#include <cstdlib>
+#include <string>
+
 typedef enum : uint8_t {
     FLIPPER_PROTO_UNSUPPORTED = 0,
     FLIPPER_PROTO_RAW = 1,
@@ -47,13 +53,176 @@ struct flippersub_metadata {
     uint32_t binraw_bit_count = 0;
 };
 
+/*
+Filetype: Flipper SubGhz Key File
+Version: 1
+Frequency: 433920000
+Preset: FuriHalSubGhzPresetOok650Async
+Latitute: nan
+Longitude: nan
+Protocol: BinRAW
+Bit: 1730
+TE: 495
+Bit_RAW: 1730
+Data_RAW: 02 10 84
+
+te: is the quantization interval, in us.
+bit: all bit counts in file.
+bit_raw: the bits stored in the next data_raw. this 2 can repeat
+data_raw: is an encoded sequence of durations, where each bit in the sequence encodes one TE interval: 1 - high level (there is a carrier), 0 - low (no carrier). For example, TE=100, Bit_RAW=8, Data_RAW=0x37 => 0b00110111, that is, -200 200 -100 300 will be transmitted
+
+
+
+Filetype: Flipper SubGhz RAW File
+Version: 1
+Frequency: 433920000
+Preset: FuriHalSubGhzPresetOok650Async
+Protocol: RAW
+RAW_Data: 5832 -12188 130 -162
+
+raw_data- positive: carrier for n time, negative: no carrier for n time. (us)
+*/
+
+/* The parsers below are templates so they can run on anything File-like,
+ * FileType requires the following members
+ * Result<Size> read(void* data, Size bytes_to_read)
+ * Result<Offset> seek(uint32_t offset)
+ */
+
 Optional<flippersub_metadata> read_flippersub_file(const std::filesystem::path& path);
-bool seek_flipper_raw_first_data(File& f);
-bool seek_flipper_binraw_first_data(File& f, bool seekzero = true);
-Optional<int32_t> read_flipper_raw_next_data(File& f);
-Optional<uint8_t> read_flipper_binraw_next_data(File& f);
+
 bool get_flipper_binraw_bitvalue(uint8_t byte, uint8_t nthBit);
 
+/* Reads one character, false on error or end of file. */
+template <typename FileType>
+bool read_flipper_char(FileType& f, char& ch) {
+    auto fr = f.read(&ch, 1);
+    return fr.is_ok() && *fr > 0;
+}
+
+template <typename FileType>
+Optional<flippersub_metadata> read_flippersub_metadata(FileType& f) {
+    flippersub_metadata metadata{};
+
+    char ch = 0;
+    std::string line = "";
+    while (read_flipper_char(f, ch)) {
+        if (line.length() < 130 && ch != '\n') line += ch;
+        if (ch != '\n') continue;
+
+        auto it = line.find(':', 0);
+        if (it == std::string::npos) continue;  // Bad line.
+
+        std::string fixed = line.data() + it + 1;
+        fixed = trim(fixed);
+        std::string head = line.substr(0, it);
+        line = "";
+
+        if (fixed.length() <= 1) continue;
+
+        if (head == "Filetype") {
+            if (fixed != "Flipper SubGhz Key File" && fixed != "Flipper SubGhz RAW File") return {};  // not supported
+        } else if (head == "Frequency")
+            parse_int(fixed, metadata.center_frequency);
+        else if (head == "Lat" || head == "Latitute")
+            parse_float_meta(fixed, metadata.latitude);
+        else if (head == "Lon" || head == "Longitude")
+            parse_float_meta(fixed, metadata.longitude);
+        else if (head == "Protocol") {
+            if (fixed == "RAW") metadata.protocol = FLIPPER_PROTO_RAW;
+            if (fixed == "BinRAW") metadata.protocol = FLIPPER_PROTO_BINRAW;
+        } else if (head == "TE") {  // only in BinRAW
+            metadata.te = atoi(fixed.c_str());
+        } else if (head == "Bit") {  // for us, only in BinRAW
+            metadata.binraw_bit_count = atol(fixed.c_str());
+        } else if (head == "Preset") {
+            if (fixed.find("FSK") != std::string::npos) {
+                metadata.preset = FLIPPER_PRESET_2FSK;
+            } else if (fixed.find("Ook") != std::string::npos) {
+                metadata.preset = FLIPPER_PRESET_OOK;
+            } else if (fixed.find("Custom") != std::string::npos) {
+                metadata.preset = FLIPPER_PRESET_CUSTOM;
+            }
+        }
+    }
+    if (metadata.center_frequency == 0) return {};  // Parse failed.
+
+    return metadata;
+}
+
+/* Moves the file position to the first value after 'key'. */
+template <typename FileType>
+bool seek_flipper_data(FileType& f, const std::string& key) {
+    std::string chs = "";
+    char ch;
+    while (read_flipper_char(f, ch)) {
+        if (ch == '\r') continue;
+        if (ch == '\n') {
+            chs = "";
+            continue;
+        };
+        if (ch == 0) break;
+        chs += ch;
+        if (chs == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename FileType>
+bool seek_flipper_raw_first_data(FileType& f) {
+    f.seek(0);
+    return seek_flipper_data(f, "RAW_Data: ");
+}
+
+template <typename FileType>
+bool seek_flipper_binraw_first_data(FileType& f, bool seekzero = true) {
+    if (seekzero) f.seek(0);
+    return seek_flipper_data(f, "Data_RAW: ");
+}
+
+/* Next space separated value, skipping 'key' at the start of continuation lines. */
+template <typename FileType>
+std::string read_flipper_next_token(FileType& f, const std::string& key) {
+    std::string chs = "";
+    char ch = 0;
+    while (read_flipper_char(f, ch)) {
+        if (ch == '\r') continue;  // should not present
+        if ((ch == ' ') || ch == '\n') {
+            if (chs == key) {
+                chs = "";
+                continue;
+            }
+            if (chs.empty() && ch == '\n') continue;  // line ending with a space
+            break;
+        };
+        if (ch == 0) break;
+        chs += ch;
+    }
+    return chs;
+}
+
+template <typename FileType>
+Optional<int32_t> read_flipper_raw_next_data(FileType& f) {
+    // RAW_Data: 5832 -12188 130 -162
+    auto chs = read_flipper_next_token(f, "RAW_Data:");
+    if (chs == "") return {};
+    return atol(chs.c_str());
+}
+
+template <typename FileType>
+Optional<uint8_t> read_flipper_binraw_next_data(FileType& f) {
+    // Data_RAW: 02 10 84 BUT THERE ARE Bit_RAW lines to skip!
+    auto chs = read_flipper_next_token(f, "Data_RAW:");
+    if (chs == "Bit_RAW:") {
+        read_flipper_next_token(f, "");  // Bit count of the next block.
+        chs = read_flipper_next_token(f, "Data_RAW:");
+    }
+    if (chs == "") return {};
+    return static_cast<uint8_t>(std::stoul(chs, nullptr, 16));
+}
+
 // Maybe sometime there will be a data part reader / converter
 
 #endif  // __FLIPPER_SUBFILE_HPP__
\ No newline at end of file
@@ -826,7 +826,8 @@ class MAX2837 : public MAX283x {
 	}
 #endif
 
-    bool set_frequency(const rf::Frequency lo_frequency) override;
+    using MAX283x::set_frequency;
+    bool set_frequency(const lo::SynthConfig& config) override;
 
     void set_rx_LO_iq_phase_calibration(const size_t v) override;
     void set_tx_LO_iq_phase_calibration(const size_t v) override;
@@ -845,8 +846,10 @@ class MAX2837 : public MAX283x {
 
     RegisterMap _map{initial_register_values};
     DirtyRegisters<Register, reg_count> _dirty{};
+    bool _lo_valid{false};
 
     void flush_one(const Register reg);
+    bool mark_if_changed(const Register reg, const std::array<reg_t, reg_count>& previous);
 
     void write(const Register reg, const reg_t value);
     reg_t read(const Register reg);
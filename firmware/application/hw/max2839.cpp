@@ -91,9 +91,6 @@ static uint_fast8_t bandwidth_ordinal(const uint32_t bandwidth) {
 constexpr float seconds_for_temperature_sense_adc_conversion = 30.0e-6;
 constexpr halrtcnt_t ticks_for_temperature_sense_adc_conversion = (base_m4_clk_f * seconds_for_temperature_sense_adc_conversion + 1);
 
-constexpr uint32_t reference_frequency = max283x_reference_f;
-constexpr uint32_t pll_factor = 1.0 / (4.0 / 3.0 / reference_frequency) + 0.5;
-
 static int_fast8_t requested_rx_lna_gain = 0;
 static int_fast8_t requested_rx_vga_gain = 0;
 
@@ -200,6 +197,11 @@ Mask mode_mask(const Mode mode) {
 void MAX2839::set_mode(const Mode mode) {
     _mode = mode;
 
+    if (mode == Mode::Shutdown || mode == Mode::Standby) {
+        /* Rewrite the whole synthesizer on the next tune. */
+        _lo_valid = false;
+    }
+
     Mask mask = mode_mask(mode);
     gpio_max283x_enable.write(toUType(mask) & toUType(Mask::Enable));
     gpio_max2839_rxtx.write(toUType(mask) & toUType(Mask::RxTx));
@@ -345,36 +347,43 @@ void MAX2839::set_lpf_rf_bandwidth_tx(const uint32_t bandwidth_minimum) {
     flush_one(Register::RX_TOP_1);    /* Leave LPF_MODE_SEL 0 = Normal operation */
 }
 
-bool MAX2839::set_frequency(const rf::Frequency lo_frequency) {
-    /* TODO: This is a sad implementation. Refactor. */
-    if (lo::band[0].contains(lo_frequency)) {
-        _map.r.syn_int_div.LOGEN_BSW = 0b00; /* 2300 - 2399.99MHz */
-    } else if (lo::band[1].contains(lo_frequency)) {
-        _map.r.syn_int_div.LOGEN_BSW = 0b01; /* 2400 - 2499.99MHz */
-    } else if (lo::band[2].contains(lo_frequency)) {
-        _map.r.syn_int_div.LOGEN_BSW = 0b10; /* 2500 - 2599.99MHz */
-    } else if (lo::band[3].contains(lo_frequency)) {
-        _map.r.syn_int_div.LOGEN_BSW = 0b11; /* 2600 - 2700Hz */
-    } else {
+bool MAX2839::set_frequency(const lo::SynthConfig& config) {
+    if (!config.is_valid()) {
         return false;
     }
-    _dirty[Register::SYN_INT_DIV] = 1;
 
-    const uint64_t div_q20 = (lo_frequency * (1 << 20)) / pll_factor;
+    const auto previous = _map.w;
+
+    _map.r.syn_int_div.LOGEN_BSW = config.band_index;
+    _map.r.syn_int_div.SYN_INTDIV = config.div_q20 >> 20;
+    _map.r.syn_fr_div_2.SYN_FRDIV_19_10 = (config.div_q20 >> 10) & 0x3ff;
+    _map.r.syn_fr_div_1.SYN_FRDIV_9_0 = (config.div_q20 & 0x3ff);
 
-    _map.r.syn_int_div.SYN_INTDIV = div_q20 >> 20;
-    _dirty[Register::SYN_INT_DIV] = 1;
-    _map.r.syn_fr_div_2.SYN_FRDIV_19_10 = (div_q20 >> 10) & 0x3ff;
-    _dirty[Register::SYN_FR_DIV_2] = 1;
+    const bool synth_changed = mark_if_changed(Register::SYN_INT_DIV, previous) |
+                               mark_if_changed(Register::SYN_FR_DIV_2, previous) |
+                               (_map.w[toUType(Register::SYN_FR_DIV_1)] != previous[toUType(Register::SYN_FR_DIV_1)]);
     /* flush to commit high FRDIV first, as low FRDIV commits the change */
     flush();
 
-    _map.r.syn_fr_div_1.SYN_FRDIV_9_0 = (div_q20 & 0x3ff);
-    _dirty[Register::SYN_FR_DIV_1] = 1;
-    flush();
+    if (synth_changed || !_lo_valid) {
+        flush_one(Register::SYN_FR_DIV_1);
+        _lo_valid = true;
+    }
 
     return true;
 }
+
+/* Marks a register dirty when staging a change altered it, or when the
+ * chip might not hold the staged LO settings anymore. */
+bool MAX2839::mark_if_changed(const Register reg, const std::array<reg_t, reg_count>& previous) {
+    const auto reg_num = toUType(reg);
+    if (_map.w[reg_num] == previous[reg_num] && _lo_valid) {
+        return false;
+    }
+    _dirty[reg_num] = 1;
+    return true;
+}
+
 /*
 void MAX2839::set_rx_LO_iq_phase_calibration(const size_t v) {   // Original code , rewritten below
     _map.r.rxrf_2.RX_IQERR_SPI_EN = 1;
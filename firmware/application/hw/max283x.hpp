@@ -24,6 +24,7 @@
 
 #include <array>
 
+#include "hackrf_hal.hpp"
 #include "rf_path.hpp"
 
 namespace max283x {
@@ -39,6 +40,28 @@ constexpr std::array<rf::FrequencyRange, 4> band{{
     {2600000000, 2740000000},
 }};
 
+constexpr uint32_t reference_frequency = hackrf::one::max283x_reference_f;
+constexpr uint32_t pll_factor = 1.0 / (4.0 / 3.0 / reference_frequency) + 0.5;
+
+/* Synthesizer settings for one LO frequency. Working these out involves a
+ * 64 bit division, so hop tables compute them once up front. */
+struct SynthConfig {
+    uint8_t band_index{band.size()}; /* Index into lo::band, the LOGEN_BSW value */
+    uint32_t div_q20{0};
+
+    static constexpr SynthConfig calculate(const rf::Frequency lo_frequency) {
+        for (uint8_t i = 0; i < band.size(); i++) {
+            if (band[i].contains(lo_frequency))
+                return {i, static_cast<uint32_t>((lo_frequency * (1 << 20)) / pll_factor)};
+        }
+        return {};
+    }
+
+    constexpr bool is_valid() const {
+        return band_index < band.size();
+    }
+};
+
 } /* namespace lo */
 
 /*************************************************************************/
@@ -114,26 +137,31 @@ class MAX283x {
    public:
     virtual ~MAX283x() = default;
 
-    virtual void init();
-    virtual void set_mode(const Mode mode);
+    virtual void init() = 0;
+    virtual void set_mode(const Mode mode) = 0;
+
+    virtual void set_tx_vga_gain(const int_fast8_t db) = 0;
+    virtual void set_lna_gain(const int_fast8_t db) = 0;
+    virtual void set_vga_gain(const int_fast8_t db) = 0;
+    virtual void set_lpf_rf_bandwidth_rx(const uint32_t bandwidth_minimum) = 0;
+    virtual void set_lpf_rf_bandwidth_tx(const uint32_t bandwidth_minimum) = 0;
 
-    virtual void set_tx_vga_gain(const int_fast8_t db);
-    virtual void set_lna_gain(const int_fast8_t db);
-    virtual void set_vga_gain(const int_fast8_t db);
-    virtual void set_lpf_rf_bandwidth_rx(const uint32_t bandwidth_minimum);
-    virtual void set_lpf_rf_bandwidth_tx(const uint32_t bandwidth_minimum);
+    bool set_frequency(const rf::Frequency lo_frequency) {
+        return set_frequency(lo::SynthConfig::calculate(lo_frequency));
+    }
 
-    virtual bool set_frequency(const rf::Frequency lo_frequency);
+    /* Only writes the synthesizer registers that change. */
+    virtual bool set_frequency(const lo::SynthConfig& config) = 0;
 
-    virtual void set_rx_LO_iq_phase_calibration(const size_t v);
-    virtual void set_tx_LO_iq_phase_calibration(const size_t v);
+    virtual void set_rx_LO_iq_phase_calibration(const size_t v) = 0;
+    virtual void set_tx_LO_iq_phase_calibration(const size_t v) = 0;
 
-    virtual void set_rx_buff_vcm(const size_t v);
+    virtual void set_rx_buff_vcm(const size_t v) = 0;
 
-    virtual int8_t temp_sense();
+    virtual int8_t temp_sense() = 0;
 
-    virtual reg_t read(const address_t reg_num);
-    virtual void write(const address_t reg_num, const reg_t value);
+    virtual reg_t read(const address_t reg_num) = 0;
+    virtual void write(const address_t reg_num, const reg_t value) = 0;
 };
 
 }  // namespace max283x
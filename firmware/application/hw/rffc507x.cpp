@@ -96,41 +96,35 @@ constexpr size_t divider_min = 1U << divider_log2_min;
 constexpr size_t divider_max = 1U << divider_log2_max;
 
 constexpr size_t divider_log2(const rf::Frequency vco_frequency) {
-    return (vco_frequency > (prescaler::divider_min * prescaler::max_frequency))
+    return (vco_frequency > (rf::Frequency(prescaler::divider_min) * prescaler::max_frequency))
                ? prescaler::divider_log2_max
                : prescaler::divider_log2_min;
 }
 
 } /* namespace prescaler */
 
-struct SynthConfig {
-    const size_t lo_divider_log2;
-    const size_t prescaler_divider_log2;
-    const uint64_t n_divider_q24;
-
-    static SynthConfig calculate(
-        const rf::Frequency lo_frequency) {
-        /* RFFC507x frequency synthesizer is is accurate to about 2ppb (two parts
-         * per BILLION). There's not much point to worrying about rounding and
-         * tuning error, when it amounts to 8Hz at 5GHz!
-         */
-        const size_t lo_divider_log2 = lo::divider_log2(lo_frequency);
-        const size_t lo_divider = 1U << lo_divider_log2;
+SynthConfig SynthConfig::calculate(
+    const rf::Frequency lo_frequency) {
+    /* RFFC507x frequency synthesizer is is accurate to about 2ppb (two parts
+     * per BILLION). There's not much point to worrying about rounding and
+     * tuning error, when it amounts to 8Hz at 5GHz!
+     */
+    const size_t lo_divider_log2 = lo::divider_log2(lo_frequency);
+    const size_t lo_divider = 1U << lo_divider_log2;
 
-        const rf::Frequency vco_frequency = lo_frequency * lo_divider;
+    const rf::Frequency vco_frequency = lo_frequency * lo_divider;
 
-        const size_t prescaler_divider_log2 = prescaler::divider_log2(vco_frequency);
+    const size_t prescaler_divider_log2 = prescaler::divider_log2(vco_frequency);
 
-        const uint64_t prescaled_lo_q24 = vco_frequency << (24 - prescaler_divider_log2);
-        const uint64_t n_divider_q24 = prescaled_lo_q24 / reference_frequency;
+    const uint64_t prescaled_lo_q24 = vco_frequency << (24 - prescaler_divider_log2);
+    const uint64_t n_divider_q24 = prescaled_lo_q24 / reference_frequency;
 
-        return {
-            lo_divider_log2,
-            prescaler_divider_log2,
-            n_divider_q24,
-        };
-    }
-};
+    return {
+        static_cast<uint8_t>(lo_divider_log2),
+        static_cast<uint8_t>(prescaler_divider_log2),
+        n_divider_q24,
+    };
+}
 
 /* Readback values, RFFC5072 rev A:
  * 0000: 0x8a01 => dev_id=1000101000000 mrev_id=001
@@ -231,7 +225,28 @@ void RFFC507x::set_mixer_current(const uint8_t value) {
 }
 
 void RFFC507x::set_frequency(const rf::Frequency lo_frequency) {
-    const SynthConfig synth_config = SynthConfig::calculate(lo_frequency);
+    set_frequency(SynthConfig::calculate(lo_frequency));
+}
+
+void RFFC507x::set_frequency(const SynthConfig& synth_config) {
+    stage_frequency(synth_config);
+    flush();
+}
+
+void RFFC507x::tune(const SynthConfig& synth_config) {
+    if (!stage_frequency(synth_config) && _map.r.sdi_ctrl.enbl) {
+        /* Already running at this frequency. */
+        return;
+    }
+
+    /* Enabling the device starts the VCO calibration for the new frequency. */
+    disable();
+    flush();
+    enable();
+}
+
+bool RFFC507x::stage_frequency(const SynthConfig& synth_config) {
+    const auto previous = _map.w;
 
     /* Boost charge pump leakage if VCO frequency > 3.2GHz, indicated by
      * prescaler divider set to 4 (log2=2) instead of 2 (log2=1).
@@ -241,17 +256,22 @@ void RFFC507x::set_frequency(const rf::Frequency lo_frequency) {
     } else {
         _map.r.lf.pllcpl = 2;
     }
-    flush_one(Register::LF);
 
     _map.r.p2_freq1.p2n = synth_config.n_divider_q24 >> 24;
     _map.r.p2_freq1.p2lodiv = synth_config.lo_divider_log2;
     _map.r.p2_freq1.p2presc = synth_config.prescaler_divider_log2;
     _map.r.p2_freq2.p2nmsb = (synth_config.n_divider_q24 >> 8) & 0xffff;
     _map.r.p2_freq3.p2nlsb = synth_config.n_divider_q24 & 0xff;
-    _dirty[Register::P2_FREQ1] = 1;
-    _dirty[Register::P2_FREQ2] = 1;
-    _dirty[Register::P2_FREQ3] = 1;
-    flush();
+
+    bool changed = false;
+    for (const auto reg : {Register::LF, Register::P2_FREQ1, Register::P2_FREQ2, Register::P2_FREQ3}) {
+        const auto reg_num = toUType(reg);
+        if (_map.w[reg_num] != previous[reg_num]) {
+            _dirty[reg_num] = 1;
+            changed = true;
+        }
+    }
+    return changed;
 }
 
 void RFFC507x::set_gpo1(const bool new_value) {
@@ -37,6 +37,15 @@ using address_t = spi::address_t;
 
 constexpr size_t reg_count = 31;
 
+/* Synthesizer dividers for one LO frequency, see tuning::Hop. */
+struct SynthConfig {
+    uint8_t lo_divider_log2;
+    uint8_t prescaler_divider_log2;
+    uint64_t n_divider_q24;
+
+    static SynthConfig calculate(const rf::Frequency lo_frequency);
+};
+
 enum class Register : address_t {
     LF = 0x00,
     XO = 0x01,
@@ -838,8 +847,18 @@ class RFFC507x {
 
     void set_mixer_current(const uint8_t value);
     void set_frequency(const rf::Frequency lo_frequency);
+    void set_frequency(const SynthConfig& synth_config);
     void set_gpo1(const bool new_value);
 
+    /* Programs the synthesizer and (re)enables the device, which is needed
+     * for the VCO to calibrate. Does nothing when the device is already
+     * enabled and running at this frequency. */
+    void tune(const SynthConfig& synth_config);
+
+    bool enabled() const {
+        return _map.r.sdi_ctrl.enbl;
+    }
+
     reg_t read(const address_t reg_num);
     void write(const address_t reg_num, const reg_t value);
 
@@ -854,6 +873,10 @@ class RFFC507x {
 
     void flush_one(const Register reg);
 
+    /* Updates the synthesizer registers in the map and marks the ones
+     * that changed dirty. Returns false if none did. */
+    bool stage_frequency(const SynthConfig& synth_config);
+
     reg_t readback(const Readback readback);
 
     void init_for_best_performance();
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "image_blocks.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace image_blocks {
+
+namespace {
+
+struct CRCTable {
+    std::array<uint32_t, 256> entries;
+
+    constexpr CRCTable()
+        : entries{} {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (size_t bit = 0; bit < 8; bit++)
+                c = (c & 1) ? (c >> 1) ^ 0xedb88320 : c >> 1;
+            entries[i] = c;
+        }
+    }
+};
+
+constexpr CRCTable crc_table{};
+
+constexpr size_t padded(const size_t size) {
+    return (size + 3) & ~size_t(3);
+}
+
+}  // namespace
+
+uint32_t crc32(uint32_t crc, const void* data, size_t size) {
+    const auto* p = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+    while (size--)
+        crc = crc_table.entries[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+Unpacker::Unpacker(void* dst, size_t capacity, Decoder decoder)
+    : dst_{static_cast<uint8_t*>(dst)},
+      capacity_{capacity},
+      decoder_{decoder} {
+}
+
+bool Unpacker::begin(const Header& header) {
+    started_ = header.block_size != 0 && header.unpacked_size <= capacity_;
+    header_ = header;
+    unpacked_ = 0;
+    blocks_ = 0;
+    crc_ = 0;
+    return started_;
+}
+
+size_t Unpacker::block_count() const {
+    return started_ ? (header_.unpacked_size + header_.block_size - 1) / header_.block_size : 0;
+}
+
+/* Unpacked size of block 'index', 0 past the last one. */
+size_t Unpacker::block_length(const size_t index) const {
+    if (index >= block_count())
+        return 0;
+    const size_t left = header_.unpacked_size - index * header_.block_size;
+    return left < header_.block_size ? left : header_.block_size;
+}
+
+size_t Unpacker::data_size(const uint32_t block_header, const size_t index) const {
+    const size_t expected = block_length(index);
+    if (!expected)
+        return 0;
+
+    const size_t size = block_header & ~stored_flag;
+    if (block_header & stored_flag)
+        return size == expected ? padded(size) : 0;
+
+    // The packer stores a block that doesn't get any smaller.
+    return (size > 0 && size < expected) ? padded(size + 2) : 0;
+}
+
+bool Unpacker::block(const uint32_t block_header, const uint8_t* const data) {
+    const size_t length = block_length(next_block());
+    if (!data_size(block_header, next_block()))
+        return false;
+
+    uint8_t* const out = dst_ + unpacked_;
+    if (block_header & stored_flag) {
+        memcpy(out, data, length);
+    } else {
+        if (data[block_header] || data[block_header + 1])
+            return false;
+        decoder_(data, out, block_header);
+    }
+
+    crc_ = crc32(crc_, out, length);
+    unpacked_ += length;
+    blocks_++;
+    return true;
+}
+
+bool Unpacker::unpack(const uint8_t* const stream, const size_t length) {
+    Header header;
+    if (length < sizeof(header))
+        return false;
+    memcpy(&header, stream, sizeof(header));
+    if (!begin(header))
+        return false;
+
+    size_t offset = sizeof(header);
+    while (!done()) {
+        uint32_t block_header;
+        if (length - offset < sizeof(block_header))
+            return false;
+        memcpy(&block_header, &stream[offset], sizeof(block_header));
+        offset += sizeof(block_header);
+
+        const size_t size = data_size(block_header, next_block());
+        if (!size || length - offset < size || !block(block_header, &stream[offset]))
+            return false;
+        offset += size;
+    }
+    return verified();
+}
+
+} /* namespace image_blocks */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef __IMAGE_BLOCKS_H__
+#define __IMAGE_BLOCKS_H__
+
+#include <cstddef>
+#include <cstdint>
+
+/* Baseband images, both the chunks in SPI flash and the ones external apps
+ * carry, are a stream of independently LZ4 compressed blocks:
+ *
+ *   Header
+ *   u32 block header: data size, plus stored_flag if the block is kept
+ *       uncompressed
+ *   data, zero padded to a multiple of 4; compressed data is followed by
+ *       at least 2 zero bytes
+ *   ... one block header and data per block_size bytes of image
+ *
+ * Each block unpacks on its own, right after the one before it, so a block
+ * can unpack while the next one is still being read from the SD card.
+ *
+ * unlz4_len() reads the 2 bytes past a block as the offset of one more
+ * 4 byte match; with them zero, that match copies 4 bytes onto themselves. */
+namespace image_blocks {
+
+constexpr uint32_t stored_flag = 0x80000000;
+
+struct Header {
+    uint32_t unpacked_size;
+    uint32_t block_size;  // Unpacked; the last block may be shorter.
+    uint32_t crc;         // CRC-32, as zlib's, of the unpacked image.
+};
+
+static_assert(sizeof(Header) == 12, "stream layout");
+
+/* Continues 'crc', as zlib's crc32(); start from 0. */
+uint32_t crc32(uint32_t crc, const void* data, size_t size);
+
+class Unpacker {
+   public:
+    /* Unpacks one raw LZ4 block of 'length' bytes, like unlz4_len(). */
+    using Decoder = void (*)(const void* src, void* dst, uint32_t length);
+
+    Unpacker(void* dst, size_t capacity, Decoder decoder);
+
+    /* False if the image doesn't fit. */
+    bool begin(const Header& header);
+
+    size_t block_count() const;
+
+    /* Blocks unpacked so far. */
+    size_t next_block() const {
+        return blocks_;
+    }
+
+    /* Bytes after the header of block 'index' in the stream, up to the
+     * next block header; 0 if the block is not the size it should be.
+     * Takes the index so a reader can size the next block's read before
+     * this one unpacks. */
+    size_t data_size(uint32_t block_header, size_t index) const;
+
+    /* Unpacks block next_block(); 'data' holds its data_size() bytes. */
+    bool block(uint32_t block_header, const uint8_t* data);
+
+    bool done() const {
+        return unpacked_ == header_.unpacked_size;
+    }
+
+    /* True once every block is in and the image matches its CRC. */
+    bool verified() const {
+        return started_ && done() && crc_ == header_.crc;
+    }
+
+    size_t unpacked_size() const {
+        return header_.unpacked_size;
+    }
+
+    /* Unpacks a whole stream that is in memory, as in SPI flash. */
+    bool unpack(const uint8_t* stream, size_t length);
+
+   private:
+    uint8_t* const dst_;
+    const size_t capacity_;
+    const Decoder decoder_;
+    Header header_{0, 0, 0};
+    size_t unpacked_{0};
+    size_t blocks_{0};
+    uint32_t crc_{0};
+    bool started_{false};
+
+    size_t block_length(size_t index) const;
+};
+
+} /* namespace image_blocks */
+
+#endif /*__IMAGE_BLOCKS_H__*/
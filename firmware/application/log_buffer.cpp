@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "log_buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+LogBuffer::LogBuffer(size_t capacity)
+    : capacity_{capacity},
+      data_{std::make_unique<char[]>(capacity)} {
+}
+
+bool LogBuffer::write_line(std::initializer_list<std::string_view> parts) {
+    return put(parts, "\r\n");
+}
+
+bool LogBuffer::write(std::initializer_list<std::string_view> parts) {
+    return put(parts, {});
+}
+
+bool LogBuffer::put(std::initializer_list<std::string_view> parts, std::string_view end) {
+    size_t length = end.size();
+    for (const auto& part : parts)
+        length += part.size();
+
+    const auto head = head_.load(std::memory_order_relaxed);
+    const auto used = head - tail_.load(std::memory_order_acquire);
+    if (length > capacity_ - used) {
+        stats_.dropped_lines++;
+        stats_.dropped_bytes += length;
+        return false;
+    }
+
+    auto at = head;
+    for (const auto& part : parts) {
+        copy_in(at, part);
+        at += part.size();
+    }
+    copy_in(at, end);
+    head_.store(head + length, std::memory_order_release);
+
+    stats_.lines++;
+    stats_.high_water = std::max(stats_.high_water, used + length);
+    return true;
+}
+
+size_t LogBuffer::pending() const {
+    return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_relaxed);
+}
+
+std::string_view LogBuffer::peek() const {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    const auto offset = tail % capacity_;
+    return {&data_[offset], std::min(pending(), capacity_ - offset)};
+}
+
+void LogBuffer::consume(size_t count) {
+    tail_.store(tail_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+}
+
+void LogBuffer::copy_in(size_t at, std::string_view bytes) {
+    const auto offset = at % capacity_;
+    const auto first = std::min(bytes.size(), capacity_ - offset);
+    memcpy(&data_[offset], bytes.data(), first);
+    memcpy(&data_[0], bytes.data() + first, bytes.size() - first);
+}
+
+// GroupCommit ////////////////////////////////////////////////////////////
+
+bool GroupCommit::write_due(size_t pending, uint32_t now_ms) {
+    if (pending == 0) {
+        waiting_ = false;
+        return false;
+    }
+    if (!waiting_) {
+        waiting_ = true;
+        waiting_since_ = now_ms;
+    }
+    return pending >= config_.write_bytes || now_ms - waiting_since_ >= config_.write_ms;
+}
+
+void GroupCommit::written(size_t bytes, uint32_t now_ms) {
+    if (unsynced_ == 0)
+        unsynced_since_ = now_ms;
+    unsynced_ += bytes;
+    waiting_ = false;
+}
+
+bool GroupCommit::sync_due(uint32_t now_ms) const {
+    return unsynced_ > 0 && (unsynced_ >= config_.sync_bytes || now_ms - unsynced_since_ >= config_.sync_ms);
+}
+
+void GroupCommit::synced() {
+    unsynced_ = 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef __LOG_BUFFER_H__
+#define __LOG_BUFFER_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+
+/* Lines waiting for the log writer thread. One thread writes lines in,
+ * another takes them out; neither ever waits for the other. A line that
+ * doesn't fit is dropped whole and counted. Binary records go through
+ * write() the same way.
+ *
+ * Only loads and stores of the indices are atomic, which the M0 does
+ * without locking. */
+class LogBuffer {
+   public:
+    struct Stats {
+        uint32_t lines;
+        uint32_t dropped_lines;
+        uint32_t dropped_bytes;
+        size_t high_water;  // Most bytes ever buffered.
+    };
+
+    explicit LogBuffer(size_t capacity);
+
+    LogBuffer(const LogBuffer&) = delete;
+    LogBuffer& operator=(const LogBuffer&) = delete;
+
+    size_t capacity() const { return capacity_; }
+
+    /* Writer side: the parts followed by CR LF, or nothing. */
+    bool write_line(std::initializer_list<std::string_view> parts);
+    /* The parts as they are, or nothing. */
+    bool write(std::initializer_list<std::string_view> parts);
+
+    /* Reader side. */
+    size_t pending() const;
+    /* The oldest pending bytes that are contiguous in the buffer. */
+    std::string_view peek() const;
+    void consume(size_t count);
+
+    const Stats& stats() const { return stats_; }
+
+   private:
+    const size_t capacity_;
+    std::unique_ptr<char[]> data_;
+    // Free running, wrapped on access.
+    std::atomic<size_t> head_{0};
+    std::atomic<size_t> tail_{0};
+    Stats stats_{};
+
+    bool put(std::initializer_list<std::string_view> parts, std::string_view end);
+    void copy_in(size_t at, std::string_view bytes);
+};
+
+/* When to write the buffered lines out and when to sync the file. Writes
+ * go out in blocks, or once the oldest line has waited long enough, and a
+ * sync covers every write since the last one. */
+class GroupCommit {
+   public:
+    struct Config {
+        size_t write_bytes;  // Write out once this much is pending...
+        uint32_t write_ms;   // ...or pending data is this old.
+        size_t sync_bytes;   // Sync once this much is written since...
+        uint32_t sync_ms;    // ...or the oldest unsynced write is this old.
+    };
+
+    static constexpr Config default_config{512, 250, 4096, 2000};
+
+    explicit GroupCommit(Config config = default_config)
+        : config_{config} {
+    }
+
+    bool write_due(size_t pending, uint32_t now_ms);
+    void written(size_t bytes, uint32_t now_ms);
+
+    bool sync_due(uint32_t now_ms) const;
+    void synced();
+
+   private:
+    Config config_;
+    bool waiting_{false};
+    uint32_t waiting_since_{0};
+    size_t unsynced_{0};
+    uint32_t unsynced_since_{0};
+};
+
+#endif /*__LOG_BUFFER_H__*/
@@ -20,21 +20,185 @@
  */
 
 #include "log_file.hpp"
-#include "string_format.hpp"
+
+LogFile* LogFile::first_open = nullptr;
+
+LogFile::~LogFile() {
+    stop();
+}
+
+Optional<File::Error> LogFile::append(const std::filesystem::path& filename) {
+    stop();
+
+    auto result = ensure_directory(filename.parent_path());
+    if (result.code())
+        return {result};
+
+    auto open_error = file.append(filename);
+    if (open_error)
+        return open_error;
+
+    if (!buffer)
+        buffer = std::make_unique<LogBuffer>(buffer_size);
+    commit = GroupCommit{};
+    error = FR_OK;
+
+    next_open = first_open;
+    first_open = this;
+    // Below the UI thread, FATFS needs the stack.
+    thread = chThdCreateFromHeap(NULL, 1024, NORMALPRIO - 1, LogFile::static_fn, this);
+    // Without the heap for a thread, lines are written as they come.
+    synchronous = (thread == nullptr);
+    return {};
+}
+
+/* to_string_timestamp() without the std::string temporaries. */
+static void format_timestamp(const rtc::RTC& datetime, char (&out)[14]) {
+    const uint32_t fields[] = {datetime.year(), datetime.month(), datetime.day(), datetime.hour(), datetime.minute(), datetime.second()};
+    char* p = &out[14];
+    for (size_t i = 6; i > 0; i--) {
+        auto value = fields[i - 1];
+        for (size_t digit = (i == 1) ? 4 : 2; digit > 0; digit--) {
+            *--p = '0' + value % 10;
+            value /= 10;
+        }
+    }
+}
 
 Optional<File::Error> LogFile::write_entry(const std::string& entry) {
     return write_entry(rtc_time::now(), entry);
 }
 
 Optional<File::Error> LogFile::write_entry(const rtc::RTC& datetime, const std::string& entry) {
-    std::string timestamp = to_string_timestamp(datetime);
-    return write_raw(timestamp + " " + entry);
+    char timestamp[14];
+    format_timestamp(datetime, timestamp);
+    return write_line({{timestamp, sizeof(timestamp)}, " ", entry});
 }
 
 Optional<File::Error> LogFile::write_raw(const std::string& message) {
-    auto error = file.write_line(message);
-    if (!error) {
-        file.sync();
+    return write_line({message});
+}
+
+Optional<File::Error> LogFile::write_bytes(std::string_view bytes) {
+    if (!buffer)
+        return {File::Error{FR_NOT_ENABLED}};
+    buffer->write({bytes});
+    if (synchronous)
+        write_through();
+    return last_error();
+}
+
+Optional<File::Error> LogFile::write_line(std::initializer_list<std::string_view> parts) {
+    if (!buffer)
+        return {File::Error{FR_NOT_ENABLED}};
+    buffer->write_line(parts);
+    if (synchronous)
+        write_through();
+    return last_error();
+}
+
+/* Dropped lines are only counted, see stats(). */
+Optional<File::Error> LogFile::last_error() const {
+    if (error != FR_OK)
+        return {File::Error{error}};
+    return {};
+}
+
+LogBuffer::Stats LogFile::stats() const {
+    return buffer ? buffer->stats() : LogBuffer::Stats{};
+}
+
+void LogFile::flush_all() {
+    while (first_open)
+        first_open->stop();
+}
+
+msg_t LogFile::static_fn(void* arg) {
+    static_cast<LogFile*>(arg)->run();
+    return 0;
+}
+
+void LogFile::run() {
+    // System ticks are ms.
+    while (!chThdShouldTerminate()) {
+        const uint32_t now = chTimeNow();
+        if (commit.write_due(buffer->pending(), now))
+            write_pending(now);
+        if (commit.sync_due(now))
+            sync();
+        chThdSleepMilliseconds(poll_ms);
+    }
+
+    write_pending(chTimeNow());
+    sync();
+}
+
+void LogFile::write_pending(uint32_t now_ms) {
+    while (buffer->pending()) {
+        const auto chunk = buffer->peek();
+        const auto result = file.write(chunk.data(), chunk.size());
+        if (result.is_error())
+            error = result.error().code();
+        // Lost if it failed, the next lines may still make it.
+        buffer->consume(chunk.size());
+        commit.written(chunk.size(), now_ms);
+    }
+}
+
+void LogFile::write_through() {
+    const uint32_t now = chTimeNow();
+    write_pending(now);
+    if (commit.sync_due(now))
+        sync();
+}
+
+void LogFile::sync() {
+    const auto sync_error = file.sync();
+    if (sync_error)
+        error = sync_error->code();
+    commit.synced();
+}
+
+/* Waits for the thread to write everything out. */
+void LogFile::stop() {
+    if (thread) {
+        chThdTerminate(thread);
+        chThdWait(thread);
+        thread = nullptr;
+    } else if (synchronous) {
+        write_pending(chTimeNow());
+        sync();
+        synchronous = false;
+    } else {
+        return;
+    }
+
+    for (auto link = &first_open; *link; link = &(*link)->next_open) {
+        if (*link == this) {
+            *link = next_open;
+            break;
+        }
+    }
+    next_open = nullptr;
+}
+
+// PacketLogFile //////////////////////////////////////////////////////////
+
+Optional<File::Error> PacketLogFile::append(const std::filesystem::path& filename) {
+    auto error = log_file.append(filename);
+    if (error)
+        return error;
+
+    records = 0;
+    auto sync = packet_log::Record::sync(packet_log::seconds_since_2000(rtc_time::now()), records);
+    return log_file.write_bytes(sync.bytes());
+}
+
+Optional<File::Error> PacketLogFile::write(packet_log::Record& record) {
+    if (records > 0 && records % packet_log::sync_interval == 0) {
+        auto sync = packet_log::Record::sync(packet_log::seconds_since_2000(rtc_time::now()), records);
+        log_file.write_bytes(sync.bytes());
     }
-    return error;
+    records++;
+    return log_file.write_bytes(record.bytes());
 }
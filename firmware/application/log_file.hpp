@@ -22,27 +22,83 @@
 #ifndef __LOG_FILE_H__
 #define __LOG_FILE_H__
 
+#include <atomic>
+#include <memory>
 #include <string>
 
+#include "ch.h"
+
 #include "file.hpp"
+#include "log_buffer.hpp"
+#include "packet_log.hpp"
 #include "rtc_time.hpp"
 
+/* Lines are buffered and written out by a thread of their own, in blocks,
+ * with a sync every few KB or seconds (see GroupCommit). Logging a line
+ * never waits for the SD card; when the card can't keep up, lines are
+ * dropped and counted in stats(). Everything buffered is written and
+ * synced when the LogFile goes away and on flush_all(). If there is no
+ * heap left for the thread, lines are written as they are logged. */
 class LogFile {
    public:
-    Optional<File::Error> append(const std::filesystem::path& filename) {
-        auto result = ensure_directory(filename.parent_path());
-        if (result.code())
-            return {result};
+    LogFile() = default;
+    ~LogFile();
+
+    LogFile(const LogFile&) = delete;
+    LogFile(LogFile&&) = delete;
+    LogFile& operator=(const LogFile&) = delete;
+    LogFile& operator=(LogFile&&) = delete;
 
-        return file.append(filename);
-    }
+    Optional<File::Error> append(const std::filesystem::path& filename);
 
+    /* Errors are those of earlier writes, they show up late. */
     Optional<File::Error> write_entry(const std::string& entry);
     Optional<File::Error> write_entry(const rtc::RTC& datetime, const std::string& entry);
     Optional<File::Error> write_raw(const std::string& message);
+    /* Bytes as they are, no line end. */
+    Optional<File::Error> write_bytes(std::string_view bytes);
+
+    LogBuffer::Stats stats() const;
+
+    /* Writes out every open log, before powering off. */
+    static void flush_all();
 
    private:
+    static constexpr size_t buffer_size = 2048;
+    static constexpr uint32_t poll_ms = 50;
+
     File file{};
+    std::unique_ptr<LogBuffer> buffer{};
+    GroupCommit commit{};
+    std::atomic<uint32_t> error{FR_OK};
+    Thread* thread{nullptr};
+    bool synchronous{false};  // No thread, written by the caller.
+    LogFile* next_open{nullptr};
+
+    static LogFile* first_open;
+
+    static msg_t static_fn(void* arg);
+    void run();
+    void write_pending(uint32_t now_ms);
+    void write_through();
+    void sync();
+    void stop();
+
+    Optional<File::Error> write_line(std::initializer_list<std::string_view> parts);
+    Optional<File::Error> last_error() const;
+};
+
+/* A packet_log file, written like a LogFile. */
+class PacketLogFile {
+   public:
+    Optional<File::Error> append(const std::filesystem::path& filename);
+    Optional<File::Error> write(packet_log::Record& record);
+
+    LogBuffer::Stats stats() const { return log_file.stats(); }
+
+   private:
+    LogFile log_file{};
+    uint32_t records{0};
 };
 
 #endif /*__LOG_FILE_H__*/
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __M4_IMAGE_H__
+#define __M4_IMAGE_H__
+
+#include <cstddef>
+#include <cstdint>
+
+/* Remembers which baseband image the M4 code RAM holds, so starting the
+ * image that is already there skips unpacking it from flash again.
+ *
+ * The M4 only reads its code RAM, but other code writes it: external apps
+ * copy their own baseband there. So the whole region is checksummed when
+ * an image is unpacked and again before it is reused; reading 32KiB of
+ * RAM is much quicker than unpacking an image from SPI flash. */
+template <typename Tag>
+class M4ImageResidency {
+   public:
+    static uint32_t checksum(const uint32_t* words, size_t count) {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < count; i++)
+            sum = ((sum << 5) | (sum >> 27)) ^ words[i];
+        return sum;
+    }
+
+    /* True if 'region' still holds image 'tag' as unpacked. */
+    bool holds(const Tag& tag, const uint32_t* region, size_t count) const {
+        return valid_ && tag_ == tag && region_ == region && checksum(region, count) == checksum_;
+    }
+
+    /* After unpacking image 'tag' into 'region'. */
+    void unpacked(const Tag& tag, const uint32_t* region, size_t count) {
+        tag_ = tag;
+        region_ = region;
+        checksum_ = checksum(region, count);
+        valid_ = true;
+    }
+
+    void invalidate() {
+        valid_ = false;
+    }
+
+   private:
+    Tag tag_{};
+    const uint32_t* region_{nullptr};
+    uint32_t checksum_{0};
+    bool valid_{false};
+};
+
+/* Baseband image starts, for the sysinfo shell command. */
+struct M4ImageStats {
+    uint32_t unpacked;         // Images unpacked from flash.
+    uint32_t reused;           // Starts that found their image already there.
+    uint32_t last_load_us;     // Unpacking, or checking, the last image.
+    uint32_t last_load_bytes;  // Unpacked by the last load; 0 if reused.
+    uint32_t last_read_us;     // Of an external app's load, reading the SD card.
+    uint32_t last_unpack_us;   // Of an external app's load, unpacking.
+    uint32_t last_overlap_us;  // Of an external app's load, both at once.
+    uint32_t last_start_us;    // From run_image() to the baseband being ready.
+};
+
+#endif /*__M4_IMAGE_H__*/
@@ -113,6 +113,7 @@ Continuous (Fox-oring)
 
 #include "portapack.hpp"
 #include "portapack_shared_memory.hpp"
+#include "portapack_persistent_memory.hpp"
 #include "config_mode.hpp"
 
 #include "message_queue.hpp"
@@ -137,6 +138,7 @@ Continuous (Fox-oring)
 #include "gcc.hpp"
 
 #include "sd_card.hpp"
+#include "log_file.hpp"
 
 #include <string.h>
 #include "i2cdevmanager.hpp"
@@ -191,6 +193,8 @@ int main(void) {
 
             event_loop();
 
+            LogFile::flush_all();
+            portapack::persistent_memory::flush_persistent_settings_file();
             sdcDisconnect(&SDCD1);
             sdcStop(&SDCD1);
 
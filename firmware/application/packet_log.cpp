@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "packet_log.hpp"
+
+#include <cstring>
+
+namespace packet_log {
+
+uint32_t seconds_since_2000(const lpc43xx::rtc::RTC& datetime) {
+    // Days from civil, with March as the first month of the year.
+    const uint32_t year = datetime.year() - (datetime.month() <= 2 ? 1 : 0);
+    const uint32_t month = (datetime.month() + 9) % 12;
+    const uint32_t days = 365 * year + year / 4 - year / 100 + year / 400 +
+                          (153 * month + 2) / 5 + datetime.day() - 1;
+    constexpr uint32_t days_to_2000 = 730425;  // 2000-01-01 the same way.
+    return (days - days_to_2000) * 86400 +
+           datetime.hour() * 3600 + datetime.minute() * 60 + datetime.second();
+}
+
+Record::Record(Type type, uint32_t seconds) {
+    data_[0] = static_cast<uint8_t>(type);
+    data_[1] = 0;
+    size_ = 2;
+    put32(seconds);
+}
+
+bool Record::fits(size_t size) {
+    if (size_ + size > header_size + max_payload) {
+        complete_ = false;
+        return false;
+    }
+    return true;
+}
+
+void Record::put32(uint32_t value) {
+    for (size_t i = 0; i < 4; i++)
+        put(value >> (8 * i));
+}
+
+Record& Record::raw(const uint8_t* data, size_t size) {
+    if (fits(1 + size)) {
+        put(size);
+        memcpy(&data_[size_], data, size);
+        size_ += size;
+    }
+    return *this;
+}
+
+Record& Record::field(uint8_t id, int32_t value) {
+    std::array<uint8_t, 5> varint{};
+    size_t length = 0;
+    auto zigzag = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    do {
+        varint[length++] = (zigzag & 0x7f) | (zigzag > 0x7f ? 0x80 : 0);
+        zigzag >>= 7;
+    } while (zigzag);
+
+    if (fits(1 + length)) {
+        put(id & 0x3f);
+        for (size_t i = 0; i < length; i++)
+            put(varint[i]);
+    }
+    return *this;
+}
+
+Record& Record::field(uint8_t id, float value) {
+    if (fits(1 + 4)) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        put((id & 0x3f) | (static_cast<uint8_t>(Kind::Float) << 6));
+        put32(bits);
+    }
+    return *this;
+}
+
+Record& Record::field(uint8_t id, std::string_view text) {
+    text = text.substr(0, 255);
+    if (fits(2 + text.size())) {
+        put((id & 0x3f) | (static_cast<uint8_t>(Kind::Text) << 6));
+        put(text.size());
+        memcpy(&data_[size_], text.data(), text.size());
+        size_ += text.size();
+    }
+    return *this;
+}
+
+std::string_view Record::bytes() {
+    data_[1] = size_ - header_size;
+    uint8_t sum = 0;
+    for (size_t i = 0; i < size_; i++)
+        sum += data_[i];
+    data_[size_] = ~sum;
+    return {reinterpret_cast<const char*>(data_.data()), size_ + 1};
+}
+
+Record Record::sync(uint32_t seconds, uint32_t records) {
+    Record record{Type::Sync, seconds};
+    for (const auto c : magic)
+        record.put(c);
+    record.put(version);
+    record.put32(records);
+    return record;
+}
+
+bool next_field(std::string_view& fields, Field& field) {
+    if (fields.empty())
+        return false;
+
+    const uint8_t tag = fields[0];
+    field = {static_cast<uint8_t>(tag & 0x3f), static_cast<Kind>(tag >> 6), 0, 0.0f, {}};
+    size_t used = 1;
+
+    switch (field.kind) {
+        case Kind::Int: {
+            uint32_t zigzag = 0;
+            for (size_t shift = 0;; shift += 7) {
+                if (used >= fields.size() || shift > 28)
+                    return false;
+                const uint8_t byte = fields[used++];
+                zigzag |= uint32_t(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                    break;
+            }
+            field.int_value = static_cast<int32_t>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+            break;
+        }
+
+        case Kind::Text: {
+            if (fields.size() < 2 || fields.size() < 2u + uint8_t(fields[1]))
+                return false;
+            field.text = fields.substr(2, uint8_t(fields[1]));
+            used = 2 + field.text.size();
+            break;
+        }
+
+        case Kind::Float: {
+            if (fields.size() < 5)
+                return false;
+            uint32_t bits = 0;
+            for (size_t i = 0; i < 4; i++)
+                bits |= uint32_t(uint8_t(fields[1 + i])) << (8 * i);
+            memcpy(&field.float_value, &bits, sizeof(bits));
+            used = 5;
+            break;
+        }
+
+        default:
+            return false;
+    }
+
+    fields.remove_prefix(used);
+    return true;
+}
+
+/* Size of a good record at 'at', or 0. */
+size_t Reader::record_size(size_t at) const {
+    if (data_.size() - at < header_size + 1)
+        return 0;
+    const size_t size = header_size + uint8_t(data_[at + 1]) + 1;
+    if (data_.size() - at < size)
+        return 0;
+
+    uint8_t sum = 0;
+    for (size_t i = 0; i < size; i++)
+        sum += data_[at + i];
+    if (sum != 0xff)
+        return 0;
+
+    const auto type = static_cast<Type>(data_[at]);
+    const auto payload = data_.substr(at + header_size, size - header_size - 1);
+    if (type == Type::Sync)
+        return (payload.size() >= magic.size() + 1 && payload.substr(0, magic.size()) == magic) ? size : 0;
+
+    // The raw bytes and every field have to fit exactly.
+    if (payload.empty() || uint8_t(payload[0]) + 1u > payload.size())
+        return 0;
+    auto fields = payload.substr(1 + uint8_t(payload[0]));
+    Field field{};
+    while (next_field(fields, field)) {
+    }
+    return fields.empty() ? size : 0;
+}
+
+/* Skips to the next Sync record. */
+void Reader::resync() {
+    const auto start = offset_;
+    offset_++;
+    while (offset_ < data_.size()) {
+        const auto found = data_.find(magic, offset_ + header_size);
+        if (found == std::string_view::npos) {
+            offset_ = data_.size();
+            break;
+        }
+        offset_ = found - header_size;
+        if (data_[offset_] == static_cast<char>(Type::Sync) && record_size(offset_))
+            break;
+        offset_++;
+    }
+    skipped_ += offset_ - start;
+}
+
+bool Reader::next(Entry& entry) {
+    while (offset_ < data_.size()) {
+        const auto size = record_size(offset_);
+        if (size == 0) {
+            resync();
+            continue;
+        }
+
+        const auto at = offset_;
+        offset_ += size;
+        const auto type = static_cast<Type>(data_[at]);
+        if (type == Type::Sync)
+            continue;
+
+        uint32_t seconds = 0;
+        for (size_t i = 0; i < 4; i++)
+            seconds |= uint32_t(uint8_t(data_[at + 2 + i])) << (8 * i);
+        const auto payload = data_.substr(at + header_size, size - header_size - 1);
+        const size_t raw_size = uint8_t(payload[0]);
+        entry = {type, seconds, payload.substr(1, raw_size), payload.substr(1 + raw_size)};
+        return true;
+    }
+    return false;
+}
+
+} /* namespace packet_log */
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef __PACKET_LOG_H__
+#define __PACKET_LOG_H__
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "lpc43xx_cpp.hpp"
+
+/* Binary log of decoded packets, for decoder apps that log more than a
+ * person would read on the device. tools/packet_log_export.py turns it
+ * into CSV or JSON.
+ *
+ * File:   record*
+ * Record: type:u8 length:u8 seconds:u32 payload[length] check:u8
+ *   seconds  since 2000-01-01 00:00:00, RTC time.
+ *   check    ~(sum of the other bytes of the record).
+ * Payload of a Sync record (type 0):
+ *   "PPLOG" version:u8 records:u32, the records written before it since
+ *   the file was opened.
+ * Payload of other records:
+ *   raw_length:u8 raw[raw_length] field*
+ *   field: tag:u8 value. Tag bits 7-6 give the kind of value, 5-0 the
+ *   field id, named per record type by the exporter:
+ *     0 Int    zigzag LEB128
+ *     1 Text   length:u8 bytes
+ *     2 Float  IEEE 754 single
+ * Positions are Int fields in 1e-7 degrees, see degrees_e7().
+ * Numbers are little endian. A writer starts every file with a Sync record
+ * and adds one every sync_interval records; readers skip damaged data up
+ * to the next one. */
+namespace packet_log {
+
+/* New decoders take the next free number. */
+enum class Type : uint8_t {
+    Sync = 0,
+    ADSB = 1,
+};
+
+/* Field ids of the ADSB records. */
+namespace adsb {
+enum Field : uint8_t {
+    ICAO = 1,
+    Callsign = 2,
+    Squawk = 3,
+    Altitude = 4,
+    Latitude = 5,
+    Longitude = 6,
+    VelocityType = 7,
+    Heading = 8,
+    SpeedType = 9,
+    Speed = 10,
+    VerticalRate = 11,
+    SIL = 12,
+};
+} /* namespace adsb */
+
+enum class Kind : uint8_t {
+    Int = 0,
+    Text = 1,
+    Float = 2,
+};
+
+constexpr std::string_view magic{"PPLOG"};
+constexpr uint8_t version = 1;
+constexpr size_t header_size = 6;
+constexpr size_t max_payload = 255;
+constexpr size_t max_record = header_size + max_payload + 1;
+constexpr uint32_t sync_interval = 64;
+
+uint32_t seconds_since_2000(const lpc43xx::rtc::RTC& datetime);
+
+/* A latitude or longitude as an Int field: about 1cm steps, where a float
+ * only has about 1m left at 100 degrees. */
+inline int32_t degrees_e7(double degrees) {
+    return static_cast<int32_t>(std::lround(degrees * 1e7));
+}
+
+/* Builds one record. Fields that don't fit are left out, see complete(). */
+class Record {
+   public:
+    Record(Type type, uint32_t seconds);
+    Record(Type type, const lpc43xx::rtc::RTC& datetime)
+        : Record{type, seconds_since_2000(datetime)} {
+    }
+
+    static Record sync(uint32_t seconds, uint32_t records);
+
+    /* Raw frame bytes, before any field. */
+    Record& raw(const uint8_t* data, size_t size);
+    Record& field(uint8_t id, int32_t value);
+    Record& field(uint8_t id, float value);
+    Record& field(uint8_t id, std::string_view text);
+
+    /* With the check byte. */
+    std::string_view bytes();
+    bool complete() const { return complete_; }
+
+   private:
+    std::array<uint8_t, max_record> data_{};
+    size_t size_{header_size};
+    bool complete_{true};
+
+    bool fits(size_t size);
+    void put(uint8_t byte) { data_[size_++] = byte; }
+    void put32(uint32_t value);
+};
+
+struct Field {
+    uint8_t id;
+    Kind kind;
+    int32_t int_value;
+    float float_value;
+    std::string_view text;
+};
+
+/* A record as read back. */
+struct Entry {
+    Type type;
+    uint32_t seconds;
+    std::string_view raw;
+    std::string_view fields;  // Undecoded, see next_field().
+};
+
+/* Takes the first field off 'fields'. False at the end. */
+bool next_field(std::string_view& fields, Field& field);
+
+/* Reads the records of a file held in memory. */
+class Reader {
+   public:
+    explicit Reader(std::string_view data)
+        : data_{data} {
+    }
+
+    /* Next good data record, false at the end. */
+    bool next(Entry& entry);
+
+    /* Bytes of damaged data skipped so far. */
+    size_t skipped() const { return skipped_; }
+
+   private:
+    std::string_view data_;
+    size_t offset_{0};
+    size_t skipped_{0};
+
+    size_t record_size(size_t at) const;
+    void resync();
+};
+
+} /* namespace packet_log */
+
+#endif /*__PACKET_LOG_H__*/
@@ -156,7 +156,8 @@ void set_direction(const rf::Direction new_direction) {
         led_tx.on();
 }
 
-bool set_tuning_frequency(const rf::Frequency frequency) {
+/* Applies the converter and frequency correction settings. */
+static rf::Frequency corrected_frequency(const rf::Frequency frequency) {
     rf::Frequency final_frequency = frequency;
     // if converter feature is enabled
     if (portapack::persistent_memory::config_converter()) {
@@ -180,28 +181,47 @@ bool set_tuning_frequency(const rf::Frequency frequency) {
         else  // rx freq correction up
             final_frequency = final_frequency + portapack::persistent_memory::config_freq_rx_correction();
     }
+    return final_frequency;
+}
+
+tuning::Hop compile_tuning(const rf::Frequency frequency) {
+    return tuning::Hop::create(corrected_frequency(frequency));
+}
+
+std::vector<tuning::Hop> compile_tuning(const std::vector<rf::Frequency>& frequencies) {
+    std::vector<tuning::Hop> hops{};
+    hops.reserve(frequencies.size());
+    for (const auto frequency : frequencies) {
+        hops.push_back(compile_tuning(frequency));
+    }
+    return hops;
+}
+
+bool set_tuning(const tuning::Hop& hop) {
+    if (!hop.is_valid()) {
+        return false;
+    }
 
-    const auto tuning_config = tuning::config::create(final_frequency);
-    if (tuning_config.is_valid()) {
+    // Program first local oscillator frequency (if there is one) into RFFC507x.
+    // It is left alone while it stays on the same frequency.
+    if (hop.first_lo_frequency) {
+        first_if.tune(hop.first_lo);
+    } else if (first_if.enabled()) {
         first_if.disable();
+    }
 
-        // Program first local oscillator frequency (if there is one) into RFFC507x
-        if (tuning_config.first_lo_frequency) {
-            first_if.set_frequency(tuning_config.first_lo_frequency);
-            first_if.enable();
-        }
+    // Program second local oscillator frequency into MAX283x
+    const auto result_second_if = second_if->set_frequency(hop.second_lo);
 
-        // Program second local oscillator frequency into MAX283x
-        const auto result_second_if = second_if->set_frequency(tuning_config.second_lo_frequency);
+    rf_path.set_band(hop.rf_path_band);
+    mixer_invert = hop.mixer_invert;
+    baseband_cpld.set_invert(mixer_invert ^ baseband_invert);
 
-        rf_path.set_band(tuning_config.rf_path_band);
-        mixer_invert = tuning_config.mixer_invert;
-        baseband_cpld.set_invert(mixer_invert ^ baseband_invert);
+    return result_second_if;
+}
 
-        return result_second_if;
-    } else {
-        return false;
-    }
+bool set_tuning_frequency(const rf::Frequency frequency) {
+    return set_tuning(compile_tuning(frequency));
 }
 
 void set_rf_amp(const bool rf_amp) {
@@ -23,9 +23,11 @@
 #define __RADIO_H__
 
 #include "rf_path.hpp"
+#include "tuning.hpp"
 
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 /* Direct access to the radio. Setting values incorrectly can damage
  * the device. Applications should use ReceiverModel or TransmitterModel
@@ -46,6 +48,14 @@ void init();
 
 void set_direction(const rf::Direction new_direction);
 bool set_tuning_frequency(const rf::Frequency frequency);
+
+/* Frequency lists that are retuned over and over should be compiled once
+ * and tuned with set_tuning(), which only writes the synthesizer registers
+ * that change. Compiled hops include the converter and frequency correction
+ * settings and the direction, recompile if any of those change. */
+tuning::Hop compile_tuning(const rf::Frequency frequency);
+std::vector<tuning::Hop> compile_tuning(const std::vector<rf::Frequency>& frequencies);
+bool set_tuning(const tuning::Hop& hop);
 void set_rf_amp(const bool rf_amp);
 void set_lna_gain(const int_fast8_t db);
 void set_vga_gain(const int_fast8_t db);
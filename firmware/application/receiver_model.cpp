@@ -193,6 +193,15 @@ void ReceiverModel::set_wfm_configuration(uint8_t n) {
     }
 }
 
+bool ReceiverModel::wfm_stereo() const {
+    return settings_.wfm_stereo;
+}
+
+void ReceiverModel::set_wfm_stereo(bool v) {
+    settings_.wfm_stereo = v;
+    update_modulation();
+}
+
 uint8_t ReceiverModel::wfmam_configuration() const {
     return settings_.wfmam_config_index;
 }
@@ -294,6 +303,7 @@ void ReceiverModel::configure_from_app_settings(
     settings_.vga_gain_db = settings.vga;
     settings_.rf_amp = settings.rx_amp;
     settings_.squelch_level = settings.squelch;
+    settings_.wfm_stereo = settings.wfm_stereo;
 }
 
 int32_t ReceiverModel::tuning_offset() {
@@ -382,7 +392,7 @@ void ReceiverModel::update_nbfm_configuration() {
 }
 
 void ReceiverModel::update_wfm_configuration() {
-    wfm_configs[wfm_configuration()].apply();
+    wfm_configs[wfm_configuration()].apply(wfm_stereo());
 }
 
 void ReceiverModel::update_wfmam_configuration() {
@@ -60,6 +60,7 @@ class ReceiverModel {
         uint8_t wfmam_config_index = 0;
         uint8_t nbfm_config_index = 0;
         uint8_t wfm_config_index = 0;
+        bool wfm_stereo = false;
         uint8_t squelch_level = 80;
     };
 
@@ -100,6 +101,9 @@ class ReceiverModel {
     uint8_t wfm_configuration() const;
     void set_wfm_configuration(uint8_t n);
 
+    bool wfm_stereo() const;
+    void set_wfm_stereo(bool v);
+
     uint8_t wfmam_configuration() const;
     void set_wfmam_configuration(uint8_t n);
 
@@ -28,12 +28,293 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <array>
 #include <iterator>
-#include <list>
+#include <new>
+#include <type_traits>
 #include <utility>
 
-template <class Entry>
-using RecentEntries = std::list<Entry>;
+/* Hash of an entry key for the RecentEntries index. Keys of other types
+ * need an overload next to them, found by argument dependent lookup. */
+constexpr uint32_t recent_entries_hash(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return key;
+}
+
+template <typename T, std::enable_if_t<std::is_enum<T>::value, int> = 0>
+constexpr uint32_t recent_entries_hash(const T key) {
+    return recent_entries_hash(static_cast<uint64_t>(key));
+}
+
+template <typename T>
+constexpr auto recent_entries_hash(const T& key) -> decltype(recent_entries_hash(key.value())) {
+    return recent_entries_hash(key.value());
+}
+
+template <typename A, typename B>
+constexpr uint32_t recent_entries_hash(const std::pair<A, B>& key) {
+    return recent_entries_hash(key.first) * 31 + recent_entries_hash(key.second);
+}
+
+/* Entries of a decoder app, most recently heard first, with the std::list
+ * operations the apps use. Finding an entry by key() is a hash lookup and
+ * moving it to the front relinks it, so a packet from a known sender costs
+ * no search, copy or allocation. Entry nodes are allocated as the list
+ * grows and reused after that; past 'Capacity' entries, adding one drops
+ * the last.
+ *
+ * Keys must not change while their entry is in the list. */
+template <class Entry, size_t Capacity = 64>
+class RecentEntries {
+    struct Link {
+        Link* prev;
+        Link* next;
+    };
+
+    struct Node : Link {
+        template <typename... Args>
+        Node(Args&&... args)
+            : entry(std::forward<Args>(args)...) {
+        }
+
+        Node* bucket_next{nullptr};
+        Entry entry;
+    };
+
+   public:
+    static constexpr size_t capacity = Capacity;
+
+    using value_type = Entry;
+    using reference = Entry&;
+    using const_reference = const Entry&;
+    using size_type = size_t;
+    using Key = typename Entry::Key;
+
+    template <bool Const>
+    class Iterator {
+       public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const Entry*, Entry*>;
+        using reference = std::conditional_t<Const, const Entry&, Entry&>;
+
+        Iterator() = default;
+
+        template <bool C = Const, std::enable_if_t<C, int> = 0>
+        Iterator(const Iterator<false>& other)
+            : link_{other.link_} {
+        }
+
+        reference operator*() const { return static_cast<Node*>(link_)->entry; }
+        pointer operator->() const { return &static_cast<Node*>(link_)->entry; }
+
+        Iterator& operator++() {
+            link_ = link_->next;
+            return *this;
+        }
+        Iterator operator++(int) {
+            auto previous = *this;
+            link_ = link_->next;
+            return previous;
+        }
+        Iterator& operator--() {
+            link_ = link_->prev;
+            return *this;
+        }
+        Iterator operator--(int) {
+            auto previous = *this;
+            link_ = link_->prev;
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const { return link_ == other.link_; }
+        bool operator!=(const Iterator& other) const { return link_ != other.link_; }
+
+       private:
+        friend class RecentEntries;
+        friend class Iterator<!Const>;
+
+        Link* link_{nullptr};
+
+        explicit Iterator(Link* link)
+            : link_{link} {
+        }
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    RecentEntries() = default;
+    RecentEntries(const RecentEntries&) = delete;
+    RecentEntries& operator=(const RecentEntries&) = delete;
+
+    ~RecentEntries() {
+        clear();
+    }
+
+    iterator begin() { return iterator{head_.next}; }
+    iterator end() { return iterator{&head_}; }
+    const_iterator begin() const { return const_iterator{head_.next}; }
+    const_iterator end() const { return const_iterator{const_cast<Link*>(&head_)}; }
+    reverse_iterator rbegin() { return reverse_iterator{end()}; }
+    reverse_iterator rend() { return reverse_iterator{begin()}; }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator{end()}; }
+    const_reverse_iterator rend() const { return const_reverse_iterator{begin()}; }
+
+    Entry& front() { return *begin(); }
+    Entry& back() { return *--end(); }
+    const Entry& front() const { return *begin(); }
+    const Entry& back() const { return *--end(); }
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    iterator find(const Key& key) {
+        for (auto node = buckets_[bucket(key)]; node; node = node->bucket_next) {
+            if (node->entry.key() == key)
+                return iterator{node};
+        }
+        return end();
+    }
+
+    const_iterator find(const Key& key) const {
+        return const_cast<RecentEntries*>(this)->find(key);
+    }
+
+    template <typename... Args>
+    Entry& emplace_front(Args&&... args) {
+        if (size_ == Capacity)
+            pop_back();
+        return insert(&head_, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    Entry& emplace_back(Args&&... args) {
+        if (size_ == Capacity)
+            pop_back();
+        return insert(head_.prev, std::forward<Args>(args)...);
+    }
+
+    void move_to_front(const_iterator it) {
+        auto link = it.link_;
+        unlink(link);
+        link_after(&head_, link);
+    }
+
+    iterator erase(const_iterator it) {
+        auto node = static_cast<Node*>(it.link_);
+        auto next = node->next;
+        unlink(node);
+        unindex(node);
+        release(node);
+        size_--;
+        return iterator{next};
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        while (first != last)
+            first = erase(first);
+        return iterator{last.link_};
+    }
+
+    void pop_front() { erase(begin()); }
+    void pop_back() { erase(--end()); }
+
+    /* Frees the nodes too. */
+    void clear() {
+        while (!empty())
+            pop_back();
+        while (spare_) {
+            auto next = spare_->next;
+            ::operator delete(spare_);
+            spare_ = next;
+        }
+    }
+
+    /* Stable, and linear when already sorted: insertion sort, relinking
+     * the entries. */
+    template <typename Compare>
+    void sort(Compare less) {
+        if (size_ < 2)
+            return;
+
+        for (auto link = head_.next->next; link != &head_;) {
+            const auto next = link->next;
+            auto position = link->prev;
+            while (position != &head_ && less(static_cast<Node*>(link)->entry, static_cast<Node*>(position)->entry))
+                position = position->prev;
+            if (position != link->prev) {
+                unlink(link);
+                link_after(position, link);
+            }
+            link = next;
+        }
+    }
+
+   private:
+    // Power of two, for the mask.
+    static constexpr size_t bucket_count = (Capacity <= 16) ? 16 : (Capacity <= 32) ? 32
+                                                                  : (Capacity <= 64)  ? 64
+                                                                                      : 128;
+
+    Link head_{&head_, &head_};
+    size_t size_{0};
+    std::array<Node*, bucket_count> buckets_{};
+    Link* spare_{nullptr};  // Freed nodes, through Link::next.
+
+    static size_t bucket(const Key& key) {
+        return recent_entries_hash(key) & (bucket_count - 1);
+    }
+
+    template <typename... Args>
+    Entry& insert(Link* after, Args&&... args) {
+        void* storage;
+        if (spare_) {
+            storage = spare_;
+            spare_ = spare_->next;
+        } else {
+            storage = ::operator new(sizeof(Node));
+        }
+        auto node = new (storage) Node(std::forward<Args>(args)...);
+        link_after(after, node);
+        auto& head = buckets_[bucket(node->entry.key())];
+        node->bucket_next = head;
+        head = node;
+        size_++;
+        return node->entry;
+    }
+
+    void unindex(Node* node) {
+        auto p = &buckets_[bucket(node->entry.key())];
+        while (*p != node)
+            p = &(*p)->bucket_next;
+        *p = node->bucket_next;
+    }
+
+    void release(Node* node) {
+        node->~Node();
+        auto link = reinterpret_cast<Link*>(node);
+        link->next = spare_;
+        spare_ = link;
+    }
+
+    static void unlink(Link* link) {
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+    }
+
+    static void link_after(Link* position, Link* link) {
+        link->prev = position;
+        link->next = position->next;
+        position->next->prev = link;
+        position->next = link;
+    }
+};
 
 template <typename ContainerType, typename Key>
 typename ContainerType::const_iterator find(const ContainerType& entries, const Key key) {
@@ -49,6 +330,16 @@ typename ContainerType::iterator find(ContainerType& entries, const Key key) {
         [key](typename ContainerType::const_reference e) { return e.key() == key; });
 }
 
+template <class Entry, size_t Capacity, typename Key>
+typename RecentEntries<Entry, Capacity>::const_iterator find(const RecentEntries<Entry, Capacity>& entries, const Key key) {
+    return entries.find(key);
+}
+
+template <class Entry, size_t Capacity, typename Key>
+typename RecentEntries<Entry, Capacity>::iterator find(RecentEntries<Entry, Capacity>& entries, const Key key) {
+    return entries.find(key);
+}
+
 template <typename ContainerType>
 static void truncate_entries(ContainerType& entries, const size_t entries_max = 64) {
     while (entries.size() > entries_max) {
@@ -60,12 +351,11 @@ template <typename ContainerType, typename Key>
 typename ContainerType::reference on_packet(ContainerType& entries, const Key key) {
     auto matching_recent = find(entries, key);
     if (matching_recent != std::end(entries)) {
-        // Found within. Move to front of list, increment counter.
-        entries.push_front(*matching_recent);
-        entries.erase(matching_recent);
+        // Found within. Move to front of list.
+        entries.move_to_front(matching_recent);
     } else {
+        // Drops the last entry when full.
         entries.emplace_front(key);
-        truncate_entries(entries);
     }
 
     return entries.front();
@@ -108,9 +398,10 @@ void resetFilteredEntries(ContainerType& entries, KeySelector keySelector) {
     auto it = entries.begin();
     while (it != entries.end()) {
         if (keySelector(*it)) {
-            entries.erase(it);  // Add a new entry to filteredEntries
+            it = entries.erase(it);
+        } else {
+            ++it;
         }
-        ++it;  // Move to the next element, outside of the if block
     }
 }
 
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "recon_survey.hpp"
+
+#include <algorithm>
+
+ReconSurvey::ReconSurvey(
+    uint32_t sampling_rate,
+    uint32_t channel_width,
+    uint8_t margin_db)
+    : sampling_rate_{sampling_rate},
+      bin_width_{static_cast<uint32_t>(sampling_rate / std::tuple_size<Spectrum>::value)},
+      usable_span_{sampling_rate * 4 / 5},
+      dc_guard_{bin_width_ * 3 / 2},
+      channel_half_width_{channel_width / 2},
+      margin_(margin_db * 5) {  // ChannelSpectrum: 5 steps per dB.
+}
+
+void ReconSurvey::set_channels(std::vector<Channel> channels) {
+    std::sort(channels.begin(), channels.end(), [](const Channel& a, const Channel& b) {
+        return a.frequency < b.frequency;
+    });
+    channels_ = std::move(channels);
+    windows_.clear();
+    centers_.clear();
+
+    size_t first = 0;
+    while (first < channels_.size()) {
+        size_t count = 1;
+        while (first + count < channels_.size() &&
+               channels_[first + count].frequency - channels_[first].frequency <= usable_span_)
+            count++;
+
+        // Always succeeds for a single channel.
+        rf::Frequency center = 0;
+        while (!find_center(first, count, center))
+            count--;
+
+        windows_.push_back({center, first, count});
+        centers_.push_back(center);
+        first += count;
+    }
+}
+
+int32_t ReconSurvey::window_at(rf::Frequency center) const {
+    const auto it = std::lower_bound(centers_.begin(), centers_.end(), center);
+    if (it == centers_.end() || *it != center)
+        return -1;
+    return it - centers_.begin();
+}
+
+bool ReconSurvey::clear_of_dc(rf::Frequency center, size_t first, size_t count) const {
+    const auto begin = channels_.begin() + first;
+    const auto end = begin + count;
+    const auto nearest = std::upper_bound(begin, end, center - dc_guard_, [](rf::Frequency f, const Channel& c) {
+        return f < c.frequency;
+    });
+    return nearest == end || nearest->frequency >= center + dc_guard_;
+}
+
+/* Any center within half the usable span of both ends works. Tries the
+ * middle of that range first, then the middle of every gap between
+ * channels, keeping the one closest to the middle. */
+bool ReconSurvey::find_center(size_t first, size_t count, rf::Frequency& center) const {
+    const auto low = channels_[first].frequency;
+    const auto high = channels_[first + count - 1].frequency;
+    const auto min_center = high - usable_span_ / 2;
+    const auto max_center = low + usable_span_ / 2;
+    const auto middle = (low + high) / 2;
+
+    auto best_distance = usable_span_;
+    auto consider = [&](rf::Frequency candidate) {
+        candidate = std::clamp(candidate, min_center, max_center);
+        const auto distance = candidate > middle ? candidate - middle : middle - candidate;
+        if (distance < best_distance && clear_of_dc(candidate, first, count)) {
+            best_distance = distance;
+            center = candidate;
+        }
+    };
+
+    consider(middle);
+    consider(min_center);
+    consider(max_center);
+    for (size_t i = first + 1; i < first + count; i++)
+        consider((channels_[i - 1].frequency + channels_[i].frequency) / 2);
+
+    return best_distance < usable_span_;
+}
+
+/* Bins 0-127 hold the positive offsets, 128-255 the negative ones. */
+size_t ReconSurvey::bin_index(rf::Frequency offset) const {
+    const int32_t bin = (offset + (offset < 0 ? -int32_t(bin_width_ / 2) : int32_t(bin_width_ / 2))) / int32_t(bin_width_);
+    return bin & (std::tuple_size<Spectrum>::value - 1);
+}
+
+void ReconSurvey::find_hits(size_t window, const Spectrum& db, std::vector<size_t>& hits) const {
+    if (window >= windows_.size())
+        return;
+
+    Spectrum sorted = db;
+    std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+    const int32_t threshold = sorted[sorted.size() / 2] + margin_;
+
+    const auto& w = windows_[window];
+    for (size_t i = w.first; i < w.first + w.count; i++) {
+        const auto offset = channels_[i].frequency - w.center;
+        const auto first_bin = bin_index(offset - channel_half_width_);
+        const auto last_bin = bin_index(offset + channel_half_width_);
+
+        uint8_t peak = 0;
+        for (size_t bin = first_bin;; bin = (bin + 1) & (db.size() - 1)) {
+            peak = std::max(peak, db[bin]);
+            if (bin == last_bin) break;
+        }
+
+        if (peak > threshold)
+            hits.push_back(channels_[i].index);
+    }
+}
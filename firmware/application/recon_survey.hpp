@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __RECON_SURVEY_H__
+#define __RECON_SURVEY_H__
+
+#include "rf_path.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* Groups the channels of a Recon list into receiver windows so one
+ * wideband spectrum per window tells which channels are worth the
+ * per-channel squelch check.
+ *
+ * Each window keeps its channels inside the flat part of the baseband
+ * filter and away from the DC spike. A channel is a hit when the peak of
+ * the bins it covers stands out of the window's noise floor (median bin)
+ * by 'margin_db'; the noise floor makes this independent of the gain
+ * settings, and false hits only cost a squelch check. */
+class ReconSurvey {
+   public:
+    using Spectrum = std::array<uint8_t, 256>;
+
+    static constexpr uint32_t default_sampling_rate = 4'000'000;
+    static constexpr uint32_t default_baseband_bandwidth = 3'500'000;
+
+    struct Channel {
+        size_t index;  // In the frequency list.
+        rf::Frequency frequency;
+    };
+
+    struct Window {
+        rf::Frequency center;
+        size_t first;  // Into channels().
+        size_t count;
+    };
+
+    ReconSurvey(
+        uint32_t sampling_rate = default_sampling_rate,
+        uint32_t channel_width = 12'500,
+        uint8_t margin_db = 8);
+
+    /* Sorts the channels by frequency and groups them into windows. */
+    void set_channels(std::vector<Channel> channels);
+
+    uint32_t sampling_rate() const { return sampling_rate_; }
+    const std::vector<Channel>& channels() const { return channels_; }
+    const std::vector<Window>& windows() const { return windows_; }
+
+    /* Center frequencies of the windows, ascending. */
+    const std::vector<rf::Frequency>& centers() const { return centers_; }
+
+    /* Window tuned to 'center', or -1. */
+    int32_t window_at(rf::Frequency center) const;
+
+    /* Appends the list index of every channel of the window that stands out. */
+    void find_hits(size_t window, const Spectrum& db, std::vector<size_t>& hits) const;
+
+   private:
+    uint32_t sampling_rate_;
+    uint32_t bin_width_;
+    rf::Frequency usable_span_;
+    rf::Frequency dc_guard_;
+    rf::Frequency channel_half_width_;
+    uint8_t margin_;
+
+    std::vector<Channel> channels_{};
+    std::vector<Window> windows_{};
+    std::vector<rf::Frequency> centers_{};
+
+    bool clear_of_dc(rf::Frequency center, size_t first, size_t count) const;
+    bool find_center(size_t first, size_t count, rf::Frequency& center) const;
+    size_t bin_index(rf::Frequency offset) const;
+};
+
+#endif /*__RECON_SURVEY_H__*/
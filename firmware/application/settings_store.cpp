@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "settings_store.hpp"
+
+#include <cstring>
+
+namespace settings_store {
+
+uint32_t hash(const void* data, size_t size) {
+    const auto* const p = static_cast<const uint8_t*>(data);
+    uint32_t h = 2166136261;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 16777619;
+    }
+    return h;
+}
+
+Block::Block(std::string_view app_name) {
+    const auto length = std::min(app_name.size(), max_length);
+    bytes_.reserve(256);
+    bytes_.push_back(length);
+    bytes_.insert(bytes_.end(), app_name.begin(), app_name.begin() + length);
+}
+
+void Block::add(std::string_view name, uint8_t type, const void* value, size_t size) {
+    const uint32_t name_hash = hash(name);
+    const auto name_length = std::min(name.size(), max_length);
+    const auto value_length = std::min(size, max_length);
+    const auto* const v = static_cast<const uint8_t*>(value);
+
+    for (size_t i = 0; i < 4; i++)
+        bytes_.push_back(name_hash >> (i * 8));
+    bytes_.push_back(type);
+    bytes_.push_back(name_length);
+    bytes_.push_back(value_length);
+    bytes_.insert(bytes_.end(), name.begin(), name.begin() + name_length);
+    bytes_.insert(bytes_.end(), v, v + value_length);
+}
+
+std::string_view Block::app_name() const {
+    if (bytes_.empty() || bytes_[0] >= bytes_.size())
+        return {};
+    return {reinterpret_cast<const char*>(&bytes_[1]), bytes_[0]};
+}
+
+bool Block::record_at(size_t& offset, Record& record) const {
+    constexpr size_t fixed_size = 7;
+    if (offset + fixed_size > bytes_.size())
+        return false;
+
+    const auto* const p = &bytes_[offset];
+    const size_t name_length = p[5];
+    const size_t value_length = p[6];
+    if (offset + fixed_size + name_length + value_length > bytes_.size())
+        return false;
+
+    record.name_hash = p[0] | (p[1] << 8) | (p[2] << 16) | (uint32_t(p[3]) << 24);
+    record.type = p[4];
+    record.name = {reinterpret_cast<const char*>(p + fixed_size), name_length};
+    record.value = {reinterpret_cast<const char*>(p + fixed_size + name_length), value_length};
+    offset += fixed_size + name_length + value_length;
+    return true;
+}
+
+}  // namespace settings_store
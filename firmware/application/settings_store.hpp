@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __SETTINGS_STORE_H__
+#define __SETTINGS_STORE_H__
+
+#include "file.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/* Binary store for the app settings: one file for every app, so opening
+ * an app reads one small block rather than parsing an INI file. */
+namespace settings_store {
+
+/* FNV-1a. Apps and settings are looked up by the hash of their name. */
+uint32_t hash(const void* data, size_t size);
+inline uint32_t hash(std::string_view name) {
+    return hash(name.data(), name.size());
+}
+
+/* The settings of one app: the app's name, then per setting
+ *   u32 name hash, u8 type, u8 name length, u8 value length, name, value.
+ * Lookups go by hash; the names are kept for exporting to INI. */
+class Block {
+   public:
+    struct Record {
+        uint32_t name_hash;
+        uint8_t type;
+        std::string_view name;
+        std::string_view value;
+    };
+
+    static constexpr size_t max_size = 0xffff;
+    static constexpr size_t max_length = 0xff;
+
+    Block() = default;
+    explicit Block(std::string_view app_name);
+
+    /* Names and values past max_length are cut short. */
+    void add(std::string_view name, uint8_t type, const void* value, size_t size);
+
+    std::string_view app_name() const;
+
+    /* Calls on_record(const Record&) for every record, in order. False
+     * if the block is cut short or malformed. */
+    template <typename RecordHandler>
+    bool for_each(RecordHandler on_record) const {
+        size_t offset = app_name().size() + 1;
+        Record record{};
+        while (offset < bytes_.size()) {
+            if (!record_at(offset, record))
+                return false;
+            on_record(record);
+        }
+        return !bytes_.empty();
+    }
+
+    std::vector<uint8_t>& bytes() { return bytes_; }
+    const std::vector<uint8_t>& bytes() const { return bytes_; }
+
+   private:
+    std::vector<uint8_t> bytes_{};
+
+    bool record_at(size_t& offset, Record& record) const;
+};
+
+/* Where the blocks are in the store file:
+ *   header: u32 magic, u32 version, u32 slot count
+ *   slot_capacity slots: u32 app hash, u32 offset, u16 capacity, u16 length
+ *   the blocks, each in a region of its slot's capacity.
+ * A block is rewritten in place if it fits its region, moved to a new one
+ * at the end of the file if not. The slots are read once and kept.
+ *
+ * TFile needs the File members seek(), read(), write() and size(). */
+template <typename TFile>
+class Index {
+   public:
+    struct Slot {
+        uint32_t app_hash;
+        uint32_t offset;
+        uint16_t capacity;
+        uint16_t length;
+    };
+    static_assert(sizeof(Slot) == 12);
+
+    static constexpr uint32_t magic = 0x53415050;  // "PPAS"
+    static constexpr uint32_t version = 1;
+    static constexpr size_t slot_capacity = 128;
+    static constexpr size_t header_size = 3 * sizeof(uint32_t);
+    static constexpr size_t data_offset = header_size + slot_capacity * sizeof(Slot);
+
+    /* An empty file is an empty store; false for anything else that
+     * isn't a store. */
+    bool load(TFile& file) {
+        slots_.clear();
+        end_ = data_offset;
+        if (file.size() == 0)
+            return true;
+
+        uint32_t header[3]{};
+        if (!read_at(file, 0, header, sizeof(header)) ||
+            header[0] != magic || header[1] != version || header[2] > slot_capacity)
+            return false;
+
+        slots_.resize(header[2]);
+        if (!read_at(file, header_size, slots_.data(), slots_.size() * sizeof(Slot))) {
+            slots_.clear();
+            return false;
+        }
+        for (const auto& slot : slots_)
+            end_ = std::max<uint32_t>(end_, slot.offset + slot.capacity);
+        return true;
+    }
+
+    bool read(TFile& file, uint32_t app_hash, Block& block) const {
+        const auto slot = find(app_hash);
+        if (slot == slots_.end())
+            return false;
+
+        block.bytes().resize(slot->length);
+        return read_at(file, slot->offset, block.bytes().data(), slot->length);
+    }
+
+    /* False if the file can't be written, or there's no slot left for a
+     * new app. */
+    bool write(TFile& file, uint32_t app_hash, const Block& block) {
+        const auto& bytes = block.bytes();
+        if (bytes.size() > Block::max_size)
+            return false;
+
+        auto slot = find(app_hash);
+        const bool added = (slot == slots_.end());
+        if (added && slots_.size() == slot_capacity)
+            return false;
+
+        if (!added && bytes.size() <= slot->capacity) {
+            if (!write_at(file, slot->offset, bytes.data(), bytes.size()))
+                return false;
+            slot->length = bytes.size();
+            return write_slot(file, slot - slots_.begin());
+        }
+
+        if (slots_.empty() && file.size() < data_offset && !write_empty(file))
+            return false;
+
+        // Room to grow before it has to move again.
+        const size_t capacity = std::min<size_t>((bytes.size() * 5 / 4 + 31) & ~size_t(31), Block::max_size);
+        if (!write_at(file, end_, bytes.data(), bytes.size()))
+            return false;
+
+        // The old region stays valid until the slot points past it.
+        const Slot moved{app_hash, end_, uint16_t(capacity), uint16_t(bytes.size())};
+        end_ += capacity;
+        if (added) {
+            slots_.push_back(moved);
+            const uint32_t count = slots_.size();
+            return write_slot(file, slots_.size() - 1) &&
+                   write_at(file, 2 * sizeof(uint32_t), &count, sizeof(count));
+        }
+        *slot = moved;
+        return write_slot(file, slot - slots_.begin());
+    }
+
+    /* The last slot takes the removed one's place. Its region is left
+     * unused. */
+    bool remove(TFile& file, uint32_t app_hash) {
+        const auto slot = find(app_hash);
+        if (slot == slots_.end())
+            return true;
+
+        const size_t index = slot - slots_.begin();
+        slots_[index] = slots_.back();
+        slots_.pop_back();
+        const uint32_t count = slots_.size();
+        return (index == count || write_slot(file, index)) &&
+               write_at(file, 2 * sizeof(uint32_t), &count, sizeof(count));
+    }
+
+    const std::vector<Slot>& slots() const { return slots_; }
+
+   private:
+    std::vector<Slot> slots_{};
+    uint32_t end_{data_offset};
+
+    typename std::vector<Slot>::const_iterator find(uint32_t app_hash) const {
+        return std::find_if(slots_.begin(), slots_.end(), [app_hash](const Slot& slot) {
+            return slot.app_hash == app_hash;
+        });
+    }
+
+    typename std::vector<Slot>::iterator find(uint32_t app_hash) {
+        return std::find_if(slots_.begin(), slots_.end(), [app_hash](const Slot& slot) {
+            return slot.app_hash == app_hash;
+        });
+    }
+
+    bool write_empty(TFile& file) {
+        const uint32_t header[3]{magic, version, 0};
+        const Slot empty{};
+        if (!write_at(file, 0, header, sizeof(header)))
+            return false;
+        for (size_t i = 0; i < slot_capacity; i++) {
+            if (file.write(&empty, sizeof(empty)).is_error())
+                return false;
+        }
+        return true;
+    }
+
+    bool write_slot(TFile& file, size_t index) {
+        return write_at(file, header_size + index * sizeof(Slot), &slots_[index], sizeof(Slot));
+    }
+
+    static bool read_at(TFile& file, uint32_t offset, void* data, size_t size) {
+        if (file.seek(offset).is_error())
+            return false;
+        const auto result = file.read(data, size);
+        return result.is_ok() && *result == size;
+    }
+
+    static bool write_at(TFile& file, uint32_t offset, const void* data, size_t size) {
+        return file.seek(offset).is_ok() && file.write(data, size).is_ok();
+    }
+};
+
+}  // namespace settings_store
+
+#endif /*__SETTINGS_STORE_H__*/
@@ -107,13 +107,20 @@ std::string tone_key_value_string(tone_index index) {
 }
 
 // Return variable-length string showing CTCSS tone from tone frequency
-// Value is in 0.01 Hz units
+// Value is in 0.01 Hz units, 0 for no tone
 std::string tone_key_string_by_value(uint32_t value, size_t max_length) {
     static uint8_t tone_display_toggle{0};
     static uint32_t last_value;
     tone_index idx;
     std::string freq_str;
 
+    // 0 = tone lost
+    if (value == 0) {
+        last_value = 0;
+        tone_display_toggle = 0;
+        return "        ";
+    }
+
     // If >10Hz difference between consecutive samples, it's probably noise, so ignore
     if (abs(value - last_value) > 10 * 100) {
         last_value = value;
@@ -77,4 +77,22 @@ Config create(const rf::Frequency target_frequency) {
 }
 
 } /* namespace config */
+
+Hop Hop::create(const rf::Frequency target_frequency) {
+    const auto config = config::create(target_frequency);
+    if (!config.is_valid()) {
+        return {};
+    }
+
+    Hop hop{};
+    hop.first_lo_frequency = config.first_lo_frequency;
+    if (config.first_lo_frequency) {
+        hop.first_lo = rffc507x::SynthConfig::calculate(config.first_lo_frequency);
+    }
+    hop.second_lo = max283x::lo::SynthConfig::calculate(config.second_lo_frequency);
+    hop.rf_path_band = config.rf_path_band;
+    hop.mixer_invert = config.mixer_invert;
+    return hop;
+}
+
 } /* namespace tuning */
@@ -24,6 +24,9 @@
 
 #include "rf_path.hpp"
 
+#include "rffc507x.hpp"
+#include "max283x.hpp"
+
 namespace tuning {
 namespace config {
 
@@ -60,6 +63,24 @@ struct Config {
 Config create(const rf::Frequency target_frequency);
 
 } /* namespace config */
+
+/* A tuning config with the synthesizer settings of both LOs worked out.
+ * Retuning to a Hop is only register writes, so frequency lists that are
+ * tuned over and over (scanners, sweeps, hoppers) should be compiled to
+ * Hops once. See radio::compile_tuning() and radio::set_tuning(). */
+struct Hop {
+    rf::Frequency first_lo_frequency{0};
+    rffc507x::SynthConfig first_lo{};
+    max283x::lo::SynthConfig second_lo{};
+    rf::path::Band rf_path_band{rf::path::Band::Mid};
+    bool mixer_invert{false};
+
+    bool is_valid() const {
+        return second_lo.is_valid();
+    }
+
+    static Hop create(const rf::Frequency target_frequency);
+};
 } /* namespace tuning */
 
 #endif /*__TUNING_H__*/
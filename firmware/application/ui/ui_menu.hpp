@@ -61,6 +61,7 @@ class MenuItemView : public Widget {
     MenuItemView& operator=(MenuItemView&&) = delete;
 
     void paint(Painter& painter) override;
+    bool opaque() const override { return item != nullptr; }
 
     void set_item(MenuItem* item_);
 
@@ -27,8 +27,12 @@ using namespace portapack;
 
 #include "baseband_api.hpp"
 
+#include "file_path.hpp"
 #include "string_format.hpp"
 
+#include "ch.h"
+
+#include <algorithm>
 #include <cmath>
 #include <array>
 
@@ -263,6 +267,17 @@ void WaterfallWidget::on_show() {
     display.scroll_set_area(screen_r.top(), screen_r.bottom());
 
     clear();
+
+    if (!history || history->width() != screen_width) {
+        const size_t wanted = history_rows * screen_width / 2;
+        const size_t free = chCoreStatus();
+        const size_t spare = (free > history_reserve) ? free - history_reserve : 0;
+        const size_t history_size = std::max(min_history_size, std::min(wanted, spare));
+        history = std::make_unique<WaterfallHistory>(screen_width, history_size);
+        pixel_row.resize(screen_width);
+    }
+    history->clear();
+    history_offset = 0;
 }
 
 void WaterfallWidget::on_hide() {
@@ -271,25 +286,58 @@ void WaterfallWidget::on_hide() {
      */
     display.scroll_disable();
     clear();
+    history.reset();
+    pixel_row = {};
 }
 
 void WaterfallWidget::on_channel_spectrum(
     const ChannelSpectrum& spectrum) {
-    /* TODO: static_assert that message.spectrum.db.size() >= pixel_row.size() */
-    std::vector<Color> pixel_row(screen_width);
-    for (size_t i = 0; i < screen_width / 2; i++) {
-        const auto pixel_color = gradient.lut[spectrum.db[256 - screen_width / 2 + i]];
-        pixel_row[i] = pixel_color;
+    if (!history)
+        return;
+
+    history->push(spectrum.db);
+    if (history_offset > 0) {
+        // Stay on the same rows.
+        history_offset = std::min(history_offset + 1, history->size() - 1);
+        return;
     }
 
-    for (size_t i = screen_width / 2; i < screen_width; i++) {
-        const auto pixel_color = gradient.lut[spectrum.db[i - screen_width / 2]];
-        pixel_row[i] = pixel_color;
+    WaterfallHistory::Row row{};
+    history->row(0, row);
+    draw_row(row, display.scroll(1));
+}
+
+void WaterfallWidget::scroll_history(int32_t rows) {
+    if (!history || history->size() == 0)
+        return;
+
+    const int32_t offset = history_offset + rows;
+    history_offset = std::clamp<int32_t>(offset, 0, history->size() - 1);
+    redraw();
+}
+
+void WaterfallWidget::redraw() {
+    if (!history)
+        return;
+
+    WaterfallHistory::Row row{};
+    for (Coord y = 0; y < screen_rect().height(); y++) {
+        if (!history->row(history_offset + y, row))
+            row.fill(0);
+        draw_row(row, display.scroll_area_y(y));
     }
-    const auto draw_y = display.scroll(1);
-    display.draw_pixels(
-        {{0, draw_y}, {(int)pixel_row.size(), 1}},
-        pixel_row);
+}
+
+Optional<File::Error> WaterfallWidget::save_history(const std::filesystem::path& path) const {
+    if (!history)
+        return File::Error{FR_NO_FILE};
+    return history->write_pgm(path);
+}
+
+void WaterfallWidget::draw_row(const WaterfallHistory::Row& row, Coord y) {
+    for (size_t i = 0; i < pixel_row.size(); i++)
+        pixel_row[i] = gradient.lut[row[i]];
+    display.draw_pixels({{0, y}, {(int)pixel_row.size(), 1}}, pixel_row);
 }
 
 bool WaterfallWidget::on_touch(const TouchEvent event) {
@@ -301,6 +349,27 @@ bool WaterfallWidget::on_touch(const TouchEvent event) {
     return true;
 }
 
+bool WaterfallWidget::on_encoder(const EncoderEvent delta) {
+    // Turning left goes back in time.
+    scroll_history(-delta);
+    return true;
+}
+
+bool WaterfallWidget::on_key(const KeyEvent key) {
+    if (key == KeyEvent::Select && on_save) {
+        on_save();
+        return true;
+    }
+    return false;
+}
+
+void WaterfallWidget::on_blur() {
+    Widget::on_blur();
+    // Back to the live rows.
+    if (showing_history())
+        scroll_history(-history_offset);
+}
+
 void WaterfallWidget::clear() {
     display.fill_rectangle(
         screen_rect(),
@@ -309,11 +378,12 @@ void WaterfallWidget::clear() {
 
 /* WaterfallView *******************************************************/
 
-WaterfallView::WaterfallView(const bool cursor) {
+WaterfallView::WaterfallView(const bool cursor, const bool browse_history) {
     add_children({&waterfall_widget,
                   &frequency_scale});
 
     frequency_scale.set_focusable(cursor);
+    waterfall_widget.set_focusable(browse_history);
 
     // Making the event climb up all the way up to here kinda sucks
     frequency_scale.on_select = [this](int32_t offset) {
@@ -332,6 +402,17 @@ WaterfallView::WaterfallView(const bool cursor) {
         }
     };
 
+    waterfall_widget.on_save = [this]() {
+        ensure_directory(waterfalls_dir);
+        const auto path = next_filename_matching_pattern(waterfalls_dir / u"WFH_????.PGM");
+        if (path.empty())
+            return;
+
+        const auto error = waterfall_widget.save_history(path);
+        if (on_history_saved)
+            on_history_saved(path, error);
+    };
+
     if (!waterfall_widget.gradient.load_file(default_gradient_file)) {
         waterfall_widget.gradient.set_default();
     }
@@ -26,6 +26,7 @@
 #include "ui.hpp"
 #include "ui_widget.hpp"
 #include "gradient.hpp"
+#include "waterfall_history.hpp"
 
 #include "event_m0.hpp"
 
@@ -33,6 +34,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <memory>
 
 namespace ui {
 namespace spectrum {
@@ -112,25 +114,56 @@ class FrequencyScale : public Widget {
 class WaterfallWidget : public Widget {
    public:
     std::function<void(int32_t offset, int32_t y)> on_touch_select{};
+    std::function<void()> on_save{};
 
     Gradient gradient{};
 
     void on_show() override;
     void on_hide() override;
+    void on_blur() override;
     void paint(Painter&) override {}
     bool on_touch(const TouchEvent event) override;
+    /* While focused, the encoder scrolls through the history and select
+     * saves it. */
+    bool on_encoder(const EncoderEvent delta) override;
+    bool on_key(const KeyEvent key) override;
 
     void on_channel_spectrum(const ChannelSpectrum& spectrum);
 
+    /* Shows the rows 'rows' further back in the history (negative: more
+     * recent). Live rows are not drawn until back at the newest. */
+    void scroll_history(int32_t rows);
+    bool showing_history() const { return history_offset > 0; }
+
+    /* Draws the rows again, e.g. after changing the gradient. */
+    void redraw();
+
+    Optional<File::Error> save_history(const std::filesystem::path& path) const;
+
    private:
+    /* Allocated while shown, for history_rows noise floor rows (width / 2
+     * bytes each) as far as the free M0 RAM goes, leaving history_reserve
+     * to the app for what it allocates later. */
+    static constexpr size_t history_rows = 256;
+    static constexpr size_t history_reserve = 16 * 1024;
+    static constexpr size_t min_history_size = 4096;
+    std::unique_ptr<WaterfallHistory> history{};
+    size_t history_offset{0};
+
+    std::vector<Color> pixel_row{};
+
     void clear();
+    void draw_row(const WaterfallHistory::Row& row, Coord y);
 };
 
 class WaterfallView : public View {
    public:
     std::function<void(int32_t offset)> on_select{};
+    std::function<void(const std::filesystem::path& path, Optional<File::Error> error)> on_history_saved{};
 
-    WaterfallView(const bool cursor = false);
+    /* With 'browse_history', the waterfall takes the focus to scroll
+     * through its history and save it, see on_history_saved. */
+    WaterfallView(const bool cursor = false, const bool browse_history = false);
 
     WaterfallView(const WaterfallView&) = delete;
     WaterfallView(WaterfallView&&) = delete;
@@ -1,12 +1,188 @@
 #include "ui_external_items_menu_loader.hpp"
 
+#include "core_control.hpp"
 #include "sd_card.hpp"
 #include "file_path.hpp"
+#include "image_blocks.hpp"
+#include "lz4.h"
 #include "ui_standalone_view.hpp"
 
 #include "i2cdevmanager.hpp"
 #include "i2cdev_ppmod.hpp"
 
+#include <algorithm>
+#include <array>
+#include <memory>
+
+namespace {
+
+/* Must match external_app_block_size in tools/image_blocks.py. */
+constexpr size_t m4_image_block_size = 2048;
+
+struct M4ImageBlock {
+    uint32_t header;
+    size_t size;  // Of the data.
+    // The data, then the next block's header.
+    std::array<uint8_t, m4_image_block_size + 8> data;
+};
+
+bool read_block(File& app, M4ImageBlock& block, const bool last) {
+    const size_t length = block.size + (last ? 0 : sizeof(block.header));
+    const auto result = app.read(block.data.data(), length);
+    return result && result.value() == length;
+}
+
+/* Reads image blocks on a thread above the UI's priority. While the SD
+ * driver sleeps on a transfer, the UI thread gets the CPU to unpack the
+ * block before. Reads in the caller's thread when there's no heap for one. */
+class M4ImageReader {
+   public:
+    M4ImageReader(File& app)
+        : app_{app} {
+        chSemInit(&request_, 0);
+        chSemInit(&done_, 0);
+        thread_ = chThdCreateFromHeap(NULL, 1024, NORMALPRIO + 10, M4ImageReader::static_fn, this);
+    }
+
+    ~M4ImageReader() {
+        if (thread_) {
+            chThdTerminate(thread_);
+            chSemSignal(&request_);
+            chThdWait(thread_);
+        }
+    }
+
+    M4ImageReader(const M4ImageReader&) = delete;
+    M4ImageReader& operator=(const M4ImageReader&) = delete;
+
+    void start(M4ImageBlock& block, const bool last) {
+        block_ = &block;
+        last_ = last;
+        if (thread_)
+            chSemSignal(&request_);
+        else
+            read();
+    }
+
+    bool wait() {
+        if (thread_)
+            chSemWait(&done_);
+        return ok_;
+    }
+
+    /* Counter ticks spent in reads. */
+    uint32_t busy() const {
+        return busy_;
+    }
+
+   private:
+    File& app_;
+    M4ImageBlock* block_{nullptr};
+    bool last_{false};
+    bool ok_{false};
+    uint32_t busy_{0};
+    Semaphore request_;
+    Semaphore done_;
+    Thread* thread_{nullptr};
+
+    void read() {
+        const auto start = halGetCounterValue();
+        ok_ = read_block(app_, *block_, last_);
+        busy_ += halGetCounterValue() - start;
+    }
+
+    static msg_t static_fn(void* arg) {
+        auto obj = static_cast<M4ImageReader*>(arg);
+        while (true) {
+            chSemWait(&obj->request_);
+            if (chThdShouldTerminate())
+                break;
+            obj->read();
+            chSemSignal(&obj->done_);
+        }
+        return 0;
+    }
+};
+
+uint32_t ticks_to_us(const uint32_t ticks) {
+    return uint64_t(ticks) * 1000000U / halGetCounterFrequency();
+}
+
+/* Unpacks an external app's baseband image, an image_blocks stream at the
+ * current position of 'app', into M4 code RAM below 'limit', where the app
+ * itself was loaded. Reads the next block while one unpacks. Adds the words
+ * of the stream to 'checksum'. */
+bool unpack_m4_image(File& app, const uint8_t* const limit, uint32_t& checksum) {
+    const auto start = halGetCounterValue();
+
+    struct {
+        image_blocks::Header header;
+        uint32_t block_header;
+    } head;
+    const auto result = app.read(&head, sizeof(head));
+    if (!result || result.value() != sizeof(head))
+        return false;
+    checksum += simple_checksum((uint32_t)&head, sizeof(head));
+
+    const auto& m4_code = portapack::memory::map::m4_code;
+    const auto limit_address = reinterpret_cast<uintptr_t>(limit);
+    const size_t capacity = (limit_address > m4_code.base()) ? std::min<size_t>(limit_address - m4_code.base(), m4_code.size()) : 0;
+    image_blocks::Unpacker unpacker{reinterpret_cast<void*>(m4_code.base()), capacity, unlz4_len};
+    if (head.header.block_size > m4_image_block_size || !unpacker.begin(head.header) || !unpacker.block_count())
+        return false;
+
+    const size_t count = unpacker.block_count();
+    auto blocks = std::make_unique<std::array<M4ImageBlock, 2>>();
+    M4ImageReader reader{app};
+    uint32_t unpack_ticks = 0;
+
+    auto* block = &(*blocks)[0];
+    block->header = head.block_header;
+    block->size = unpacker.data_size(block->header, 0);
+    if (!block->size)
+        return false;
+    reader.start(*block, count == 1);
+    if (!reader.wait())
+        return false;
+
+    for (size_t index = 0; index < count; index++) {
+        block = &(*blocks)[index & 1];
+        const bool reading = index + 1 < count;
+        if (reading) {
+            auto& next = (*blocks)[(index + 1) & 1];
+            memcpy(&next.header, &block->data[block->size], sizeof(next.header));
+            next.size = unpacker.data_size(next.header, index + 1);
+            if (!next.size)
+                return false;
+            reader.start(next, index + 2 == count);
+        }
+
+        const auto unpack_start = halGetCounterValue();
+        const bool unpacked = unpacker.block(block->header, block->data.data());
+        checksum += simple_checksum((uint32_t)block->data.data(), block->size + (reading ? sizeof(block->header) : 0));
+        unpack_ticks += halGetCounterValue() - unpack_start;
+        if (reading && !reader.wait())
+            return false;
+        if (!unpacked)
+            return false;
+    }
+
+    if (!unpacker.verified())
+        return false;
+
+    const uint32_t elapsed = halGetCounterValue() - start;
+    const uint32_t serial = reader.busy() + unpack_ticks;
+    auto& stats = m4_image_stats();
+    stats.last_load_bytes = unpacker.unpacked_size();
+    stats.last_load_us = ticks_to_us(elapsed);
+    stats.last_read_us = ticks_to_us(reader.busy());
+    stats.last_unpack_us = ticks_to_us(unpack_ticks);
+    stats.last_overlap_us = ticks_to_us(serial > elapsed ? serial - elapsed : 0);
+    return true;
+}
+
+}  // namespace
+
 namespace ui {
 
 /* static */ std::vector<DynamicBitmap<16, 16>> ExternalItemsMenuLoader::bitmaps;
@@ -309,28 +485,16 @@ namespace ui {
                 break;
         }
 
-        // copy baseband image
-        for (size_t file_read_index = application_information.m4_app_offset;; file_read_index += readResult.value()) {
-            size_t bytes_to_read = std::filesystem::max_file_block_size;
-
-            // not aligned
-            if ((file_read_index % std::filesystem::max_file_block_size) != 0)
-                bytes_to_read = std::filesystem::max_file_block_size - (file_read_index % std::filesystem::max_file_block_size);
-
-            if (bytes_to_read == 0)
-                break;
-
-            auto target_memory = reinterpret_cast<void*>(portapack::memory::map::m4_code.base() + file_read_index - application_information.m4_app_offset);
-
-            readResult = app.read(target_memory, bytes_to_read);
-            if (!readResult)
-                return false;
-
-            checksum += simple_checksum((uint32_t)target_memory, readResult.value());
+        // unpack baseband image, then the checksum word that follows it
+        m4_image_invalidate();
+        if (!unpack_m4_image(app, application_information.memory_location, checksum))
+            return false;
 
-            if (readResult.value() != bytes_to_read)
-                break;
-        }
+        uint32_t checksum_word{0};
+        readResult = app.read(&checksum_word, sizeof(checksum_word));
+        if (!readResult || readResult.value() != sizeof(checksum_word))
+            return false;
+        checksum += checksum_word;
     } else {
         // copy application image
         for (size_t file_read_index = 0; file_read_index < 80 * std::filesystem::max_file_block_size; file_read_index += std::filesystem::max_file_block_size) {
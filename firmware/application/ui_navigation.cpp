@@ -242,7 +242,7 @@ SystemStatusView::SystemStatusView(
 
     button_back.on_select = [this](ImageButton&) {
         if (pmem::should_use_sdcard_for_pmem()) {
-            pmem::save_persistent_settings_to_file();
+            pmem::save_persistent_settings_to_file_later();
         }
         if (this->on_back)
             this->on_back();
@@ -46,12 +46,14 @@
 #include "untar.hpp"
 #include "ui_widget.hpp"
 #include "file_path.hpp"
+#include "app_settings.hpp"
 
 #include "ui_navigation.hpp"
 #include "usb_serial_shell_filesystem.hpp"
 
 #include "portapack_persistent_memory.hpp"
 
+#include <algorithm>
 #include <string>
 #include <cstring>
 #include <libopencm3/lpc43xx/wwdt.h>
@@ -1183,6 +1185,15 @@ static void cmd_sysinfo(BaseSequentialStream* chp, int argc, char* argv[]) {
         "M4 stack: " + to_string_dec_uint(shared_memory.m4_stack_usage) + "\r\n" +
         "M0 cpu%: " + to_string_dec_uint(shared_memory.m4_performance_counter) + "\r\n" +
         "M4 miss: " + to_string_dec_uint(shared_memory.m4_buffer_missed) + "\r\n" +
+        "M4 images unpacked: " + to_string_dec_uint(m4_image_stats().unpacked) + "\r\n" +
+        "M4 images reused: " + to_string_dec_uint(m4_image_stats().reused) + "\r\n" +
+        "M4 last load us: " + to_string_dec_uint(m4_image_stats().last_load_us) + "\r\n" +
+        "M4 last load bytes: " + to_string_dec_uint(m4_image_stats().last_load_bytes) + "\r\n" +
+        "M4 unpack kB/s: " + to_string_dec_uint(uint64_t(m4_image_stats().last_load_bytes) * 1000 / std::max<uint32_t>(m4_image_stats().last_load_us, 1)) + "\r\n" +
+        "M4 last read us: " + to_string_dec_uint(m4_image_stats().last_read_us) + "\r\n" +
+        "M4 last unpack us: " + to_string_dec_uint(m4_image_stats().last_unpack_us) + "\r\n" +
+        "M4 last read/unpack overlap us: " + to_string_dec_uint(m4_image_stats().last_overlap_us) + "\r\n" +
+        "M4 last start us: " + to_string_dec_uint(m4_image_stats().last_start_us) + "\r\n" +
         "uptime: " + to_string_dec_uint(chTimeNow() / 1000) + "\r\n";
 
     fillOBuffer(&((SerialUSBDriver*)chp)->oqueue, (const uint8_t*)info.c_str(), info.length());
@@ -1258,12 +1269,33 @@ static void cmd_settingsreset(BaseSequentialStream* chp, int argc, char* argv[])
             f_unlink(pth.tchar());
         }
     }
+    // With the INI files gone, this leaves every app on its defaults.
+    import_settings_from_ini();
     // system refresh
     StatusRefreshMessage message{};
     EventDispatcher::send_message(message);
     chprintf(chp, "ok\r\n");
 }
 
+static void cmd_settingsini(BaseSequentialStream* chp, int argc, char* argv[]) {
+    const char* usage =
+        "usage: settingsini export|import\r\n"
+        "export: write every app's settings to its .ini file\r\n"
+        "import: drop the binary settings, apps load their .ini file next time\r\n";
+    if (argc != 1) {
+        chprintf(chp, usage);
+        return;
+    }
+    if (strcmp(argv[0], "export") == 0) {
+        chprintf(chp, export_settings_to_ini() ? "ok\r\n" : "error\r\n");
+    } else if (strcmp(argv[0], "import") == 0) {
+        import_settings_from_ini();
+        chprintf(chp, "ok\r\n");
+    } else {
+        chprintf(chp, usage);
+    }
+}
+
 static void cmd_sendpocsag(BaseSequentialStream* chp, int argc, char* argv[]) {
     const char* usage = "usage: sendpocsag <addr> <msglen> [baud] [type] [function] [phase] \r\n";
     (void)argv;
@@ -1415,6 +1447,7 @@ static const ShellCommand commands[] = {
     {"radioinfo", cmd_radioinfo},
     {"pmemreset", cmd_pmemreset},
     {"settingsreset", cmd_settingsreset},
+    {"settingsini", cmd_settingsini},
     {"sendpocsag", cmd_sendpocsag},
     {"asyncmsg", cmd_asyncmsg},
     {"setfreq", cmd_setfreq},
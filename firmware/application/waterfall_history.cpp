@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "waterfall_history.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace {
+
+constexpr uint8_t escape = 0x8;
+
+/* Nibbles of a row: a difference to the previous column in -7..7, or the
+ * escape and the level, high nibble first. */
+template <typename Emit>
+void code_row(const WaterfallHistory::Row& row, size_t width, Emit emit) {
+    int previous = 0;
+    for (size_t i = 0; i < width; i++) {
+        const auto level = row[i];
+        const int difference = level - previous;
+        if (difference >= -7 && difference <= 7) {
+            emit(difference & 0xf);
+        } else {
+            emit(escape);
+            emit(level >> 4);
+            emit(level & 0xf);
+        }
+        previous = level;
+    }
+}
+
+}  // namespace
+
+WaterfallHistory::WaterfallHistory(size_t width, size_t buffer_size)
+    : width_{std::min(width, max_width)},
+      buffer_size_{buffer_size},
+      // Rows are at least width / 2 bytes.
+      max_rows_{buffer_size / std::max<size_t>(width_ / 2, 1)},
+      buffer_{std::make_unique<uint8_t[]>(buffer_size)},
+      entries_{std::make_unique<Entry[]>(max_rows_)} {
+}
+
+void WaterfallHistory::push(const Spectrum& db) {
+    Row row{};
+    const auto half = width_ / 2;
+    for (size_t i = 0; i < half; i++)
+        row[i] = db[db.size() - half + i];
+    for (size_t i = half; i < width_; i++)
+        row[i] = db[i - half];
+    push(row);
+}
+
+void WaterfallHistory::push(const Row& row) {
+    size_t nibbles = 0;
+    code_row(row, width_, [&nibbles](uint8_t) { nibbles++; });
+    const size_t length = (nibbles + 1) / 2;
+    if (length > buffer_size_ || max_rows_ == 0)
+        return;
+
+    // Codes are not split over the end of the buffer.
+    size_t offset = write_;
+    if (offset + length > buffer_size_) {
+        while (count_ && entry(count_ - 1).offset >= write_)
+            drop_oldest();
+        offset = 0;
+    }
+    // Any older code from 'offset' on is in the way, up to the end of the new one.
+    while (count_ && (count_ == max_rows_ || (entry(count_ - 1).offset >= offset && entry(count_ - 1).offset < offset + length)))
+        drop_oldest();
+
+    auto p = &buffer_[offset];
+    size_t n = 0;
+    code_row(row, width_, [&p, &n](uint8_t nibble) {
+        if (n++ & 1)
+            *(p++) |= nibble << 4;
+        else
+            *p = nibble;
+    });
+
+    entries_[(first_ + count_) % max_rows_] = {uint16_t(offset), uint16_t(length)};
+    count_++;
+    write_ = offset + length;
+}
+
+void WaterfallHistory::clear() {
+    first_ = 0;
+    count_ = 0;
+    write_ = 0;
+}
+
+bool WaterfallHistory::row(size_t age, Row& out) const {
+    if (age >= count_)
+        return false;
+
+    const auto& e = entry(age);
+    const auto code = &buffer_[e.offset];
+    size_t n = 0;
+    const auto next = [code, &n]() -> uint8_t {
+        const auto byte = code[n / 2];
+        return (n++ & 1) ? (byte >> 4) : (byte & 0xf);
+    };
+
+    int previous = 0;
+    for (size_t i = 0; i < width_; i++) {
+        auto& level = out[i];
+        const auto nibble = next();
+        if (nibble == escape) {
+            const uint8_t high = next();
+            level = (high << 4) | next();
+        } else {
+            // Sign extends the 4 bit difference.
+            level = previous + (int(nibble ^ 0x8) - 0x8);
+        }
+        previous = level;
+    }
+    return true;
+}
+
+Optional<File::Error> WaterfallHistory::write_pgm(const std::filesystem::path& path) const {
+    File file{};
+    auto error = file.create(path);
+    if (error)
+        return error;
+
+    const auto header = "P5\n" + std::to_string(width_) + " " + std::to_string(count_) + "\n255\n";
+    const auto header_result = file.write(header.data(), header.size());
+    if (header_result.is_error())
+        return header_result.error();
+
+    Row row;
+    for (size_t age = 0; age < count_; age++) {
+        this->row(age, row);
+        const auto result = file.write(row.data(), width_);
+        if (result.is_error())
+            return result.error();
+    }
+    return {};
+}
+
+const WaterfallHistory::Entry& WaterfallHistory::entry(size_t age) const {
+    return entries_[(first_ + count_ - 1 - age) % max_rows_];
+}
+
+void WaterfallHistory::drop_oldest() {
+    first_ = (first_ + 1) % max_rows_;
+    count_--;
+}
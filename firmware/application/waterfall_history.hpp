@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef __WATERFALL_HISTORY_H__
+#define __WATERFALL_HISTORY_H__
+
+#include "file.hpp"
+#include "optional.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/* The last rows of a waterfall as the raw spectrum levels, so they can be
+ * drawn again (scrolled back, with another gradient) or saved without
+ * reading the LCD back.
+ *
+ * Rows are kept in the order of the screen columns, each one coded on its
+ * own as the 4 bit differences between neighbouring columns (a 0x8 nibble
+ * escapes a full 8 bit level). Noise floor rows take about half their raw
+ * size. The oldest rows make room for new ones. */
+class WaterfallHistory {
+   public:
+    static constexpr size_t max_width = 320;
+    using Row = std::array<uint8_t, max_width>;  // Up to width().
+    using Spectrum = std::array<uint8_t, 256>;
+
+    /* Codes take 'buffer_size' bytes at most, and 1/2 to 3/2 bytes a column. */
+    WaterfallHistory(size_t width, size_t buffer_size);
+
+    WaterfallHistory(const WaterfallHistory&) = delete;
+    WaterfallHistory& operator=(const WaterfallHistory&) = delete;
+
+    /* Adds the width() center bins, negative frequencies to the left. */
+    void push(const Spectrum& db);
+    void push(const Row& row);
+
+    void clear();
+
+    size_t width() const { return width_; }
+    size_t size() const { return count_; }
+
+    /* Row 0 is the newest. False past size(). */
+    bool row(size_t age, Row& out) const;
+
+    /* Binary PGM, newest row on top. */
+    Optional<File::Error> write_pgm(const std::filesystem::path& path) const;
+
+   private:
+    struct Entry {
+        uint16_t offset;
+        uint16_t length;
+    };
+
+    const size_t width_;
+    const size_t buffer_size_;
+    const size_t max_rows_;
+    std::unique_ptr<uint8_t[]> buffer_;
+    std::unique_ptr<Entry[]> entries_;
+    size_t first_{0};  // Oldest entry.
+    size_t count_{0};
+    size_t write_{0};  // Into buffer_.
+
+    const Entry& entry(size_t age) const;
+    void drop_oldest();
+};
+
+#endif /*__WATERFALL_HISTORY_H__*/
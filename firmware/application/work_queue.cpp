@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "work_queue.hpp"
+
+#include "event_m0.hpp"
+
+namespace {
+
+WorkTasks tasks{};
+Mutex mutex;
+Semaphore queued;
+bool started = false;
+
+/* System ticks are ms. */
+uint32_t now_ms() {
+    return chTimeNow();
+}
+
+}  // namespace
+
+void WorkQueue::start() {
+    chMtxInit(&mutex);
+    chSemInit(&queued, 0);
+
+    // Below the UI thread, so work never holds up painting.
+    for (size_t i = 0; i < worker_count; i++)
+        chThdCreateFromHeap(NULL, worker_stack_size, NORMALPRIO - 1, WorkQueue::worker_fn, nullptr);
+    started = true;
+}
+
+bool WorkQueue::post(const void* owner, Function work, Function done) {
+    if (!started)
+        start();
+
+    chMtxLock(&mutex);
+    const auto posted = tasks.post(owner, std::move(work), std::move(done), now_ms());
+    chMtxUnlock();
+
+    if (posted)
+        chSemSignal(&queued);
+    return posted;
+}
+
+void WorkQueue::cancel(const void* owner) {
+    if (!started)
+        return;
+
+    while (true) {
+        chMtxLock(&mutex);
+        tasks.cancel(owner);
+        const auto running = tasks.running(owner);
+        chMtxUnlock();
+
+        if (!running)
+            break;
+        chThdSleepMilliseconds(1);
+    }
+}
+
+WorkTasks::Stats WorkQueue::stats() {
+    if (!started)
+        return tasks.stats();
+
+    chMtxLock(&mutex);
+    const auto result = tasks.stats();
+    chMtxUnlock();
+    return result;
+}
+
+size_t WorkQueue::depth() {
+    if (!started)
+        return 0;
+
+    chMtxLock(&mutex);
+    const auto result = tasks.depth();
+    chMtxUnlock();
+    return result;
+}
+
+msg_t WorkQueue::worker_fn(void*) {
+    while (true) {
+        chSemWait(&queued);
+
+        chMtxLock(&mutex);
+        auto task = tasks.start(now_ms());
+        chMtxUnlock();
+
+        // Cancelled while it waited.
+        if (!task)
+            continue;
+
+        task->work();
+
+        chMtxLock(&mutex);
+        tasks.finish(*task, now_ms());
+        chMtxUnlock();
+        // An event flag can't be dropped like a queued message, and
+        // several finished tasks are picked up by one on_work_done().
+        EventDispatcher::events_flag(EVT_MASK_WORK_DONE);
+    }
+    return 0;
+}
+
+/* On the UI thread. */
+void WorkQueue::on_work_done() {
+    while (true) {
+        Function done{};
+        chMtxLock(&mutex);
+        const auto taken = tasks.take_finished(done);
+        chMtxUnlock();
+
+        if (!taken)
+            break;
+        if (done)
+            done();
+    }
+}
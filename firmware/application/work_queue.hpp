@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __WORK_QUEUE_H__
+#define __WORK_QUEUE_H__
+
+#include "ch.h"
+
+#include "work_tasks.hpp"
+
+/* Runs blocking work -- SD card writes, database lookups -- on worker
+ * threads so the UI thread keeps painting and handling messages. Each
+ * task's 'done' then runs on the UI thread, woken by an event flag. Up
+ * to WorkTasks::capacity tasks wait or run at once; posting more fails
+ * rather than blocks. */
+class WorkQueue {
+   public:
+    using Function = WorkTasks::Function;
+
+    static constexpr size_t worker_count = 2;
+    /* Room for a File (556 bytes) and the FatFs calls under it. */
+    static constexpr size_t worker_stack_size = 2048;
+
+    /* Call from the UI thread only. */
+    static bool post(const void* owner, Function work, Function done);
+    /* Drops the owner's tasks and waits for any running one. */
+    static void cancel(const void* owner);
+
+    static WorkTasks::Stats stats();
+    static size_t depth();
+
+    /* Runs the 'done' of finished tasks, from the event loop on
+     * EVT_MASK_WORK_DONE. */
+    static void on_work_done();
+
+   private:
+    static msg_t worker_fn(void* arg);
+    static void start();
+};
+
+/* Work for one owner, usually a View. Declare it after the members its
+ * tasks use: going away, it cancels its tasks and waits for a running
+ * one, so 'done' never runs on a dead owner. */
+class WorkClient {
+   public:
+    WorkClient() = default;
+    ~WorkClient() {
+        WorkQueue::cancel(this);
+    }
+
+    WorkClient(const WorkClient&) = delete;
+    WorkClient& operator=(const WorkClient&) = delete;
+
+    /* 'work' runs on a worker, then 'done' on the UI thread. */
+    bool post(WorkQueue::Function work, WorkQueue::Function done = {}) {
+        return WorkQueue::post(this, std::move(work), std::move(done));
+    }
+};
+
+#endif /*__WORK_QUEUE_H__*/
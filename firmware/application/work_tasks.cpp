@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "work_tasks.hpp"
+
+#include <algorithm>
+
+bool WorkTasks::post(const void* owner, Function work, Function done, uint32_t now_ms) {
+    const auto slot = std::find_if(tasks_.begin(), tasks_.end(), [](const Task& task) {
+        return task.state == State::Free;
+    });
+    if (slot == tasks_.end()) {
+        stats_.rejected++;
+        return false;
+    }
+
+    *slot = {std::move(work), std::move(done), owner, sequence_++, now_ms, 0, State::Queued, false};
+    stats_.posted++;
+    stats_.max_depth = std::max(stats_.max_depth, depth());
+    return true;
+}
+
+WorkTasks::Task* WorkTasks::oldest(State state) {
+    Task* result = nullptr;
+    for (auto& task : tasks_) {
+        // Sequence numbers wrap, compare their distance.
+        if (task.state == state && (!result || int32_t(task.sequence - result->sequence) < 0))
+            result = &task;
+    }
+    return result;
+}
+
+WorkTasks::Task* WorkTasks::start(uint32_t now_ms) {
+    auto task = oldest(State::Queued);
+    if (task) {
+        task->state = State::Running;
+        task->started_ms = now_ms;
+        const auto wait = now_ms - task->queued_ms;
+        stats_.max_wait_ms = std::max(stats_.max_wait_ms, wait);
+        stats_.total_wait_ms += wait;
+    }
+    return task;
+}
+
+void WorkTasks::finish(Task& task, uint32_t now_ms) {
+    task.work = nullptr;
+    task.state = State::Finished;
+    const auto run = now_ms - task.started_ms;
+    stats_.max_run_ms = std::max(stats_.max_run_ms, run);
+    stats_.total_run_ms += run;
+}
+
+bool WorkTasks::take_finished(Function& done) {
+    auto task = oldest(State::Finished);
+    if (!task)
+        return false;
+
+    done = std::move(task->done);
+    if (!task->cancelled)
+        stats_.completed++;
+    free(*task);
+    return true;
+}
+
+void WorkTasks::cancel(const void* owner) {
+    for (auto& task : tasks_) {
+        if (task.state == State::Free || task.owner != owner || task.cancelled)
+            continue;
+
+        stats_.cancelled++;
+        if (task.state == State::Queued) {
+            free(task);
+        } else {
+            // Left for the worker to finish.
+            task.done = nullptr;
+            task.cancelled = true;
+        }
+    }
+}
+
+bool WorkTasks::running(const void* owner) const {
+    return std::any_of(tasks_.begin(), tasks_.end(), [owner](const Task& task) {
+        return task.state == State::Running && task.owner == owner;
+    });
+}
+
+size_t WorkTasks::depth() const {
+    return std::count_if(tasks_.begin(), tasks_.end(), [](const Task& task) {
+        return task.state == State::Queued || task.state == State::Running;
+    });
+}
+
+void WorkTasks::free(Task& task) {
+    task = {};
+}
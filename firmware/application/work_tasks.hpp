@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __WORK_TASKS_H__
+#define __WORK_TASKS_H__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/* The bookkeeping behind WorkQueue: a bounded table of tasks, each one
+ * queued, running on a worker or finished and waiting for its 'done' to
+ * run on the UI thread. Not thread safe, WorkQueue locks around it. */
+class WorkTasks {
+   public:
+    using Function = std::function<void()>;
+
+    static constexpr size_t capacity = 8;
+
+    struct Stats {
+        uint32_t posted;
+        uint32_t rejected;  // Queue full.
+        uint32_t completed;
+        uint32_t cancelled;
+        size_t max_depth;  // Most tasks queued or running at once.
+        uint32_t max_wait_ms;
+        uint32_t max_run_ms;
+        uint32_t total_wait_ms;
+        uint32_t total_run_ms;
+    };
+
+    enum class State : uint8_t {
+        Free,
+        Queued,
+        Running,
+        Finished,
+    };
+
+    struct Task {
+        Function work{};
+        Function done{};
+        const void* owner{nullptr};
+        uint32_t sequence{0};
+        uint32_t queued_ms{0};
+        uint32_t started_ms{0};
+        State state{State::Free};
+        bool cancelled{false};
+    };
+
+    /* False if the table is full. */
+    bool post(const void* owner, Function work, Function done, uint32_t now_ms);
+
+    /* Worker side: the oldest queued task, now running, or nullptr. */
+    Task* start(uint32_t now_ms);
+    void finish(Task& task, uint32_t now_ms);
+
+    /* UI side: takes the oldest finished task, false if there is none.
+     * 'done' is empty for cancelled tasks. */
+    bool take_finished(Function& done);
+
+    /* Drops the owner's queued tasks and the 'done' of its other ones. */
+    void cancel(const void* owner);
+    /* A worker is running one of the owner's tasks. */
+    bool running(const void* owner) const;
+
+    size_t depth() const;
+    const Stats& stats() const { return stats_; }
+
+   private:
+    std::array<Task, capacity> tasks_{};
+    uint32_t sequence_{0};
+    Stats stats_{};
+
+    Task* oldest(State state);
+    void free(Task& task);
+};
+
+#endif /*__WORK_TASKS_H__*/
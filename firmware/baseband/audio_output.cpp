@@ -32,14 +32,15 @@
 #include <cstdint>
 #include <cstddef>
 #include <array>
+#include <algorithm>
 
 void AudioOutput::configure(const bool do_proc) {
     do_processing = do_proc;
 }
 
 void AudioOutput::configure(const iir_biquad_config_t& hpf_config, const iir_biquad_config_t& deemph_config, const float squelch_threshold) {
-    hpf.configure(hpf_config);
-    deemph.configure(deemph_config);
+    channel_left.configure(hpf_config, deemph_config);
+    channel_right.configure(hpf_config, deemph_config);
     squelch.set_threshold(squelch_threshold);
 }
 
@@ -78,11 +79,11 @@ void AudioOutput::apt_write(const buffer_s16_t& audio, std::array<float, 32>& au
 }
 
 void AudioOutput::write(const buffer_s16_t& audio) {
-    std::array<float, 32> audio_f;
-    for (size_t i = 0; i < audio.count; i++) {
-        audio_f[i] = audio.p[i] * ki;
-    }
-    write(buffer_f32_t{audio_f.data(), audio.count, audio.sampling_rate});
+    block_buffer_s16.feed(
+        audio,
+        [this](const buffer_s16_t& buffer) {
+            this->on_block(buffer);
+        });
 }
 
 void AudioOutput::write(const buffer_f32_t& audio) {
@@ -93,17 +94,39 @@ void AudioOutput::write(const buffer_f32_t& audio) {
         });
 }
 
+/* The channels are paired up before block_buffer_stereo cuts them into
+ * DMA transfers, so any block size works. */
+void AudioOutput::write(const buffer_s16_t& left, const buffer_s16_t& right) {
+    const size_t count = std::min(left.count, right.count);
+    std::array<audio::sample_t, 32> pairs;
+    for (size_t first = 0; first < count; first += pairs.size()) {
+        const size_t n = std::min(pairs.size(), count - first);
+        for (size_t i = 0; i < n; i++) {
+            pairs[i].left = left.p[first + i];
+            pairs[i].right = right.p[first + i];
+        }
+        block_buffer_stereo.feed(
+            {pairs.data(), n, left.sampling_rate},
+            [this](const audio::buffer_t& block) {
+                this->on_block(block);
+            });
+    }
+}
+
+bool AudioOutput::update_audio_present(const bool audio_present_now) {
+    audio_present_history = (audio_present_history << 1) | (audio_present_now ? 1 : 0);
+    audio_present = (audio_present_history != 0);
+    return audio_present;
+}
+
 void AudioOutput::on_block(const buffer_f32_t& audio) {
     if (do_processing) {
         const auto audio_present_now = squelch.execute(audio);
 
-        hpf.execute_in_place(audio);     // IIRBiquadFilter name is "hpf", but we will call with "hpf-coef" for all  except AMFM (WFAX) with "lpf-coef" and notch for WFMAM (NOAA)
-        deemph.execute_in_place(audio);  // IIRBiquadFilter name is "deemph", but we will call LPF de-emphasis or  other LPF for WFAM (NOAA).
+        channel_left.hpf.execute_in_place(audio);     // IIRBiquadFilter name is "hpf", but we will call with "hpf-coef" for all  except AMFM (WFAX) with "lpf-coef" and notch for WFMAM (NOAA)
+        channel_left.deemph.execute_in_place(audio);  // IIRBiquadFilter name is "deemph", but we will call LPF de-emphasis or  other LPF for WFAM (NOAA).
 
-        audio_present_history = (audio_present_history << 1) | (audio_present_now ? 1 : 0);
-        audio_present = (audio_present_history != 0);
-
-        if (!audio_present) {
+        if (!update_audio_present(audio_present_now)) {
             for (size_t i = 0; i < audio.count; i++) {
                 audio.p[i] = 0;
             }
@@ -114,6 +137,110 @@ void AudioOutput::on_block(const buffer_f32_t& audio) {
     fill_audio_buffer(audio, audio_present);
 }
 
+/* Fused int16_t path: squelch detect, then HPF, de-emphasis and
+ * saturation per sample, writing the DMA buffer and the recording/stats
+ * copy in the same loop. */
+void AudioOutput::on_block(const buffer_s16_t& audio) {
+    if (!do_processing) {
+        audio_present = true;
+        fill_audio_buffer(audio, audio_present);
+        return;
+    }
+
+    if (!update_audio_present(squelch.execute(audio))) {
+        mute_block(audio.count, audio.sampling_rate);
+        return;
+    }
+
+    std::array<int16_t, 32> audio_int;
+    auto audio_buffer = audio::dma::tx_empty_buffer();
+    if (fixed_point) {
+        for (size_t i = 0; i < audio_buffer.count; i++) {
+            const auto sample = channel_left.process_fixed(audio.p[i]);
+            audio_buffer.p[i].left = audio_buffer.p[i].right = sample;
+            audio_int[i] = sample;
+        }
+    } else {
+        for (size_t i = 0; i < audio_buffer.count; i++) {
+            const auto sample = channel_left.process(audio.p[i]);
+            audio_buffer.p[i].left = audio_buffer.p[i].right = sample;
+            audio_int[i] = sample;
+        }
+    }
+
+    emit_block(audio_int, audio);
+}
+
+void AudioOutput::on_block(const audio::buffer_t& stereo) {
+    // Squelch on the left channel, which is mono without a pilot.
+    std::array<int16_t, 32> audio_int;
+    for (size_t i = 0; i < stereo.count; i++)
+        audio_int[i] = stereo.p[i].left;
+    const buffer_s16_t left{audio_int.data(), stereo.count, stereo.sampling_rate};
+
+    if (!do_processing) {
+        audio_present = true;
+    } else if (!update_audio_present(squelch.execute(left))) {
+        mute_block(stereo.count, stereo.sampling_rate);
+        channel_right.reset();
+        return;
+    }
+
+    auto audio_buffer = audio::dma::tx_empty_buffer();
+    for (size_t i = 0; i < audio_buffer.count; i++) {
+        int16_t sample_left = stereo.p[i].left;
+        int16_t sample_right = stereo.p[i].right;
+        if (do_processing) {
+            if (fixed_point) {
+                sample_left = channel_left.process_fixed(sample_left);
+                sample_right = channel_right.process_fixed(sample_right);
+            } else {
+                sample_left = channel_left.process(sample_left);
+                sample_right = channel_right.process(sample_right);
+            }
+        }
+        audio_buffer.p[i].left = sample_left;
+        audio_buffer.p[i].right = sample_right;
+        // Recordings stay mono so the WAV format doesn't change.
+        audio_int[i] = (sample_left + sample_right) / 2;
+    }
+
+    emit_block(audio_int, left);
+}
+
+void AudioOutput::mute_block(const size_t count, const uint32_t sampling_rate) {
+    auto audio_buffer = audio::dma::tx_empty_buffer();
+    for (size_t i = 0; i < audio_buffer.count; i++) {
+        audio_buffer.p[i].left = audio_buffer.p[i].right = 0;
+    }
+
+    // Filters restart from rest when the squelch opens again.
+    channel_left.reset();
+
+    audio_stats.mute(
+        count,
+        sampling_rate,
+        [](const AudioStatistics& statistics) {
+            const AudioStatisticsMessage audio_stats_message{statistics};
+            shared_memory.application_queue.push(audio_stats_message);
+        });
+}
+
+void AudioOutput::emit_block(const std::array<int16_t, 32>& audio, const buffer_s16_t& source) {
+    const buffer_s16_t processed{const_cast<int16_t*>(audio.data()), source.count, source.sampling_rate};
+    if (stream) {
+        stream->write(processed.p, processed.count * sizeof(processed.p[0]));
+    }
+
+    // Levels as the float path reports them, which this path replaced.
+    audio_stats.feed_normalized(
+        processed,
+        [](const AudioStatistics& statistics) {
+            const AudioStatisticsMessage audio_stats_message{statistics};
+            shared_memory.application_queue.push(audio_stats_message);
+        });
+}
+
 bool AudioOutput::is_squelched() {
     return !audio_present;
 }
@@ -164,3 +291,28 @@ void AudioOutput::feed_audio_stats(const buffer_f32_t& audio) {
             shared_memory.application_queue.push(audio_stats_message);
         });
 }
+
+void AudioOutput::Channel::configure(const iir_biquad_config_t& hpf_config, const iir_biquad_config_t& deemph_config) {
+    hpf.configure(hpf_config);
+    deemph.configure(deemph_config);
+    hpf_fixed.configure(hpf_config);
+    deemph_fixed.configure(deemph_config);
+}
+
+void AudioOutput::Channel::reset() {
+    hpf.reset();
+    deemph.reset();
+    hpf_fixed.reset();
+    deemph_fixed.reset();
+}
+
+int16_t AudioOutput::Channel::process(const int16_t sample) {
+    const float filtered = deemph.execute(hpf.execute(sample * ki));
+    return __SSAT(static_cast<int32_t>(filtered * k), 16);
+}
+
+int16_t AudioOutput::Channel::process_fixed(const int16_t sample) {
+    constexpr int32_t sample_shift = IIRBiquadFixedFilter::sample_shift;
+    const int32_t filtered = deemph_fixed.execute(hpf_fixed.execute(sample << sample_shift));
+    return __SSAT(filtered >> sample_shift, 16);
+}
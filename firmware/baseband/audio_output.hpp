@@ -32,6 +32,7 @@
 #include "stream_input.hpp"
 #include "block_decimator.hpp"
 #include "audio_stats_collector.hpp"
+#include "audio_dma.hpp"
 
 #include <cstdint>
 #include <memory>
@@ -45,11 +46,19 @@ class AudioOutput {
         const iir_biquad_config_t& deemph_config = iir_config_passthrough,
         const float squelch_threshold = 0.0f);
 
+    /* int16_t audio is squelched, filtered, scaled, saturated and copied to
+     * the DMA buffer in a single pass. Demodulators whose filters tolerate
+     * it can opt in to fixed point biquads for that pass. */
+    void set_fixed_point(const bool enabled) {
+        fixed_point = enabled;
+    }
+
     void write_unprocessed(const buffer_s16_t& audio);
     void apt_write(const buffer_s16_t& audio);
     void apt_write(const buffer_s16_t& audio, std::array<float, 32>& audio_f);
     void write(const buffer_s16_t& audio);
     void write(const buffer_f32_t& audio);
+    void write(const buffer_s16_t& left, const buffer_s16_t& right);
 
     void set_stream(std::unique_ptr<StreamInput> new_stream) {
         stream = std::move(new_stream);
@@ -63,13 +72,29 @@ class AudioOutput {
     static constexpr float cos_theta = 0.30901699437494742410f;
     static constexpr float sin_theta = 0.95105651629515357212f;
 
+    /* Post-processing state for one output channel. */
+    struct Channel {
+        IIRBiquadFilter hpf{};
+        IIRBiquadFilter deemph{};
+        IIRBiquadFixedFilter hpf_fixed{};
+        IIRBiquadFixedFilter deemph_fixed{};
+
+        void configure(const iir_biquad_config_t& hpf_config, const iir_biquad_config_t& deemph_config);
+        void reset();
+
+        int16_t process(const int16_t sample);
+        int16_t process_fixed(const int16_t sample);
+    };
+
     float cur = 0.0f, cur2 = 0.0f, prev = 0.0f, prev2 = 0.0f, mag_am = 0.0f;
 
     BlockDecimator<int16_t, 32> block_buffer_s16{1};
     BlockDecimator<float, 32> block_buffer{1};
+    BlockDecimator<audio::sample_t, 32> block_buffer_stereo{1};
 
-    IIRBiquadFilter hpf{};
-    IIRBiquadFilter deemph{};
+    // hpf is named for history: some modes configure it as a LPF or notch.
+    Channel channel_left{};
+    Channel channel_right{};
     FMSquelch squelch{};
 
     std::unique_ptr<StreamInput> stream{};
@@ -80,8 +105,15 @@ class AudioOutput {
 
     bool audio_present = false;
     bool do_processing = true;
+    bool fixed_point = false;
+
+    bool update_audio_present(const bool audio_present_now);
 
     void on_block(const buffer_f32_t& audio);
+    void on_block(const buffer_s16_t& audio);
+    void on_block(const audio::buffer_t& stereo);
+    void mute_block(const size_t count, const uint32_t sampling_rate);
+    void emit_block(const std::array<int16_t, 32>& audio, const buffer_s16_t& source);
 
     void fill_audio_buffer(const buffer_s16_t& audio, const bool send_to_fifo);
     void fill_audio_buffer(const buffer_f32_t& audio, const bool send_to_fifo);
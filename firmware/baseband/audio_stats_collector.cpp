@@ -23,12 +23,12 @@
 
 #include "utility.hpp"
 
-void AudioStatsCollector::consume_audio_buffer(const buffer_s16_t& src) {
+void AudioStatsCollector::consume_audio_buffer(const buffer_s16_t& src, const float scale_squared) {
     auto src_p = src.p;
     const auto src_end = &src.p[src.count];
     while (src_p < src_end) {
-        const auto sample = *(src_p++);
-        const auto sample_squared = sample * sample;
+        const int32_t sample = *(src_p++);
+        const float sample_squared = sample * sample * scale_squared;
         squared_sum += sample_squared;
         if (sample_squared > max_squared) {
             max_squared = sample_squared;
@@ -69,8 +69,8 @@ bool AudioStatsCollector::update_stats(const size_t sample_count, const size_t s
     }
 }
 
-bool AudioStatsCollector::feed(const buffer_s16_t& src) {
-    consume_audio_buffer(src);
+bool AudioStatsCollector::feed(const buffer_s16_t& src, const float scale_squared) {
+    consume_audio_buffer(src, scale_squared);
 
     return update_stats(src.count, src.sampling_rate);
 }
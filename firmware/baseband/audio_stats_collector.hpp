@@ -37,6 +37,14 @@ class AudioStatsCollector {
         }
     }
 
+    /* int16_t audio scaled to +/-1.0, to read the same as the float path. */
+    template <typename Callback>
+    void feed_normalized(const buffer_s16_t& src, Callback callback) {
+        if (feed(src, 1.0f / (32768.0f * 32768.0f))) {
+            callback(statistics);
+        }
+    }
+
     template <typename Callback>
     void feed(const buffer_f32_t& src, Callback callback) {
         if (feed(src)) {
@@ -59,12 +67,12 @@ class AudioStatsCollector {
 
     AudioStatistics statistics{};
 
-    void consume_audio_buffer(const buffer_s16_t& src);
+    void consume_audio_buffer(const buffer_s16_t& src, const float scale_squared);
     void consume_audio_buffer(const buffer_f32_t& src);
 
     bool update_stats(const size_t sample_count, const size_t sampling_rate);
 
-    bool feed(const buffer_s16_t& src);
+    bool feed(const buffer_s16_t& src, const float scale_squared = 1.0f);
     bool feed(const buffer_f32_t& src);
     bool mute(const size_t sample_count, const size_t sampling_rate);
 };
@@ -0,0 +1,326 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __DSP_ANALOG_TV_H__
+#define __DSP_ANALOG_TV_H__
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace dsp {
+namespace analog_tv {
+
+/* 625 line, 50 field TV with negative AM video, as PAL and SECAM B/G:
+ * sync tips at full carrier, blanking at 75%, peak white at 12.5%. Times
+ * are in samples of the envelope at 2MHz. */
+constexpr uint32_t sample_rate = 2000000;
+constexpr size_t samples_per_line = 128;  // 64us
+constexpr float line_period = samples_per_line;
+constexpr size_t lines_per_field = 312;    // And a half.
+constexpr int32_t first_active_line = 23;  // Counted from the line vertical sync starts in.
+constexpr int32_t active_lines = 287;
+constexpr float active_start = 21.0f;  // 10.5us after the leading edge of sync.
+constexpr float active_length = 104.0f;
+
+/* Sync pulses by width: equalizing pulses (2.35us) and noise are shorter
+ * than line sync (4.7us), the broad pulses of vertical sync (27.3us) much
+ * longer. */
+constexpr float line_sync_min = 6.0f;
+constexpr float line_sync_max = 14.0f;
+constexpr float broad_sync_min = 40.0f;
+
+/* Locks to the sync pulses of the envelope and cuts it into fields of
+ * Height rows of Width pixels, 0 black to 255 white.
+ *
+ * Sync is sliced half way between sync tip and blanking, both measured on
+ * every locked line, with the crossing interpolated between samples.
+ * Unlocked, 'lock_pulses' line syncs a line apart lock the line timing.
+ * Locked, a flywheel expects each line sync within 'window' of one line
+ * after the last, and pulls its phase and period towards the ones it
+ * finds. It coasts through the vertical interval, where there are none,
+ * and unlocks after 'max_misses' lines without one.
+ *
+ * Two broad pulses in a row start a field. Without them, fields follow
+ * each other every lines_per_field lines. The active lines of a field are
+ * resampled to Width pixels and every active_lines / Height lines kept. */
+template <size_t Width, size_t Height>
+class VideoSync {
+   public:
+    static constexpr float window = 6.0f;
+    static constexpr uint32_t lock_pulses = 4;
+    static constexpr uint32_t max_misses = 32;
+
+    struct Field {
+        uint16_t lines;  // Fewer than Height if vertical sync cut it short.
+        bool line_locked;
+        bool field_locked;
+    };
+
+    /* Calls on_field(field) for each field filled into the buffer that
+     * was set when it started. */
+    template <typename FieldHandler>
+    void execute(const float sample, FieldHandler on_field) {
+        ring[head] = sample;
+        head = (head + 1) & ring_mask;
+        const float position = since;
+        since += 1.0f;
+        line_max = std::max(line_max, sample);
+
+        // Sync is sliced from the average of the last 4 samples, 1.5 late.
+        const float level = (sample + ring[(head - 2) & ring_mask] + ring[(head - 3) & ring_mask] + ring[(head - 4) & ring_mask]) * 0.25f;
+        if (!in_sync) {
+            if (level > slice + hysteresis) {
+                in_sync = true;
+                const float t = (level > previous) ? (slice - previous) / (level - previous) : 0.0f;
+                pulse_edge = position - 2.5f + std::clamp(t, 0.0f, 1.0f);
+            }
+        } else if (level < slice - hysteresis) {
+            in_sync = false;
+            on_pulse(pulse_edge, position - 1.5f - pulse_edge);
+        }
+        previous = level;
+
+        if (since >= period + decision_delay)
+            cut(on_field);
+    }
+
+    /* Where the next field goes, nullptr to skip it. Taken when a field
+     * starts; on_field() hands it back. */
+    void set_field_buffer(uint8_t* const pixels) {
+        pending_pixels = pixels;
+    }
+
+    bool line_locked() const { return line_locked_; }
+    bool field_locked() const { return field_locked_; }
+
+    /* Envelope of the middle line of the last field, sync tip near 224. */
+    const std::array<uint8_t, samples_per_line>& scope() const { return scope_; }
+
+   private:
+    static constexpr size_t ring_mask = 255;
+    // The trailing edge of the next line sync is in by then.
+    static constexpr float decision_delay = 16.0f;
+    static constexpr float phase_gain = 0.25f;
+    static constexpr float period_gain = 0.02f;
+
+    std::array<float, ring_mask + 1> ring{};
+    size_t head{0};
+    // Positions are in samples from the start of the current line, the
+    // leading edge of its sync.
+    float since{0.0f};
+    float period{line_period};
+    float previous{0.0f};
+
+    float peak{0.0f};
+    float line_max{0.0f};
+    float tip{0.0f};
+    float black{0.0f};
+    bool levels_valid{false};
+    float slice{0.0f};
+    float hysteresis{0.0f};
+
+    bool in_sync{false};
+    float pulse_edge{0.0f};
+
+    bool line_locked_{false};
+    float last_edge{0.0f};
+    uint32_t consecutive{0};
+    bool found{false};
+    bool started_on_sync{false};
+    float found_error{0.0f};
+    uint32_t misses{0};
+
+    uint32_t broad_count{0};
+    float broad_edge{0.0f};
+    bool field_locked_{false};
+    bool field_restart{false};
+    int32_t field_line{0};
+
+    uint8_t* pending_pixels{nullptr};
+    uint8_t* field_pixels{nullptr};
+    size_t next_row{0};
+    std::array<uint8_t, samples_per_line> scope_{};
+
+    /* The envelope at 'position', between samples in the ring. */
+    float at(const float position) const {
+        const float back = since - 1.0f - position;
+        const size_t n = back;
+        const float fraction = back - n;
+        const float newer = ring[(head - 1 - n) & ring_mask];
+        const float older = ring[(head - 2 - n) & ring_mask];
+        return newer + (older - newer) * fraction;
+    }
+
+    float mean(const float first, const float last) const {
+        float sum = 0.0f;
+        for (float p = first; p <= last; p += 1.0f)
+            sum += at(p);
+        return sum / (last - first + 1.0f);
+    }
+
+    void rebase(const float shift) {
+        since -= shift;
+        pulse_edge -= shift;
+        last_edge -= shift;
+        broad_edge -= shift;
+    }
+
+    void on_pulse(const float edge, const float width) {
+        if (width >= broad_sync_min) {
+            if (broad_count++ == 0)
+                broad_edge = edge;
+            if (broad_count == 2) {
+                // The line vertical sync started in is line 0; it starts
+                // half way through a line in every other field.
+                field_line = int32_t(std::floor(-broad_edge / period + 0.75f));
+                field_locked_ = true;
+                field_restart = true;
+            }
+            return;
+        }
+        if (width < line_sync_min || width > line_sync_max)
+            return;
+        broad_count = 0;
+
+        if (line_locked_) {
+            const float error = edge - period;
+            if (!found && std::fabs(error) < window) {
+                found = true;
+                found_error = error;
+            }
+            return;
+        }
+
+        consecutive = (std::fabs(edge - last_edge - line_period) < 2.0f) ? consecutive + 1 : 1;
+        last_edge = edge;
+        if (consecutive >= lock_pulses) {
+            line_locked_ = true;
+            period = line_period;
+            misses = 0;
+            found = false;
+            started_on_sync = true;
+            rebase(edge);
+        }
+    }
+
+    void update_levels(const bool synced) {
+        if (synced) {
+            const float line_tip = mean(1.0f, 8.0f);
+            const float line_black = mean(12.0f, 19.0f);
+            if (line_tip > line_black) {
+                if (levels_valid) {
+                    tip += (line_tip - tip) * (1.0f / 16);
+                    black += (line_black - black) * (1.0f / 16);
+                } else {
+                    tip = line_tip;
+                    black = line_black;
+                    levels_valid = true;
+                }
+            }
+        }
+
+        peak = (peak == 0.0f) ? line_max : peak + (line_max - peak) * 0.125f;
+        line_max = 0.0f;
+        if (!line_locked_ || !levels_valid) {
+            tip = peak;
+            black = 0.75f * peak;
+        }
+        slice = 0.5f * (tip + black);
+        hysteresis = 0.1f * (tip - black);
+    }
+
+    template <typename FieldHandler>
+    void finish_field(FieldHandler& on_field, const size_t rows) {
+        on_field(Field{uint16_t(rows), line_locked_, field_locked_});
+        field_pixels = nullptr;
+    }
+
+    /* Active line whose pixels go to 'row'. */
+    static int32_t source_line(const size_t row) {
+        return (row * active_lines + Height / 2) / Height;
+    }
+
+    void draw(uint8_t* const pixels) const {
+        // White is as far below blanking as 2.5 sync heights.
+        const float gain = 255.0f / (2.5f * std::max(tip - black, 1e-3f));
+        for (size_t x = 0; x < Width; x++) {
+            const float level = (black - at(active_start + (x + 0.5f) * (active_length / Width))) * gain;
+            pixels[x] = std::clamp(level, 0.0f, 255.0f);
+        }
+    }
+
+    template <typename FieldHandler>
+    void cut(FieldHandler& on_field) {
+        update_levels(line_locked_ && started_on_sync);
+
+        if (field_restart) {
+            field_restart = false;
+            if (field_pixels && next_row)
+                finish_field(on_field, next_row);
+        }
+
+        if (field_line == first_active_line) {
+            field_pixels = pending_pixels;
+            next_row = 0;
+        }
+        const int32_t active = field_line - first_active_line;
+        if (field_pixels && active >= 0 && active < active_lines && source_line(next_row) <= active) {
+            draw(&field_pixels[next_row * Width]);
+            if (++next_row == Height)
+                finish_field(on_field, Height);
+        }
+        if (active == active_lines / 2) {
+            const float scale = 224.0f / std::max(tip, 1e-3f);
+            for (size_t n = 0; n < samples_per_line; n++)
+                scope_[n] = std::clamp(at(n) * scale, 0.0f, 255.0f);
+        }
+
+        if (++field_line >= int32_t(lines_per_field) + 8) {
+            field_line -= lines_per_field;
+            field_locked_ = false;
+        }
+
+        float shift = period;
+        if (line_locked_) {
+            if (found) {
+                shift += phase_gain * found_error;
+                period = std::clamp(period + period_gain * found_error, line_period - 1.0f, line_period + 1.0f);
+                misses = 0;
+            } else if (++misses > max_misses) {
+                line_locked_ = false;
+                levels_valid = false;
+                consecutive = 0;
+                period = line_period;
+            }
+        }
+        started_on_sync = found;
+        found = false;
+        rebase(shift);
+    }
+};
+
+} /* namespace analog_tv */
+} /* namespace dsp */
+
+#endif /*__DSP_ANALOG_TV_H__*/
@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __DSP_APT_H__
+#define __DSP_APT_H__
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace dsp {
+namespace apt {
+
+/* NOAA APT lines: 2080 words, two a second. Taken here at two samples a
+ * word. */
+constexpr size_t words_per_line = 2080;
+constexpr size_t samples_per_word = 2;
+constexpr size_t samples_per_line = words_per_line * samples_per_word;
+constexpr uint32_t sample_rate = samples_per_line * 2;
+
+/* Sync A starts each line: 4 black words, 7 cycles of 2 white and 2 black,
+ * then 7 black. Sync B starts channel B half a line later: 4 black words,
+ * 7 cycles of 3 white and 2 black. */
+constexpr size_t sync_words = 39;
+constexpr size_t sync_b_word = 1040;
+
+constexpr bool sync_a_white(const size_t word) {
+    return (word >= 4) && (word < 4 + 7 * 4) && ((word - 4) % 4 < 2);
+}
+
+constexpr bool sync_b_white(const size_t word) {
+    return (word >= 4) && (word < 4 + 7 * 5) && ((word - 4) % 5 < 3);
+}
+
+/* Finds where lines start in a stream of samples and cuts it into lines.
+ *
+ * Every sample scores the line starting 'sync_b' samples before it: the
+ * mean of its sync A and sync B correlation coefficients, about 1 for a
+ * clean signal. Unlocked, the best start over a whole line wins if it
+ * scores above 'threshold'. Locked, each line looks for its start within
+ * 'window' samples of where the last one ended, which follows the drift
+ * of both clocks; lines that miss keep the expected start. After
+ * 'max_misses' lines in a row it searches the whole line again, still
+ * cutting lines where it expects them meanwhile.
+ *
+ * Lines come out as words, the mean of their two samples. */
+class LineSync {
+   public:
+    static constexpr size_t window = 24;
+    static constexpr float threshold = 0.4f;
+    static constexpr uint32_t max_misses = 8;
+
+    struct Line {
+        uint8_t* words;  // words_per_line of them.
+        bool synced;     // The start of this line was found, not assumed.
+        float score;
+    };
+
+    /* Calls on_line(line) for each complete line. */
+    template <typename LineHandler>
+    void execute(const uint8_t sample, LineHandler on_line) {
+        ring[head] = sample;
+        if (head < sync_samples)
+            ring[samples_per_line + head] = sample;
+        head = (head + 1 == samples_per_line) ? 0 : head + 1;
+        count++;
+
+        if (count >= sync_span)
+            on_candidate(count - sync_span);
+
+        if (started && count == line_start + samples_per_line) {
+            if (line_words) {
+                cut(line_words);
+                on_line(Line{line_words, line_synced, line_score});
+            }
+            line_start += samples_per_line;
+            line_synced = false;
+            line_score = 0.0f;
+        }
+    }
+
+    /* Where the words of the next line go, nullptr to skip it. */
+    void set_line_buffer(uint8_t* const words) {
+        line_words = words;
+    }
+
+    bool locked() const { return started && !searching; }
+
+   private:
+    static constexpr size_t sync_samples = sync_words * samples_per_word;
+    static constexpr size_t sync_b = sync_b_word * samples_per_word;
+    static constexpr size_t sync_span = sync_b + sync_samples;
+
+    // Mirrors its first sync_samples at the end: a sync is always in one piece.
+    std::array<uint8_t, samples_per_line + sync_samples> ring{};
+    size_t head{0};
+    // Samples so far; the sample numbers below count from the first one.
+    uint32_t count{0};
+
+    bool started{false};
+    bool searching{true};
+    uint32_t line_start{0};
+    bool line_synced{false};
+    float line_score{0.0f};
+    uint8_t* line_words{nullptr};
+
+    uint32_t best_start{0};
+    float best_score{-1.0f};
+    uint32_t searched{0};
+    uint32_t misses{0};
+    // First candidate of the next locked search window.
+    uint32_t window_begin{0};
+
+    template <bool (*white)(size_t)>
+    static float correlation(const uint8_t* const x) {
+        constexpr size_t n = sync_samples;
+        constexpr size_t n_white = [] {
+            size_t w = 0;
+            for (size_t i = 0; i < n; i++)
+                w += white(i / samples_per_word) ? 1 : 0;
+            return w;
+        }();
+
+        uint32_t sum = 0;
+        uint32_t sum_sq = 0;
+        uint32_t sum_white = 0;
+        for (size_t i = 0; i < n; i++) {
+            const uint32_t v = x[i];
+            sum += v;
+            sum_sq += v * v;
+            if (white(i / samples_per_word))
+                sum_white += v;
+        }
+
+        const float variance = float(n) * sum_sq - float(sum) * sum;
+        if (variance <= 0.0f)
+            return 0.0f;
+        constexpr float kernel_variance = float(n) * n_white - float(n_white) * n_white;
+        return (float(n) * sum_white - float(n_white) * sum) / std::sqrt(variance * kernel_variance);
+    }
+
+    /* Ring index of sample number 'sample', which must be one of the last
+     * samples_per_line. */
+    size_t index(const uint32_t sample) const {
+        const size_t back = count - sample;
+        return (head >= back) ? head - back : head + samples_per_line - back;
+    }
+
+    float score(const uint32_t start) const {
+        return 0.5f * (correlation<sync_a_white>(&ring[index(start)]) +
+                       correlation<sync_b_white>(&ring[index(start + sync_b)]));
+    }
+
+    void on_candidate(const uint32_t start) {
+        if (searching) {
+            const auto s = score(start);
+            if (s > best_score) {
+                best_score = s;
+                best_start = start;
+            }
+            if (++searched < samples_per_line)
+                return;
+
+            if (best_score >= threshold) {
+                // The next start of a line whose first sample is still here.
+                uint32_t next = best_start;
+                while (next + samples_per_line <= count)
+                    next += samples_per_line;
+                line_start = next;
+                line_synced = true;
+                line_score = best_score;
+                started = true;
+                searching = false;
+                misses = 0;
+                window_begin = line_start + samples_per_line - window;
+            }
+            searched = 0;
+            best_score = -1.0f;
+            return;
+        }
+
+        // Locked: the window around the start of the line being filled.
+        if (start < window_begin)
+            return;
+        const uint32_t expected = line_start;
+
+        const auto s = score(start);
+        if (s > best_score) {
+            best_score = s;
+            best_start = start;
+        }
+        if (start < expected + window)
+            return;
+
+        if (best_score >= threshold) {
+            line_start = best_start;
+            line_synced = true;
+            line_score = best_score;
+            misses = 0;
+        } else if (++misses >= max_misses) {
+            searching = true;
+            searched = 0;
+        }
+        best_score = -1.0f;
+        window_begin = line_start + samples_per_line - window;
+    }
+
+    void cut(uint8_t* const words) const {
+        size_t i = index(line_start);
+        for (size_t w = 0; w < words_per_line; w++) {
+            const uint32_t a = ring[i];
+            i = (i + 1 == samples_per_line) ? 0 : i + 1;
+            const uint32_t b = ring[i];
+            i = (i + 1 == samples_per_line) ? 0 : i + 1;
+            words[w] = (a + b + 1) / 2;
+        }
+    }
+};
+
+} /* namespace apt */
+} /* namespace dsp */
+
+#endif /*__DSP_APT_H__*/
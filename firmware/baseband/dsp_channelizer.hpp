@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __DSP_CHANNELIZER_H__
+#define __DSP_CHANNELIZER_H__
+
+#include "dsp_types.hpp"
+#include "dsp_fft.hpp"
+#include "complex.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+namespace dsp {
+namespace channelizer {
+
+/* Critically sampled polyphase analysis filter bank. Splits the input in
+ * N channels fs/N apart, each one low pass filtered and decimated by N.
+ * Channel c is centered on c * fs / N; like FFT bins, channels N/2..N-1
+ * are the negative offsets.
+ *
+ * The prototype low pass (P taps per channel, cut off half way to the
+ * next channel) is split in N branches. Every N input samples, each branch
+ * filters its own phase of the input and the channels are the DFT of the
+ * N branch outputs: channel() works out one of them with N multiplies,
+ * analyze() all of them with an FFT. */
+template <size_t N, size_t P = 4>
+class PolyphaseChannelizer {
+   public:
+    static_assert(power_of_two(N), "FFT size");
+    static_assert(power_of_two(P), "branch history is indexed with a mask");
+
+    static constexpr size_t channel_count = N;
+    static constexpr size_t taps_per_branch = P;
+
+    using Channels = std::array<std::complex<float>, N>;
+
+    PolyphaseChannelizer() {
+        design();
+    }
+
+    /* Calls on_block() after every N input samples, when channel() and
+     * analyze() give the output of that block. */
+    template <typename BlockHandler>
+    void execute(const buffer_c8_t& src, BlockHandler on_block) {
+        for (size_t i = 0; i < src.count; i++) {
+            // The last sample of a block goes to branch 0.
+            history[(N - 1 - fill) * P + head] = src.p[i];
+            if (++fill < N)
+                continue;
+
+            fill = 0;
+            filter_branches();
+            head = (head - 1) & (P - 1);
+            on_block();
+        }
+    }
+
+    std::complex<float> channel(const size_t c) const {
+        std::complex<float> sum{};
+        for (size_t p = 0, q = 0; p < N; p++, q = (q + c) & (N - 1))
+            sum += branch[p] * twiddle[q];
+        return sum;
+    }
+
+    /* channel() of every channel at once. */
+    void analyze(Channels& out) const {
+        for (size_t i = 0; i < N; i++)
+            out[i] = branch[fft_order[i]];
+        fft_c_preswapped(out, 0, log_2(N));
+    }
+
+   private:
+    // Branch-major: history[p * P + k] is branch p, k blocks ago (ring
+    // indexed from 'head').
+    std::array<complex8_t, N * P> history{};
+    std::array<float, N * P> taps{};
+    Channels branch{};
+    Channels twiddle{};
+    std::array<uint16_t, N> fft_order{};
+    size_t fill{0};
+    size_t head{0};
+
+    void filter_branches() {
+        for (size_t p = 0; p < N; p++) {
+            const auto* const h = &taps[p * P];
+            const auto* const x = &history[p * P];
+            float re = 0.0f;
+            float im = 0.0f;
+            for (size_t k = 0; k < P; k++) {
+                const auto s = x[(head + k) & (P - 1)];
+                re += h[k] * s.real();
+                im += h[k] * s.imag();
+            }
+            branch[p] = {re, im};
+        }
+    }
+
+    /* Hamming windowed sinc, normalized for unity gain at the center of
+     * every channel. */
+    void design() {
+        constexpr size_t length = N * P;
+        constexpr float pi = 3.14159265358979323846f;
+        constexpr float cutoff = 0.5f / N;  // Cycles per sample.
+
+        float sum = 0.0f;
+        for (size_t n = 0; n < length; n++) {
+            const float t = n - (length - 1) / 2.0f;
+            const float x = 2.0f * pi * cutoff * t;
+            const float sinc = (t == 0.0f) ? 1.0f : std::sin(x) / x;
+            const float window = 0.54f - 0.46f * std::cos(2.0f * pi * n / (length - 1));
+            // Tap n goes to branch n % N.
+            auto& tap = taps[(n % N) * P + n / N];
+            tap = sinc * window;
+            sum += tap;
+        }
+        for (auto& tap : taps)
+            tap /= sum;
+
+        for (size_t q = 0; q < N; q++)
+            twiddle[q] = std::polar(1.0f, 2.0f * pi * q / N);
+
+        // The channels need the DFT with the positive exponent, which is
+        // the forward FFT of the branch outputs in reverse order. The FFT
+        // takes its input in bit reversed order on top of that.
+        for (size_t p = 0; p < N; p++) {
+            size_t p_rev = 0;
+            for (size_t bit = 1; bit < N; bit <<= 1)
+                p_rev = (p_rev << 1) | ((p & bit) ? 1 : 0);
+            fft_order[p_rev] = (N - p) & (N - 1);
+        }
+    }
+};
+
+} /* namespace channelizer */
+} /* namespace dsp */
+
+#endif /*__DSP_CHANNELIZER_H__*/
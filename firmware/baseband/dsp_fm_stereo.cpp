@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "dsp_fm_stereo.hpp"
+
+#include "sine_table.hpp"
+
+#include <cmath>
+
+namespace dsp {
+namespace demodulate {
+
+namespace {
+
+constexpr float phase_scale = 4294967296.0f;  // 2^32 phase units per cycle
+constexpr float radians_to_phase = phase_scale / (2.0f * pi);
+
+int16_t saturate_s16(const float value) {
+    if (value > 32767.0f) return 32767;
+    if (value < -32768.0f) return -32768;
+    return static_cast<int16_t>(value);
+}
+
+/* sin(phase) from the 256 entry table with linear interpolation.
+ * Top 8 bits index the table, next 16 bits are the fraction. */
+inline float sin_phase(const uint32_t phase) {
+    const uint32_t n = phase >> 24;
+    const float frac = ((phase >> 8) & 0xffff) * (1.0f / 65536.0f);
+    const float p0 = sine_table_f32[n];
+    return p0 + frac * (sine_table_f32[n + 1] - p0);
+}
+
+}  // namespace
+
+void FMStereo::configure(const uint32_t new_sampling_rate, const float new_subcarrier_gain) {
+    sampling_rate = new_sampling_rate;
+    subcarrier_gain = new_subcarrier_gain;
+    phase_inc_nominal = pilot_frequency / sampling_rate * phase_scale;
+    reset();
+}
+
+void FMStereo::reset() {
+    phase = 0;
+    phase_inc_offset = 0.0f;
+    level = 0.0f;
+    locked = false;
+    loop_block_size = 0;
+}
+
+buffer_s16_t FMStereo::execute(
+    const buffer_s16_t& src,
+    const buffer_s16_t& dst) {
+    if (sampling_rate == 0) {
+        return {dst.p, src.count, src.sampling_rate};
+    }
+
+    /* Loop gains depend on how often the loop is updated, so recompute
+     * them only if the block size ever changes. */
+    if (src.count != loop_block_size) {
+        loop_block_size = src.count;
+        const float wn_t = 2.0f * pi * loop_bandwidth * loop_block_size / sampling_rate;
+        loop_kp = 2.0f * loop_damping * wn_t * radians_to_phase;
+        loop_ki = wn_t * wn_t * radians_to_phase / loop_block_size;
+    }
+
+    const uint32_t phase_inc = phase_inc_nominal + static_cast<int32_t>(phase_inc_offset);
+    /* x * sin(2θ) = x * 2 * sin(θ) * cos(θ). This yields (L-R)/2, which
+     * leaves headroom for a full scale MPX; matrix() puts the 2 back. */
+    const float mix_gain = 2.0f * subcarrier_gain;
+
+    float i_sum = 0.0f;
+    float q_sum = 0.0f;
+    auto p = phase;
+
+    for (size_t n = 0; n < src.count; n++) {
+        const float x = src.p[n];
+        const float s = sin_phase(p);
+        const float c = sin_phase(p + 0x40000000);
+
+        i_sum += x * s;
+        q_sum += x * c;
+        dst.p[n] = saturate_s16(x * s * c * mix_gain);
+
+        p += phase_inc;
+    }
+    phase = p;
+
+    update_loop(src.count, i_sum, q_sum);
+
+    return {dst.p, src.count, src.sampling_rate};
+}
+
+void FMStereo::update_loop(const size_t count, const float i_sum, const float q_sum) {
+    /* Pilot A * sin(φ) against NCO sin(θ):
+     *   i = A * cos(φ - θ), q = A * sin(φ - θ) after scaling by 2/N.
+     * Normalizing by |i| + |q| keeps loop gain independent of deviation. */
+    const float norm = 2.0f / (count * 32768.0f);
+    const float i = i_sum * norm;
+    const float q = q_sum * norm;
+
+    const float magnitude = std::fabs(i) + std::fabs(q);
+    if (magnitude > 1e-6f) {
+        const float error = q / magnitude;
+        phase += static_cast<int32_t>(error * loop_kp);
+        phase_inc_offset += error * loop_ki;
+    }
+
+    /* Keep the NCO from wandering off when there's no pilot at all. */
+    const float max_offset = 100.0f / sampling_rate * phase_scale;
+    if (phase_inc_offset > max_offset) phase_inc_offset = max_offset;
+    if (phase_inc_offset < -max_offset) phase_inc_offset = -max_offset;
+
+    level += (i - level) * 0.05f;
+    if (locked) {
+        locked = level > unlock_level;
+    } else {
+        locked = level > lock_level;
+    }
+}
+
+void FMStereo::matrix(
+    const buffer_s16_t& sum,
+    const buffer_s16_t& diff) const {
+    if (!locked) {
+        for (size_t n = 0; n < sum.count; n++) {
+            diff.p[n] = sum.p[n];
+        }
+        return;
+    }
+
+    for (size_t n = 0; n < sum.count; n++) {
+        const int32_t m = sum.p[n];
+        const int32_t s = diff.p[n];
+        const int32_t left = m + 2 * s;
+        const int32_t right = m - 2 * s;
+        sum.p[n] = (left > 32767) ? 32767 : ((left < -32768) ? -32768 : left);
+        diff.p[n] = (right > 32767) ? 32767 : ((right < -32768) ? -32768 : right);
+    }
+}
+
+} /* namespace demodulate */
+} /* namespace dsp */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __DSP_FM_STEREO_H__
+#define __DSP_FM_STEREO_H__
+
+#include "dsp_types.hpp"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace dsp {
+namespace demodulate {
+
+/* Broadcast FM stereo multiplex decoder.
+ *
+ * Locks a PLL to the 19kHz pilot tone and uses the doubled pilot phase to
+ * bring the 38kHz DSB-SC L-R subcarrier down to baseband. The L+R (mono)
+ * signal is not touched here, so the mono audio path can be shared and only
+ * the L-R product needs its own decimation chain.
+ *
+ * The loop filter runs once per block, which is plenty for a pilot that only
+ * drifts with the sample clock and saves a multiply-accumulate per sample.
+ */
+class FMStereo {
+   public:
+    /* subcarrier_gain compensates for any droop the 38kHz subcarrier saw
+     * in the decimation filters ahead of this block. */
+    void configure(const uint32_t sampling_rate, const float subcarrier_gain = 1.0f);
+    void reset();
+
+    /* MPX in, (L-R)/2 at baseband out (same sampling rate, still needs
+     * lowpass filtering/decimation). src and dst may be the same buffer. */
+    buffer_s16_t execute(
+        const buffer_s16_t& src,
+        const buffer_s16_t& dst);
+
+    /* Dematrixes decimated L+R (sum) and (L-R)/2 (diff) in place:
+     * sum becomes left, diff becomes right. Falls back to mono when
+     * the pilot is not locked. */
+    void matrix(
+        const buffer_s16_t& sum,
+        const buffer_s16_t& diff) const;
+
+    bool pilot_locked() const {
+        return locked;
+    }
+
+    float pilot_level() const {
+        return level;
+    }
+
+   private:
+    static constexpr float pilot_frequency = 19000.0f;
+    static constexpr float loop_bandwidth = 20.0f;
+    static constexpr float loop_damping = 0.707f;
+    static constexpr float lock_level = 0.015f;
+    static constexpr float unlock_level = 0.008f;
+
+    uint32_t sampling_rate{0};
+    float subcarrier_gain{1.0f};
+
+    uint32_t phase{0};
+    uint32_t phase_inc_nominal{0};
+    float phase_inc_offset{0.0f};
+    float loop_kp{0.0f};
+    float loop_ki{0.0f};
+    size_t loop_block_size{0};
+
+    float level{0.0f};
+    bool locked{false};
+
+    void update_loop(const size_t count, const float i_sum, const float q_sum);
+};
+
+} /* namespace demodulate */
+} /* namespace dsp */
+
+#endif /*__DSP_FM_STEREO_H__*/
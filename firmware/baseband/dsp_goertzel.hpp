@@ -25,6 +25,13 @@
 
 #include "dsp_types.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
 namespace dsp {
 
 class GoertzelDetector {
@@ -38,6 +45,157 @@ class GoertzelDetector {
     int16_t s[3]{0};
 };
 
+/* Goertzel filters for N frequencies, all run in one pass over the input.
+ *
+ * The input is cut into blocks of 'block_size' samples. At the end of each
+ * block every filter yields that block's DFT bin at its frequency, and the
+ * bins of the last 'Blocks' blocks are summed with the phase shift between
+ * blocks. This gives the DFT bin over a window of Blocks * block_size
+ * samples that slides by one block at a time, for N multiplies a sample.
+ *
+ * The confidence of a frequency is the part of the window energy found at
+ * that frequency: about 1 for a clean tone, 0 for a missing one. Speech or
+ * noise on top of a tone lowers it. */
+template <size_t N, size_t Blocks = 4>
+class GoertzelBank {
+   public:
+    static constexpr size_t frequency_count = N;
+
+    struct Detection {
+        size_t index;
+        float confidence;
+    };
+
+    GoertzelBank(const std::array<float, N>& frequencies, const uint32_t sample_rate, const size_t block_size)
+        : block_size{block_size} {
+        constexpr float pi = 3.14159265358979323846f;
+        for (size_t i = 0; i < N; i++) {
+            const float w = 2.0f * pi * frequencies[i] / sample_rate;
+            coefficient[i] = 2.0f * std::cos(w);
+            rotation[i] = std::polar(1.0f, -w);
+            block_rotation[i] = std::polar(1.0f, -w * block_size);
+        }
+    }
+
+    /* Calls on_window() at the end of every block once a full window is in,
+     * when confidence() and best() give the results for that window. */
+    template <typename WindowHandler>
+    void execute(const buffer_f32_t& src, WindowHandler on_window) {
+        for (size_t n = 0; n < src.count; n++) {
+            const float x = src.p[n];
+            energy += x * x;
+            for (size_t i = 0; i < N; i++) {
+                const float s0 = x + coefficient[i] * s1[i] - s2[i];
+                s2[i] = s1[i];
+                s1[i] = s0;
+            }
+
+            if (++fill < block_size)
+                continue;
+
+            end_block();
+            if (blocks_in < Blocks)
+                blocks_in++;
+            if (blocks_in == Blocks) {
+                sum_window();
+                on_window();
+            }
+        }
+    }
+
+    float confidence(const size_t i) const {
+        return window_power[i];
+    }
+
+    Detection best() const {
+        Detection result{0, window_power[0]};
+        for (size_t i = 1; i < N; i++) {
+            if (window_power[i] > result.confidence)
+                result = {i, window_power[i]};
+        }
+        return result;
+    }
+
+    void reset() {
+        s1 = {};
+        s2 = {};
+        fill = 0;
+        energy = 0.0f;
+        blocks_in = 0;
+    }
+
+   private:
+    const size_t block_size;
+    std::array<float, N> coefficient{};
+    std::array<std::complex<float>, N> rotation{};        // e^-jw
+    std::array<std::complex<float>, N> block_rotation{};  // e^-jw*block_size
+    std::array<float, N> s1{};
+    std::array<float, N> s2{};
+    size_t fill{0};
+    float energy{0.0f};
+
+    // Bins and energy of the last blocks, 'head' is the newest.
+    std::array<std::array<std::complex<float>, N>, Blocks> bins{};
+    std::array<float, Blocks> block_energy{};
+    size_t head{0};
+    size_t blocks_in{0};
+    std::array<float, N> window_power{};
+
+    /* The bin up to a phase common to all blocks: s1 - e^-jw * s2. */
+    void end_block() {
+        head = (head + 1) % Blocks;
+        for (size_t i = 0; i < N; i++) {
+            bins[head][i] = s1[i] - rotation[i] * s2[i];
+            s1[i] = 0.0f;
+            s2[i] = 0.0f;
+        }
+        block_energy[head] = energy;
+        energy = 0.0f;
+        fill = 0;
+    }
+
+    /* Block j of the window is shifted by j blocks from the oldest one:
+     * Horner's rule over the blocks, newest first. */
+    void sum_window() {
+        float total = 0.0f;
+        for (const auto e : block_energy)
+            total += e;
+        // A tone of amplitude A has A^2 * L / 2 energy in L samples, and
+        // a bin magnitude of A * L / 2.
+        const float scale = (total > 0.0f) ? 2.0f / (total * block_size * Blocks) : 0.0f;
+
+        for (size_t i = 0; i < N; i++) {
+            std::complex<float> sum{};
+            for (size_t k = Blocks; k > 0; k--)
+                sum = sum * block_rotation[i] + bins[(head + k) % Blocks][i];
+            window_power[i] = std::min(std::norm(sum) * scale, 1.0f);
+        }
+    }
+};
+
+/* DTMF row frequencies then column frequencies. */
+constexpr std::array<float, 8> dtmf_frequencies{697, 770, 852, 941, 1209, 1336, 1477, 1633};
+
+/* The key whose row and column tones make up most of the window, with
+ * neither more than about 7dB below the other, or 0. */
+template <size_t Blocks>
+char dtmf_key(const GoertzelBank<8, Blocks>& bank) {
+    static constexpr char keys[4][5] = {"123A", "456B", "789C", "*0#D"};
+
+    size_t row = 0;
+    size_t column = 4;
+    for (size_t i = 1; i < 4; i++) {
+        if (bank.confidence(i) > bank.confidence(row)) row = i;
+        if (bank.confidence(i + 4) > bank.confidence(column)) column = i + 4;
+    }
+
+    const float r = bank.confidence(row);
+    const float c = bank.confidence(column);
+    if (r + c < 0.7f || r < 0.2f * c || c < 0.2f * r)
+        return 0;
+    return keys[row][column - 4];
+}
+
 } /* namespace dsp */
 
 #endif /*__DSP_GOERTZEL_H__*/
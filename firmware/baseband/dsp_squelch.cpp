@@ -48,6 +48,24 @@ bool FMSquelch::execute(const buffer_f32_t& audio) {
     return (non_audio_max_squared < threshold_squared);
 }
 
+bool FMSquelch::execute(const buffer_s16_t& audio) {
+    if (threshold_squared == 0.0f) {
+        return true;
+    }
+
+    // Same as above, but converts and filters one sample at a time instead of via a temp buffer.
+    float non_audio_max_squared = 0;
+    for (size_t i = 0; i < audio.count; ++i) {
+        const auto sample = non_audio_hpf.execute(audio.p[i] * (1.0f / 32768.0f));
+        const float sample_squared = sample * sample;
+
+        if (sample_squared > non_audio_max_squared)
+            non_audio_max_squared = sample_squared;
+    }
+
+    return (non_audio_max_squared < threshold_squared);
+}
+
 void FMSquelch::set_threshold(const float new_value) {
     threshold_squared = new_value * new_value;
 }
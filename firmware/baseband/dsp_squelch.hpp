@@ -34,6 +34,7 @@ class FMSquelch {
     /* Check if noise level is lower than threshold.
      * Returns true if noise is below threshold. */
     bool execute(const buffer_f32_t& audio);
+    bool execute(const buffer_s16_t& audio);
 
     void set_threshold(const float new_value);
     bool enabled() const;
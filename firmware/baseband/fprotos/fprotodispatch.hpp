@@ -0,0 +1,97 @@
+/*
+Batched edge dispatch for the protocol lists.
+
+Edges are collected in an FProtoEdgeBatch and classified once (level + log2 duration bucket) when they are pushed.
+Each decoder can declare the edges that are able to take it out of its reset step with setStartEnvelope(). While a
+decoder sits in reset, edges outside that envelope are not fed to it at all, which skips the virtual call and the state
+machine for the common case of most decoders idling through someone else's data bits. Decoders that don't declare an
+envelope are fed every edge, as before.
+
+Only declare an envelope if the reset step does nothing else for edges that don't match, otherwise skipping changes the
+decoder's behavior.
+*/
+
+#ifndef __FPROTO_DISPATCH_H__
+#define __FPROTO_DISPATCH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+struct FProtoEdge {
+    uint32_t duration;  // us
+    bool level;
+    uint8_t bucket;  // floor(log2(duration))
+};
+
+class FProtoEdgeBatch {
+   public:
+    static constexpr size_t capacity = 64;
+
+    static uint8_t bucket(uint32_t duration) {
+        return duration == 0 ? 0 : 31 - __builtin_clz(duration);
+    }
+
+    // Returns true when the batch is full and must be dispatched.
+    bool push(bool level, uint32_t duration) {
+        edges[count] = {duration, level, bucket(duration)};
+        return ++count == capacity;
+    }
+
+    void clear() { count = 0; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const FProtoEdge& operator[](size_t index) const { return edges[index]; }
+
+   private:
+    FProtoEdge edges[capacity];
+    size_t count = 0;
+};
+
+/* Set of (level, duration bucket) pairs that can start a decoder. Defaults to everything. */
+class FProtoStartEnvelope {
+   public:
+    // Edges with DURATION_DIFF(duration, center) < tolerance.
+    void set(bool level, uint32_t center, uint32_t tolerance) {
+        const uint32_t lo = center > tolerance ? center - tolerance : 0;
+        add(level, lo, center + tolerance);
+    }
+
+    // Edges with duration >= min.
+    void set_min(bool level, uint32_t min) {
+        add(level, min, UINT32_MAX);
+    }
+
+    bool matches(const FProtoEdge& edge) const {
+        return (masks[edge.level] >> edge.bucket) & 1;
+    }
+
+   private:
+    // The first set() replaces the default 'everything' envelope.
+    void add(bool level, uint32_t lo, uint32_t hi) {
+        if (!restricted) {
+            masks[0] = masks[1] = 0;
+            restricted = true;
+        }
+        const uint8_t first = FProtoEdgeBatch::bucket(lo);
+        const uint8_t last = FProtoEdgeBatch::bucket(hi);
+        for (uint8_t b = first; b <= last; ++b) masks[level] |= 1UL << b;
+    }
+
+    uint32_t masks[2] = {UINT32_MAX, UINT32_MAX};
+    bool restricted = false;
+};
+
+/* Feeds the batch to every decoder, decoder by decoder so each one's state stays hot while it runs over the batch. */
+template <typename Proto, size_t N>
+void fproto_dispatch(Proto* const (&protos)[N], const FProtoEdgeBatch& batch) {
+    for (size_t i = 0; i < N; ++i) {
+        Proto* const proto = protos[i];
+        if (proto == NULL) continue;
+        for (size_t n = 0; n < batch.size(); ++n) {
+            const FProtoEdge& edge = batch[n];
+            if (proto->wakes_on(edge)) proto->feed(edge.level, edge.duration);
+        }
+    }
+}
+
+#endif
@@ -1,12 +1,14 @@
 #ifndef __FPROTO_PROTOLISTGENERAL_H__
 #define __FPROTO_PROTOLISTGENERAL_H__
 #include <stdint.h>
+#include "fprotodispatch.hpp"
 
 class FProtoListGeneral {
    public:
     FProtoListGeneral() {}
     virtual ~FProtoListGeneral() {}
     virtual void feed(bool level, uint32_t duration) = 0;
+    virtual void feed(const FProtoEdgeBatch& batch) = 0;
     void setModulation(uint8_t modulation) { modulation_ = modulation; }
 
    protected:
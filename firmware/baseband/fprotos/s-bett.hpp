@@ -18,6 +18,7 @@ class FProtoSubGhzDBett : public FProtoSubGhzDBase {
         te_long = 2000;
         te_delta = 150;
         min_count_bit_for_found = 18;
+        start_envelope.set(false, te_short * 44, te_delta * 15);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -24,6 +24,7 @@ class FProtoSubGhzDCame : public FProtoSubGhzDBase {
         te_long = 640;
         te_delta = 150;
         min_count_bit_for_found = 12;
+        start_envelope.set(false, te_short * 56, te_delta * 47);
     }
 
     void feed(bool level, uint32_t duration) {
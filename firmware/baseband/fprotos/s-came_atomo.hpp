@@ -17,6 +17,7 @@ class FProtoSubGhzDCameAtomo : public FProtoSubGhzDBase {
         te_long = 1200;
         te_delta = 250;
         min_count_bit_for_found = 62;
+        start_envelope.set(false, te_long * 60, te_delta * 40);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -17,6 +17,7 @@ class FProtoSubGhzDCameTwee : public FProtoSubGhzDBase {
         te_long = 1000;
         te_delta = 250;
         min_count_bit_for_found = 54;
+        start_envelope.set(false, te_long * 51, te_delta * 20);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -31,6 +31,7 @@ class FProtoSubGhzDChambCode : public FProtoSubGhzDBase {
         te_long = 3000;
         te_delta = 200;
         min_count_bit_for_found = 10;
+        start_envelope.set(false, te_short * 39, te_delta * 20);
     }
 
     void feed(bool level, uint32_t duration) {
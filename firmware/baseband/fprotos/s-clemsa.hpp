@@ -18,6 +18,7 @@ class FProtoSubGhzDClemsa : public FProtoSubGhzDBase {
         te_long = 2695;
         te_delta = 150;
         min_count_bit_for_found = 18;
+        start_envelope.set(false, te_short * 51, te_delta * 25);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -19,6 +19,7 @@ class FProtoSubGhzDDoitrand : public FProtoSubGhzDBase {
         te_long = 1100;
         te_delta = 150;
         min_count_bit_for_found = 37;
+        start_envelope.set(false, te_short * 62, te_delta * 30);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -19,6 +19,7 @@ class FProtoSubGhzDDooya : public FProtoSubGhzDBase {
         te_long = 733;
         te_delta = 120;
         min_count_bit_for_found = 40;
+        start_envelope.set(false, te_long * 12, te_delta * 20);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -19,6 +19,7 @@ class FProtoSubGhzDFaac : public FProtoSubGhzDBase {
         te_long = 595;
         te_delta = 100;
         min_count_bit_for_found = 64;
+        start_envelope.set(true, te_long * 2, te_delta * 3);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -18,6 +18,7 @@ class FProtoSubGhzDGangqi : public FProtoSubGhzDBase {
         te_long = 1200;
         te_delta = 200;
         min_count_bit_for_found = 34;
+        start_envelope.set(false, te_long * 2, te_delta * 3);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -19,6 +19,7 @@ class FProtoSubGhzDGateTx : public FProtoSubGhzDBase {
         te_long = 700;
         te_delta = 100;
         min_count_bit_for_found = 24;
+        start_envelope.set(false, te_short * 47, te_delta * 47);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -22,6 +22,7 @@ class FProtoSubGhzDHoltek : public FProtoSubGhzDBase {
         te_long = 870;
         te_delta = 100;
         min_count_bit_for_found = 40;
+        start_envelope.set(false, te_short * 36, te_delta * 36);
     }
 
     void feed(bool level, uint32_t duration) {
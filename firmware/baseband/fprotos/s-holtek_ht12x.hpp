@@ -19,6 +19,7 @@ class FProtoSubGhzDHoltekHt12x : public FProtoSubGhzDBase {
         te_long = 640;
         te_delta = 200;
         min_count_bit_for_found = 12;
+        start_envelope.set(false, te_short * 36, te_delta * 36);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -19,6 +19,7 @@ class FProtoSubGhzDHoneywellWdb : public FProtoSubGhzDBase {
         te_long = 320;
         te_delta = 61;
         min_count_bit_for_found = 48;
+        start_envelope.set(false, te_short * 3, te_delta);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -23,6 +23,7 @@ class FProtoSubGhzDHormann : public FProtoSubGhzDBase {
         te_long = 1000;
         te_delta = 200;
         min_count_bit_for_found = 44;
+        start_envelope.set(true, te_short * 24, te_delta * 24);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -19,6 +19,7 @@ class FProtoSubGhzDIdo : public FProtoSubGhzDBase {
         te_long = 1450;
         te_delta = 150;
         min_count_bit_for_found = 48;
+        start_envelope.set(true, te_short * 10, te_delta * 5);
     }
 
     void feed(bool level, uint32_t duration) {
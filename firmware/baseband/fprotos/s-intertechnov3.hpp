@@ -24,6 +24,7 @@ class FProtoSubGhzDIntertechnoV3 : public FProtoSubGhzDBase {
         te_long = 1375;
         te_delta = 150;
         min_count_bit_for_found = 32;
+        start_envelope.set(false, te_short * 37, te_delta * 15);
     }
 
     void feed(bool level, uint32_t duration) {
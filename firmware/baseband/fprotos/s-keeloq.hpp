@@ -19,6 +19,7 @@ class FProtoSubGhzDKeeLoq : public FProtoSubGhzDBase {
         te_long = 800;
         te_delta = 140;
         min_count_bit_for_found = 64;
+        start_envelope.set(true, te_short, te_delta);
     }
 
     void feed(bool level, uint32_t duration) {
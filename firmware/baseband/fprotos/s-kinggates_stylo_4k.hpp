@@ -20,6 +20,7 @@ class FProtoSubGhzDKinggatesStylo4K : public FProtoSubGhzDBase {
         te_long = 1100;
         te_delta = 140;
         min_count_bit_for_found = 89;
+        start_envelope.set(true, te_short, te_delta);
     }
 
     void feed(bool level, uint32_t duration) {
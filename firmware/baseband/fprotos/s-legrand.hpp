@@ -19,6 +19,7 @@ class FProtoSubGhzDLegrand : public FProtoSubGhzDBase {
         te_long = 1125;
         te_delta = 150;
         min_count_bit_for_found = 18;
+        start_envelope.set(false, te_short * 16, te_delta * 8);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -18,6 +18,7 @@ class FProtoSubGhzDLinear : public FProtoSubGhzDBase {
         te_long = 1500;
         te_delta = 150;
         min_count_bit_for_found = 10;
+        start_envelope.set(false, te_short * 42, te_delta * 20);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -18,6 +18,7 @@ class FProtoSubGhzDLinearDelta3 : public FProtoSubGhzDBase {
         te_long = 2000;
         te_delta = 150;
         min_count_bit_for_found = 8;
+        start_envelope.set(false, te_short * 70, te_delta * 24);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -20,6 +20,7 @@ class FProtoSubGhzDMagellan : public FProtoSubGhzDBase {
         te_long = 400;
         te_delta = 100;
         min_count_bit_for_found = 32;
+        start_envelope.set(true, te_short, te_delta);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -18,6 +18,7 @@ class FProtoSubGhzDMarantec : public FProtoSubGhzDBase {
         te_long = 2000;
         te_delta = 200;
         min_count_bit_for_found = 49;
+        start_envelope.set(false, te_long * 5, te_delta * 8);
     }
 
     void feed(bool level, uint32_t duration) {
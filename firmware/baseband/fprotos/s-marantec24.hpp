@@ -18,6 +18,7 @@ class FProtoSubGhzDMarantec24 : public FProtoSubGhzDBase {
         te_long = 1600;
         te_delta = 200;
         min_count_bit_for_found = 24;
+        start_envelope.set(false, te_long * 9, te_delta * 4);
     }
 
     void feed(bool level, uint32_t duration) {
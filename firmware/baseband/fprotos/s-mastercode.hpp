@@ -18,6 +18,7 @@ class FProtoSubGhzDMastercode : public FProtoSubGhzDBase {
         te_long = 2145;
         te_delta = 150;
         min_count_bit_for_found = 36;
+        start_envelope.set(false, te_short * 15, te_delta * 15);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -19,6 +19,7 @@ class FProtoSubGhzDMegacode : public FProtoSubGhzDBase {
         te_long = 1000;
         te_delta = 200;
         min_count_bit_for_found = 24;
+        start_envelope.set(false, te_short * 13, te_delta * 17);
     }
 
     void feed(bool level, uint32_t duration) {
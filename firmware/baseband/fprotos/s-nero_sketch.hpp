@@ -19,6 +19,7 @@ class FProtoSubGhzDNeroSketch : public FProtoSubGhzDBase {
         te_long = 660;
         te_delta = 150;
         min_count_bit_for_found = 40;
+        start_envelope.set(true, te_short, te_delta);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -19,6 +19,7 @@ class FProtoSubGhzDNeroRadio : public FProtoSubGhzDBase {
         te_long = 400;
         te_delta = 80;
         min_count_bit_for_found = 56;
+        start_envelope.set(true, te_short, te_delta);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -22,6 +22,7 @@ class FProtoSubGhzDNiceflors : public FProtoSubGhzDBase {
         te_long = 1000;
         te_delta = 300;
         min_count_bit_for_found = 52;
+        start_envelope.set(false, te_short * 38, te_delta * 38);
     }
 
     void feed(bool level, uint32_t duration) {
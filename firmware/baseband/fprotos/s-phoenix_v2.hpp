@@ -19,6 +19,7 @@ class FProtoSubGhzDPhoenixV2 : public FProtoSubGhzDBase {
         te_long = 853;
         te_delta = 100;
         min_count_bit_for_found = 52;
+        start_envelope.set(false, te_short * 60, te_delta * 30);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -18,6 +18,7 @@ class FProtoSubGhzDPrinceton : public FProtoSubGhzDBase {
         te_long = 1170;
         te_delta = 300;
         min_count_bit_for_found = 24;
+        start_envelope.set(false, te_short * 36, te_delta * 36);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -32,6 +32,7 @@ class FProtoSubGhzDSecPlusV1 : public FProtoSubGhzDBase {
         te_long = 1500;
         te_delta = 100;
         min_count_bit_for_found = 21;
+        start_envelope.set(false, te_short * 120, te_delta * 120);
     }
 
     void feed(bool level, uint32_t duration) {
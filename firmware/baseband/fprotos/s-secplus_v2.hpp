@@ -23,6 +23,7 @@ class FProtoSubGhzDSecPlusV2 : public FProtoSubGhzDBase {
         te_long = 500;
         te_delta = 110;
         min_count_bit_for_found = 62;
+        start_envelope.set(false, te_long * 130, te_delta * 100);
     }
 
     void feed(bool level, uint32_t duration) {
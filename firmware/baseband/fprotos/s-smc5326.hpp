@@ -18,6 +18,7 @@ class FProtoSubGhzDSmc5326 : public FProtoSubGhzDBase {
         te_long = 900;
         te_delta = 200;
         min_count_bit_for_found = 25;
+        start_envelope.set(false, te_short * 24, te_delta * 12);
     }
 
     void feed(bool level, uint32_t duration) {
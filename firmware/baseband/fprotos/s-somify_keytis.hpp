@@ -20,6 +20,7 @@ class FProtoSubGhzDSomifyKeytis : public FProtoSubGhzDBase {
         te_long = 1280;
         te_delta = 250;
         min_count_bit_for_found = 80;
+        start_envelope.set(true, te_short * 4, te_delta * 4);
     }
 
     void feed(bool level, uint32_t duration) {
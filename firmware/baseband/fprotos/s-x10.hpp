@@ -19,6 +19,7 @@ class FProtoSubGhzDX10 : public FProtoSubGhzDBase {
         te_long = 1800;
         te_delta = 100;
         min_count_bit_for_found = 32;
+        start_envelope.set(true, te_short * 16, te_delta * 7);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -8,6 +8,7 @@ For comments in a protocol implementation check w-nexus-th.hpp
 #define __FPROTO_SBASE_H__
 
 #include "fprotogeneral.hpp"
+#include "fprotodispatch.hpp"
 #include "subghztypes.hpp"
 
 #include <string>
@@ -22,6 +23,7 @@ class FProtoSubGhzDBase {
     virtual ~FProtoSubGhzDBase() {}
     virtual void feed(bool level, uint32_t duration) = 0;                         // need to be implemented on each protocol handler.
     void setCallback(SubGhzDProtocolDecoderBaseRxCallback cb) { callback = cb; }  // this is called when there is a hit.
+    bool wakes_on(const FProtoEdge& edge) const { return parser_step != 0 || start_envelope.matches(edge); }  // false if feeding the edge can't change anything.
 
     // General data holder, these will be passed
     uint8_t sensorType = FPS_Invalid;
@@ -40,6 +42,7 @@ class FProtoSubGhzDBase {
     uint32_t te_long = UINT32_MAX;
     uint32_t te_delta = UINT32_MAX;
     uint32_t min_count_bit_for_found = UINT32_MAX;
+    FProtoStartEnvelope start_envelope{};  // edges that can leave the reset step, see fprotodispatch.hpp
 
     SubGhzDProtocolDecoderBaseRxCallback callback = NULL;
 
@@ -133,6 +133,12 @@ class SubGhzDProtos : public FProtoListGeneral {
         }
     }
 
+    void feed(const FProtoEdgeBatch& batch) {
+        fproto_dispatch(protos, batch);
+    }
+
+    FProtoSubGhzDBase* proto(uint8_t index) const { return index < FPS_COUNT ? protos[index] : NULL; }
+
    protected:
     FProtoSubGhzDBase* protos[FPS_COUNT] = {NULL};
 };
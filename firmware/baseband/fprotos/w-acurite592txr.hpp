@@ -15,6 +15,7 @@ class FProtoWeatherAcurite592TXR : public FProtoWeatherBase {
    public:
     FProtoWeatherAcurite592TXR() {
         sensorType = FPW_Acurite592TXR;
+        start_envelope.set(true, te_short * 3, te_delta * 2);
     }
 
     void feed(bool level, uint32_t duration) {
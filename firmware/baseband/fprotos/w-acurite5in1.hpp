@@ -15,6 +15,7 @@ class FProtoWeatherAcurite5in1 : public FProtoWeatherBase {
    public:
     FProtoWeatherAcurite5in1() {
         sensorType = FPW_Acurite5in1;
+        start_envelope.set(true, te_short * 3, te_delta * 2);
     }
 
     void feed(bool level, uint32_t duration) {
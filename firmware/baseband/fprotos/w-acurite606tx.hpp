@@ -14,6 +14,7 @@ class FProtoWeatherAcurite606TX : public FProtoWeatherBase {
    public:
     FProtoWeatherAcurite606TX() {
         sensorType = FPW_Acurite606TX;
+        start_envelope.set(false, te_short * 17, te_delta * 8);
     }
 
     void feed(bool level, uint32_t duration) {
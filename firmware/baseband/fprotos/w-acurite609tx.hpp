@@ -14,6 +14,7 @@ class FProtoWeatherAcurite609TX : public FProtoWeatherBase {
    public:
     FProtoWeatherAcurite609TX() {
         sensorType = FPW_Acurite609TX;
+        start_envelope.set(false, te_short * 17, te_delta * 8);
     }
 
     void feed(bool level, uint32_t duration) {
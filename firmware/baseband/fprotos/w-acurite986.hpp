@@ -17,6 +17,7 @@ class FProtoWeatherAcurite986 : public FProtoWeatherBase {
    public:
     FProtoWeatherAcurite986() {
         sensorType = FPW_Acurite986;
+        start_envelope.set(false, te_long, te_delta * 15);
     }
 
     void feed(bool level, uint32_t duration) {
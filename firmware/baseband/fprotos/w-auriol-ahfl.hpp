@@ -16,6 +16,7 @@ class FProtoWeatherAuriolAhfl : public FProtoWeatherBase {
    public:
     FProtoWeatherAuriolAhfl() {
         sensorType = FPW_AuriolAhfl;
+        start_envelope.set(false, te_short * 18, te_delta);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -16,6 +16,7 @@ class FProtoWeatherAuriolTh : public FProtoWeatherBase {
    public:
     FProtoWeatherAuriolTh() {
         sensorType = FPW_AuriolTH;
+        start_envelope.set(false, te_short * 8, te_delta);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -23,6 +23,8 @@ class FProtoWeatheBresser3CH : public FProtoWeatherBase {
    public:
     FProtoWeatheBresser3CH() {
         sensorType = FPW_Bresser3CH;
+        start_envelope.set(true, te_short * 3, te_delta);
+        start_envelope.set_min(false, te_long);
     }
 
     void feed(bool level, uint32_t duration) {
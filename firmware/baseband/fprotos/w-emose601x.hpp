@@ -17,6 +17,7 @@ class FProtoWeatherEmosE601x : public FProtoWeatherBase {
    public:
     FProtoWeatherEmosE601x() {
         sensorType = FPW_EmosE601x;
+        start_envelope.set(true, te_short * 7, te_delta * 2);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -16,6 +16,7 @@ class FProtoWeatherGTWT02 : public FProtoWeatherBase {
    public:
     FProtoWeatherGTWT02() {
         sensorType = FPW_GTWT02;
+        start_envelope.set(false, te_short * 18, te_delta * 8);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -17,6 +17,7 @@ class FProtoWeatherGTWT03 : public FProtoWeatherBase {
    public:
     FProtoWeatherGTWT03() {
         sensorType = FPW_GTWT03;
+        start_envelope.set(true, te_short * 3, te_delta * 2);
     }
 
     void feed(bool level, uint32_t duration) {
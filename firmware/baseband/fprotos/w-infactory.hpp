@@ -15,6 +15,7 @@ class FProtoWeatherInfactory : public FProtoWeatherBase {
    public:
     FProtoWeatherInfactory() {
         sensorType = FPW_INFACTORY;
+        start_envelope.set(true, te_short * 2, te_delta * 2);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -15,6 +15,7 @@ class FProtoWeatherKedsum : public FProtoWeatherBase {
    public:
     FProtoWeatherKedsum() {
         sensorType = FPW_KEDSUM;
+        start_envelope.set(true, te_short, te_delta);
     }
 
     void feed(bool level, uint32_t duration) {
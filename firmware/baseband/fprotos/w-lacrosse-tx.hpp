@@ -21,6 +21,7 @@ class FProtoWeatherLaCrosseTx : public FProtoWeatherBase {
    public:
     FProtoWeatherLaCrosseTx() {
         sensorType = FPW_LACROSSETX;
+        start_envelope.set(false, LACROSSE_TX_GAP, te_delta * 2);
     }
 
     void feed(bool level, uint32_t duration) {
@@ -17,6 +17,7 @@ class FProtoWeatherLaCrosseTx141thbv2 : public FProtoWeatherBase {
    public:
     FProtoWeatherLaCrosseTx141thbv2() {
         sensorType = FPW_LACROSSETX141thbv2;
+        start_envelope.set(true, te_short * 4, te_delta * 2);
     }
 
     void feed(bool level, uint32_t duration) {
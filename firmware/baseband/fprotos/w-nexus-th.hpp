@@ -19,6 +19,7 @@ class FProtoWeatherNexusTH : public FProtoWeatherBase {
     FProtoWeatherNexusTH() {
         // must set it's value from the "weathertypes.hpp". getWeatherSensorTypeName() will work with this.
         sensorType = FPW_NexusTH;
+        start_envelope.set(false, te_short * 8, te_delta * 4);
     }
 
     // Here we will got a level and duration. eg HIGH (true) for 500. This function must be as fast as possible, to keep the core happy.
@@ -16,6 +16,7 @@ class FProtoWeatherOregonV1 : public FProtoWeatherBase {
    public:
     FProtoWeatherOregonV1() {
         sensorType = FPW_OREGONv1;
+        start_envelope.set(true, te_short, te_delta);
     }
 
     void feed(bool level, uint32_t duration) override {
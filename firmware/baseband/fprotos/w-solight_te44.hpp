@@ -14,6 +14,7 @@ class FProtoWeatherSolightTE44 : public FProtoWeatherBase {
    public:
     FProtoWeatherSolightTE44() {
         sensorType = FPW_SolightTE44;
+        start_envelope.set_min(false, te_long);
     }
 
     void feed(bool level, uint32_t duration) override {
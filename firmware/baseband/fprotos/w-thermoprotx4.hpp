@@ -16,6 +16,7 @@ class FProtoWeatherThermoProTx4 : public FProtoWeatherBase {
    public:
     FProtoWeatherThermoProTx4() {
         sensorType = FPW_THERMOPROTX4;
+        start_envelope.set(false, te_short * 18, te_delta * 10);
     }
 
     void feed(bool level, uint32_t duration) override {
@@ -15,6 +15,7 @@ class FProtoWeatherTX8300 : public FProtoWeatherBase {
    public:
     FProtoWeatherTX8300() {
         sensorType = FPW_TX_8300;
+        start_envelope.set(true, te_short * 2, te_delta);
     }
 
     void feed(bool level, uint32_t duration) override {
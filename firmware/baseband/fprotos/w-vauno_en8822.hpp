@@ -14,6 +14,7 @@ class FProtoWeatherVaunoEN8822 : public FProtoWeatherBase {
    public:
     FProtoWeatherVaunoEN8822() {
         sensorType = FPW_Vauno_EN8822;
+        start_envelope.set(false, te_long * 4, te_delta);
     }
 
     void feed(bool level, uint32_t duration) override {
@@ -14,6 +14,7 @@ class FProtoWeatherWendoxW6726 : public FProtoWeatherBase {
    public:
     FProtoWeatherWendoxW6726() {
         sensorType = FPW_WENDOX_W6726;
+        start_envelope.set(true, te_short, te_delta);
     }
 
     void feed(bool level, uint32_t duration) override {
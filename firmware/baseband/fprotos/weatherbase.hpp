@@ -8,6 +8,7 @@ For comments in a protocol implementation check w-nexus-th.hpp
 #define __FPROTO_BASE_H__
 
 #include "fprotogeneral.hpp"
+#include "fprotodispatch.hpp"
 #include "weathertypes.hpp"
 
 #include <string>
@@ -22,6 +23,7 @@ class FProtoWeatherBase {
     virtual ~FProtoWeatherBase() {}
     virtual void feed(bool level, uint32_t duration) = 0;                        // need to be implemented on each protocol handler.
     void setCallback(SubGhzProtocolDecoderBaseRxCallback cb) { callback = cb; }  // this is called when there is a hit.
+    bool wakes_on(const FProtoEdge& edge) const { return parser_step != 0 || start_envelope.matches(edge); }  // false if feeding the edge can't change anything.
 
     uint8_t getSensorType() { return sensorType; }
     uint64_t getData() { return decode_data; }
@@ -47,6 +49,7 @@ class FProtoWeatherBase {
     uint64_t decode_data = 0;
 
     SubGhzProtocolDecoderBaseRxCallback callback = NULL;
+    FProtoStartEnvelope start_envelope{};  // edges that can leave the reset step, see fprotodispatch.hpp
 };
 
 #endif
\ No newline at end of file
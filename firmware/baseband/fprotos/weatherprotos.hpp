@@ -99,6 +99,12 @@ class WeatherProtos : public FProtoListGeneral {
         }
     }
 
+    void feed(const FProtoEdgeBatch& batch) {
+        fproto_dispatch(protos, batch);
+    }
+
+    FProtoWeatherBase* proto(uint8_t index) const { return index < FPW_COUNT ? protos[index] : NULL; }
+
    protected:
     FProtoWeatherBase* protos[FPW_COUNT] = {NULL};
 };
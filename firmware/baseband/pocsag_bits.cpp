@@ -0,0 +1,295 @@
+/*
+ * Copyright (C) 1996 Thomas Sailer (sailer@ife.ee.ethz.ch, hb9jnx@hb9w.che.eu)
+ * Copyright (C) 2012-2014 Elias Oenal (multimon-ng@eliasoenal.com)
+ * Copyright (C) 2015 Jared Boone, ShareBrained Technology, Inc.
+ * Copyright (C) 2016 Furrtek
+ * Copyright (C) 2023 Kyle Reed
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "pocsag_bits.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+using namespace std;
+
+namespace {
+/* Count of bits that differ between the two values. */
+inline uint8_t diff_bit_count(uint32_t left, uint32_t right) {
+    return __builtin_popcount(left ^ right);
+}
+}  // namespace
+
+/* BitQueue **********************************************/
+
+void BitQueue::push(bool bit) {
+    data_ = (data_ << 1) | (bit ? 1 : 0);
+    if (count_ < max_size_) ++count_;
+}
+
+void BitQueue::push(uint32_t bits, uint8_t count) {
+    // Oldest (most significant) bit first, same as pushing one at a time.
+    data_ = (data_ << count) | (bits & ((1ull << count) - 1));
+    count_ = std::min<uint8_t>(count_ + count, max_size_);
+}
+
+bool BitQueue::pop() {
+    if (count_ == 0) return false;
+
+    --count_;
+    return (data_ & (1ull << count_)) != 0;
+}
+
+void BitQueue::reset() {
+    data_ = 0;
+    count_ = 0;
+}
+
+uint8_t BitQueue::size() const {
+    return count_;
+}
+
+uint32_t BitQueue::data() const {
+    return data_;
+}
+
+/* BitExtractor ******************************************/
+
+void BitExtractor::extract_bits(const buffer_f32_t& audio) {
+    // Assumes input has been normalized +/- 1.0f.
+    // Positive == 0, Negative == 1.
+    for (size_t i = 0; i < audio.count; ++i) {
+        auto sample = audio.p[i];
+
+        if (current_rate_) {
+            if (current_rate_->handle_sample(sample)) {
+                auto value = (current_rate_->bits.data() & 1) == 1;
+                bits_.push(value);
+            }
+        } else {
+            // Feed the sample to all known rates until one finds sync.
+            for (auto& rate : known_rates_) {
+                if (rate.handle_sample(sample)) {
+                    search(rate);
+                    if (current_rate_) break;
+                }
+            }
+        }
+    }
+}
+
+void BitExtractor::search(RateInfo& rate) {
+    const auto data = rate.bits.data();
+
+    if (!rate.is_stable) {
+        // Clock detected, sample this rate on the bit boundaries from now on.
+        rate.is_stable = diff_bit_count(data, clock_magic_number) <= 3;
+        return;
+    }
+
+    bool inverted = false;
+    if (CodewordExtractor::match_sync(data, inverted)) {
+        // Lock this rate and hand over the sync codeword so the
+        // CodewordExtractor starts the batch from the same bits.
+        current_rate_ = &rate;
+        bits_.push(data, 32);
+    }
+}
+
+void BitExtractor::configure(uint32_t sample_rate) {
+    sample_rate_ = sample_rate;
+
+    // Build the baud rate info table based on the sample rate.
+    // Sampling at 2x the baud rate to synchronize to bit transitions
+    // without needing to know exact transition boundaries.
+    for (auto& rate : known_rates_)
+        rate.sample_interval = sample_rate / (2.0 * rate.baud_rate);
+
+    if (baud_config_ >= 0 && baud_config_ < static_cast<int8_t>(known_rates_.size())) {
+        current_rate_ = &known_rates_[baud_config_];
+    } else {
+        current_rate_ = nullptr;
+    }
+}
+
+void BitExtractor::reset() {
+    for (auto& rate : known_rates_)
+        rate.reset();
+
+    if (baud_config_ >= 0 && baud_config_ < static_cast<int8_t>(known_rates_.size())) {
+        current_rate_ = &known_rates_[baud_config_];
+    } else {
+        current_rate_ = nullptr;
+    }
+}
+
+void BitExtractor::set_baud_config(int8_t baud_config) {
+    baud_config_ = baud_config;
+}
+
+uint16_t BitExtractor::baud_rate() const {
+    if (current_rate_)
+        return current_rate_->baud_rate;
+
+    for (const auto& rate : known_rates_) {
+        if (rate.is_stable)
+            return rate.baud_rate;
+    }
+
+    return 0;
+}
+
+bool BitExtractor::RateInfo::handle_sample(float sample) {
+    samples_until_next -= 1;
+
+    // Time to process a sample?
+    if (samples_until_next > 0)
+        return false;
+
+    bool value = signbit(sample);  // NB: negative == '1'
+    bool bit_pushed = false;
+
+    switch (state) {
+        case State::WaitForSample:
+            // Just need to wait for the first sample of the bit.
+            state = State::ReadyToSend;
+            break;
+
+        case State::ReadyToSend:
+            if (!is_stable && prev_value != value) {
+                // Still looking for the clock signal but found a transition.
+                // Nudge the next sample a bit to try avoiding pulse edges.
+                samples_until_next += (sample_interval / 8.0);
+            } else {
+                // Either the clock has been found or both samples were
+                // (probably) in the same pulse. Send the bit.
+                // TODO: Wider/more samples for noise reduction?
+                state = State::WaitForSample;
+                bit_pushed = true;
+                bits.push(value);
+            }
+            break;
+    }
+
+    // How long until the next sample?
+    samples_until_next += sample_interval;
+    prev_value = value;
+
+    return bit_pushed;
+}
+
+void BitExtractor::RateInfo::reset() {
+    state = State::WaitForSample;
+    samples_until_next = 0.0;
+    prev_value = false;
+    is_stable = false;
+    bits.reset();
+}
+
+/* CodewordExtractor *************************************/
+
+bool CodewordExtractor::match_sync(uint32_t value, bool& inverted) {
+    if (diff_bit_count(value, sync_codeword) <= sync_max_errors) {
+        inverted = false;
+        return true;
+    }
+
+    if (diff_bit_count(value, ~sync_codeword) <= sync_max_errors) {
+        inverted = true;
+        return true;
+    }
+
+    return false;
+}
+
+void CodewordExtractor::process_bits() {
+    // Process all of the bits in the bits queue.
+    while (bits_.size() > 0) {
+        take_one_bit();
+
+        // Wait until data_ is full.
+        if (bit_count_ < data_bit_count)
+            continue;
+
+        // Wait for the sync frame.
+        if (!has_sync_) {
+            bool inverted = false;
+            if (match_sync(data_, inverted))
+                handle_sync(inverted);
+            continue;
+        }
+
+        save_current_codeword();
+
+        if (word_count_ == pocsag::batch_size)
+            handle_batch_complete();
+    }
+}
+
+void CodewordExtractor::flush() {
+    // Don't bother flushing if there's no pending data.
+    if (word_count_ == 0) return;
+
+    pad_idle();
+    handle_batch_complete();
+}
+
+void CodewordExtractor::reset() {
+    clear_data_bits();
+    has_sync_ = false;
+    inverted_ = false;
+    word_count_ = 0;
+}
+
+void CodewordExtractor::clear_data_bits() {
+    data_ = 0;
+    bit_count_ = 0;
+}
+
+void CodewordExtractor::take_one_bit() {
+    data_ = (data_ << 1) | bits_.pop();
+    if (bit_count_ < data_bit_count)
+        ++bit_count_;
+}
+
+void CodewordExtractor::handle_sync(bool inverted) {
+    clear_data_bits();
+    has_sync_ = true;
+    inverted_ = inverted;
+    word_count_ = 0;
+}
+
+void CodewordExtractor::save_current_codeword() {
+    batch_[word_count_++] = inverted_ ? ~data_ : data_;
+    clear_data_bits();
+}
+
+void CodewordExtractor::handle_batch_complete() {
+    on_batch_(*this);
+    has_sync_ = false;
+    word_count_ = 0;
+}
+
+void CodewordExtractor::pad_idle() {
+    while (word_count_ < pocsag::batch_size)
+        batch_[word_count_++] = idle_codeword;
+}
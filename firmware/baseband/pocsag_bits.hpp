@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 1996 Thomas Sailer (sailer@ife.ee.ethz.ch, hb9jnx@hb9w.che.eu)
+ * Copyright (C) 2012-2014 Elias Oenal (multimon-ng@eliasoenal.com)
+ * Copyright (C) 2015 Jared Boone, ShareBrained Technology, Inc.
+ * Copyright (C) 2016 Furrtek
+ * Copyright (C) 2023 Kyle Reed
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __POCSAG_BITS_H__
+#define __POCSAG_BITS_H__
+
+#include "dsp_types.hpp"
+#include "pocsag_packet.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+
+/* FIFO wrapper over a uint64_t's bits. Deep enough to hold a whole
+ * codeword handed over at lock time plus the bits that follow it
+ * before the queue is next drained. */
+class BitQueue {
+   public:
+    void push(bool bit);
+    void push(uint32_t bits, uint8_t count);
+    bool pop();
+    void reset();
+    uint8_t size() const;
+
+    /* The most recently pushed 32 bits. */
+    uint32_t data() const;
+
+   private:
+    uint64_t data_ = 0;
+    uint8_t count_ = 0;
+
+    static constexpr uint8_t max_size_ = sizeof(data_) * 8;
+};
+
+/* Extracts bits and bitrate from audio stream.
+ * Until a sync codeword is found, every known baud rate is sampled in the
+ * same pass over the audio and each one watches its own bit stream for the
+ * preamble clock and then the sync codeword. The first rate to see a sync
+ * codeword is locked in and feeds the BitQueue. This way a rate that found
+ * the clock by accident can't steal the transmission from the real one. */
+class BitExtractor {
+   public:
+    BitExtractor(BitQueue& bits)
+        : bits_{bits} {}
+
+    void extract_bits(const buffer_f32_t& audio);
+    void configure(uint32_t sample_rate);
+    void reset();
+    void set_baud_config(int8_t baud_config);
+
+    /* The locked rate, or a rate that has seen the clock while
+     * still searching for sync. 0 if neither. */
+    uint16_t baud_rate() const;
+
+    /* True once a rate has been locked by sync or configuration. */
+    bool locked() const { return current_rate_ != nullptr; }
+
+   private:
+    /* Clock signal detection magic number. */
+    static constexpr uint32_t clock_magic_number = 0xAAAAAAAA;
+
+    struct RateInfo {
+        enum class State : uint8_t {
+            WaitForSample,
+            ReadyToSend
+        };
+
+        const int16_t baud_rate = 0;
+        float sample_interval = 0.0;
+
+        State state = State::WaitForSample;
+        float samples_until_next = 0.0;
+        bool prev_value = false;
+        bool is_stable = false;
+        BitQueue bits{};
+
+        /* Updates a rate info with the given sample.
+         * Returns true if the rate info has a new bit in its queue. */
+        bool handle_sample(float sample);
+        void reset();
+    };
+
+    /* Checks a rate for clock/sync, locking it if sync was found. */
+    void search(RateInfo& rate);
+
+    std::array<RateInfo, 3> known_rates_{
+        RateInfo{512},
+        RateInfo{1200},
+        RateInfo{2400}};
+
+    BitQueue& bits_;
+    int8_t baud_config_ = -1;
+    uint32_t sample_rate_ = 0;
+    RateInfo* current_rate_ = nullptr;
+};
+
+/* Extracts codeword batches from the BitQueue. */
+class CodewordExtractor {
+   public:
+    /* Sync frame codeword. */
+    static constexpr uint32_t sync_codeword = 0x7cd215d8;
+
+    /* Idle codeword used to pad a 16 codeword "batch". */
+    static constexpr uint32_t idle_codeword = 0x7a89c197;
+
+    /* Bit errors tolerated when matching the sync codeword. */
+    static constexpr uint8_t sync_max_errors = 2;
+
+    /* Returns true if the value is close enough to the sync codeword.
+     * Sets inverted if it matched the inverted sync codeword. */
+    static bool match_sync(uint32_t value, bool& inverted);
+
+    using batch_t = pocsag::batch_t;
+    using batch_handler_t = std::function<void(CodewordExtractor&)>;
+
+    CodewordExtractor(BitQueue& bits, batch_handler_t on_batch)
+        : bits_{bits}, on_batch_{on_batch} {}
+
+    /* Process the BitQueue to extract codeword batches. */
+    void process_bits();
+
+    /* Pad then send any pending frames. */
+    void flush();
+
+    /* Completely reset to prepare for a new message. */
+    void reset();
+
+    /* Gets the underlying batch array. */
+    const batch_t& batch() const { return batch_; }
+
+    /* Gets in-progress codeword. */
+    uint32_t current() const { return data_; }
+
+    /* Gets the count of completed codewords. */
+    uint8_t count() const { return word_count_; }
+
+    /* Returns true if the batch has as sync frame. */
+    bool has_sync() const { return has_sync_; }
+
+   private:
+    /* Number of bits in 'data_' member. */
+    static constexpr uint8_t data_bit_count = sizeof(uint32_t) * 8;
+
+    /* Clears data_ and bit_count_ to prepare for next codeword. */
+    void clear_data_bits();
+
+    /* Pop a bit off the queue and add it to data_. */
+    void take_one_bit();
+
+    /* Handles receiving the sync frame codeword, start of batch. */
+    void handle_sync(bool inverted);
+
+    /* Saves the current codeword in data_ to the batch. */
+    void save_current_codeword();
+
+    /* Sends the batch to the handler, resets for next batch. */
+    void handle_batch_complete();
+
+    /* Fill the rest of the batch with 'idle' codewords. */
+    void pad_idle();
+
+    BitQueue& bits_;
+    batch_handler_t on_batch_{};
+
+    /* When true, sync frame has been received. */
+    bool has_sync_ = false;
+
+    /* When true, bit vales are flipped in the codewords. */
+    bool inverted_ = false;
+
+    uint32_t data_ = 0;
+    uint8_t bit_count_ = 0;
+    uint8_t word_count_ = 0;
+    batch_t batch_{};
+};
+
+#endif /*__POCSAG_BITS_H__*/
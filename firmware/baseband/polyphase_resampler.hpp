@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __POLYPHASE_RESAMPLER_H__
+#define __POLYPHASE_RESAMPLER_H__
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace dsp {
+namespace interpolation {
+
+/* Changes the sample rate by the ratio L / M: upsamples by L, low pass
+ * filters and keeps one sample in M, without working out the samples it
+ * drops. Each output sample takes T multiplies with one of the L phases
+ * of the filter.
+ *
+ * The filter is a Hamming windowed sinc cutting off at 'cutoff' times the
+ * lower of the two rates, half of it being the Nyquist frequency. */
+template <size_t L, size_t M, size_t T = 8>
+class PolyphaseResampler {
+   public:
+    explicit PolyphaseResampler(const float cutoff = 0.45f) {
+        design(cutoff);
+    }
+
+    template <typename ResampledSampleHandler>
+    void operator()(
+        const float sample,
+        ResampledSampleHandler resampled_sample_handler) {
+        history[head] = sample;
+        history[head + T] = sample;
+        head = (head == 0) ? T - 1 : head - 1;
+
+        // Newest sample first.
+        const float* const x = &history[head + 1];
+        while (phase < L) {
+            const float* const h = &taps[phase * T];
+            float sum = 0.0f;
+            for (size_t k = 0; k < T; k++)
+                sum += h[k] * x[k];
+            resampled_sample_handler(sum);
+            phase += M;
+        }
+        phase -= L;
+    }
+
+   private:
+    // Twice over, so the last T samples are always in one piece.
+    std::array<float, 2 * T> history{};
+    size_t head{T - 1};
+    size_t phase{0};
+    // Phase-major: taps[p * T + k] is tap p + k * L of the prototype.
+    std::array<float, L * T> taps{};
+
+    void design(const float cutoff) {
+        constexpr size_t length = L * T;
+        constexpr float pi = 3.14159265358979323846f;
+        // Cycles per sample at the upsampled rate.
+        const float fc = cutoff / ((L > M) ? L : M);
+
+        float sum = 0.0f;
+        for (size_t n = 0; n < length; n++) {
+            const float t = n - (length - 1) / 2.0f;
+            const float x = 2.0f * pi * fc * t;
+            const float sinc = (t == 0.0f) ? 1.0f : std::sin(x) / x;
+            const float window = 0.54f - 0.46f * std::cos(2.0f * pi * n / (length - 1));
+            taps[(n % L) * T + n / L] = sinc * window;
+            sum += sinc * window;
+        }
+        // Upsampling spreads each input sample over L outputs.
+        for (auto& tap : taps)
+            tap *= L / sum;
+    }
+};
+
+} /* namespace interpolation */
+} /* namespace dsp */
+
+#endif /*__POLYPHASE_RESAMPLER_H__*/
@@ -24,47 +24,48 @@
 #include "proc_am_tv.hpp"
 
 #include "portapack_shared_memory.hpp"
-#include "dsp_fft.hpp"
 #include "event_m4.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
-void WidebandFMAudio::execute(const buffer_c8_t& buffer) {
+void AnalogTv::execute(const buffer_c8_t& buffer) {
     if (!configured) {
         return;
     }
 
-    std::fill(spectrum.begin(), spectrum.end(), 0);
+    // A field only starts in a free slot, else it is dropped.
+    auto slot = field_fifo.in_slot();
+    video_sync.set_field_buffer(slot ? slot->pixels.data() : nullptr);
 
-    for (size_t i = 0; i < spectrum.size(); i++) {
-        spectrum[i] += buffer.p[i];
+    for (size_t i = 0; i < buffer.count; i++) {
+        const float re = buffer.p[i].real();
+        const float im = buffer.p[i].imag();
+        video_sync.execute(__builtin_sqrtf(re * re + im * im), [this](const VideoSync::Field& field) {
+            on_field(field);
+        });
     }
+}
 
-    const buffer_c16_t buffer_c16{spectrum.data(), spectrum.size(), buffer.sampling_rate};
-    channel_spectrum.feed(buffer_c16);
+void AnalogTv::on_field(const VideoSync::Field& field) {
+    auto slot = field_fifo.in_slot();
+    slot->lines = field.lines;
+    slot->line_locked = field.line_locked;
+    slot->field_locked = field.field_locked;
+    field_fifo.commit_in();
+    video_sync.set_field_buffer(nullptr);
 
-    int8_t re;
-    // int8_t im;
-    // int8_t mag;
+    AnalogTvFieldMessage field_message{&field_fifo};
+    shared_memory.application_queue.push(field_message);
 
-    for (size_t i = 0; i < 128; i++) {
-        re = buffer.p[i].real();
-        // im = buffer.p[i].imag();
-        // mag = __builtin_sqrtf((re * re) + (im * im)) ;
-        const unsigned int v = re + 127.0f;  // timescope
-        audio_spectrum.db[i] = std::max(0U, std::min(255U, v));
-    }
-    AudioSpectrumMessage message{&audio_spectrum};
-    shared_memory.application_queue.push(message);
+    // One line of the field for the scope.
+    std::copy(video_sync.scope().begin(), video_sync.scope().end(), audio_spectrum.db.begin());
+    AudioSpectrumMessage spectrum_message{&audio_spectrum};
+    shared_memory.application_queue.push(spectrum_message);
 }
 
-void WidebandFMAudio::on_message(const Message* const message) {
+void AnalogTv::on_message(const Message* const message) {
     switch (message->id) {
-        case Message::ID::UpdateSpectrum:
-        case Message::ID::SpectrumStreamingConfig:
-            channel_spectrum.on_message(message);
-            break;
-
         case Message::ID::WFMConfigure:
             configure(*reinterpret_cast<const WFMConfigureMessage*>(message));
             break;
@@ -74,13 +75,13 @@ void WidebandFMAudio::on_message(const Message* const message) {
     }
 }
 
-void WidebandFMAudio::configure(const WFMConfigureMessage& message) {
+void AnalogTv::configure(const WFMConfigureMessage& message) {
     (void)message;  // avoid warning
     configured = true;
 }
 
 int main() {
-    EventDispatcher event_dispatcher{std::make_unique<WidebandFMAudio>()};
+    EventDispatcher event_dispatcher{std::make_unique<AnalogTv>()};
     event_dispatcher.run();
     return 0;
 }
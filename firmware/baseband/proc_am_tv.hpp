@@ -28,35 +28,32 @@
 #include "baseband_thread.hpp"
 #include "rssi_thread.hpp"
 
-#include "dsp_types.hpp"
-#include "dsp_decimate.hpp"
-#include "dsp_demodulate.hpp"
-#include "block_decimator.hpp"
+#include "dsp_analog_tv.hpp"
 
-#include "tv_collector.hpp"
+#include "message.hpp"
 
-class WidebandFMAudio : public BasebandProcessor {
+class AnalogTv : public BasebandProcessor {
    public:
     void execute(const buffer_c8_t& buffer) override;
     void on_message(const Message* const message) override;
 
    private:
-    static constexpr size_t baseband_fs = 2000000;
+    static constexpr size_t baseband_fs = dsp::analog_tv::sample_rate;
 
-    std::array<complex16_t, 512> dst{};
-    const buffer_c16_t dst_buffer{
-        dst.data(),
-        dst.size()};
+    using VideoSync = dsp::analog_tv::VideoSync<AnalogTvField::width, AnalogTvField::height>;
+    VideoSync video_sync{};
+
+    AnalogTvField fields[1 << AnalogTvFieldMessage::fifo_k]{};
+    AnalogTvFieldFIFO field_fifo{fields, AnalogTvFieldMessage::fifo_k};
 
     AudioSpectrum audio_spectrum{};
-    TvCollector channel_spectrum{};
-    std::array<complex16_t, 256> spectrum{};
     bool configured{false};
 
     /* NB: Threads should be the last members in the class definition. */
     BasebandThread baseband_thread{baseband_fs, this, baseband::Direction::Receive};
     RSSIThread rssi_thread{};
 
+    void on_field(const VideoSync::Field& field);
     void configure(const WFMConfigureMessage& message);
 };
 
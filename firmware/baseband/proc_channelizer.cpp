@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "proc_channelizer.hpp"
+#include "portapack_shared_memory.hpp"
+
+#include "audio_dma.hpp"
+#include "dsp_iir_config.hpp"
+#include "utility.hpp"
+
+#include "event_m4.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/* Half dB steps, see ChannelizerActivityMessage. A single channel sits
+ * well below the noise of the whole capture, so this reaches further down
+ * than the ChannelSpectrum scale. */
+uint8_t to_level(const float mag2) {
+    const float db = mag2_to_dbv_norm(mag2 * (1.0f / (128.0f * 128.0f)));
+    return std::clamp<int32_t>(db * 2.0f + 255.0f, 0, 255);
+}
+
+}  // namespace
+
+void ChannelizerProcessor::execute(const buffer_c8_t& buffer) {
+    if (!configured)
+        return;
+
+    blocks = 0;
+    channelizer.execute(buffer, [this]() { on_block(); });
+    if (blocks == 0)
+        return;
+
+    update_squelch();
+
+    // The activity of all channels is sampled once per buffer, on its
+    // last block: only the monitored channels need every block.
+    channelizer.analyze(channels);
+    for (size_t c = 0; c < channels.size(); c++)
+        power[c] += std::norm(channels[c]);
+
+    if (++analyzed >= buffers_per_report)
+        report();
+}
+
+void ChannelizerProcessor::on_block() {
+    blocks++;
+
+    float mix = 0.0f;
+    for (auto& monitor : monitors)
+        mix += demodulate(monitor);
+
+    // The recording, and what's heard while it runs, is the recorded channel alone.
+    if (recording)
+        mix = demodulate(recorder);
+
+    push_audio(mix);
+}
+
+float ChannelizerProcessor::demodulate(Monitor& monitor) {
+    if (monitor.channel < 0)
+        return 0.0f;
+
+    const auto sample = channelizer.channel(monitor.channel);
+    monitor.power += std::norm(sample);
+
+    // FM discriminator.
+    const auto product = sample * std::conj(monitor.last);
+    monitor.last = sample;
+    return monitor.open ? std::atan2(product.imag(), product.real()) * demod_k : 0.0f;
+}
+
+bool ChannelizerProcessor::update_squelch(Monitor& monitor) {
+    if (monitor.channel < 0)
+        return false;
+
+    const auto level = to_level(monitor.power / blocks);
+    monitor.power = 0.0f;
+    monitor.open = monitor.open ? (level + squelch_hysteresis > squelch_level) : (level > squelch_level);
+    return monitor.open;
+}
+
+void ChannelizerProcessor::update_squelch() {
+    for (size_t n = 0; n < monitors.size(); n++) {
+        if (update_squelch(monitors[n]))
+            activity.open_mask |= 1 << n;
+    }
+    if (recording)
+        update_squelch(recorder);
+}
+
+void ChannelizerProcessor::report() {
+    for (size_t c = 0; c < power.size(); c++) {
+        activity.level[c] = to_level(power[c] / analyzed);
+        power[c] = 0.0f;
+    }
+    analyzed = 0;
+
+    shared_memory.application_queue.push(activity);
+    activity.open_mask = 0;
+}
+
+void ChannelizerProcessor::push_audio(const float sample) {
+    resampler(sample, [this](const float value) {
+        audio[audio_count++] = std::clamp<int32_t>(value * 32767.0f, -32768, 32767);
+        if (audio_count == audio.size()) {
+            audio_output.write(buffer_s16_t{audio.data(), audio_count, audio_fs});
+            audio_count = 0;
+        }
+    });
+}
+
+void ChannelizerProcessor::on_message(const Message* const message) {
+    switch (message->id) {
+        case Message::ID::ChannelizerConfigure:
+            configure(*reinterpret_cast<const ChannelizerConfigureMessage*>(message));
+            break;
+
+        case Message::ID::CaptureConfig:
+            capture_config(*reinterpret_cast<const CaptureConfigMessage*>(message));
+            break;
+
+        default:
+            break;
+    }
+}
+
+void ChannelizerProcessor::configure(const ChannelizerConfigureMessage& message) {
+    const float channel_fs = float(message.sampling_rate) / Channelizer::channel_count;
+    constexpr float pi = 3.14159265358979323846f;
+
+    baseband_thread.set_sampling_rate(message.sampling_rate);
+
+    for (size_t n = 0; n < monitors.size(); n++)
+        set_channel(monitors[n], message.monitored[n]);
+    set_channel(recorder, message.recorded);
+    squelch_level = message.squelch_level;
+
+    // Full deviation at half scale, so a few monitored channels can be
+    // open at once before clipping.
+    demod_k = 0.5f * channel_fs / (2.0f * pi * deviation);
+    resampler.configure(channel_fs, audio_fs);
+
+    const size_t buffers_per_second = message.sampling_rate / 2048;
+    buffers_per_report = std::max<size_t>(1, buffers_per_second / reports_per_second);
+
+    audio_output.configure(audio_12k_hpf_300hz_config, audio_12k_deemph_300_6_config);
+    audio_output.set_fixed_point(true);
+
+    configured = true;
+}
+
+void ChannelizerProcessor::set_channel(Monitor& monitor, const int16_t channel) {
+    if (channel != monitor.channel)
+        monitor = {};
+    monitor.channel = (channel >= 0 && size_t(channel) < Channelizer::channel_count) ? channel : -1;
+}
+
+void ChannelizerProcessor::capture_config(const CaptureConfigMessage& message) {
+    recorder = {recorder.channel};
+    recording = message.config != nullptr;
+    if (message.config) {
+        audio_output.set_stream(std::make_unique<StreamInput>(message.config));
+    } else {
+        audio_output.set_stream(nullptr);
+    }
+}
+
+int main() {
+    audio::dma::init_audio_out();
+
+    EventDispatcher event_dispatcher{std::make_unique<ChannelizerProcessor>()};
+    event_dispatcher.run();
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef __PROC_CHANNELIZER_H__
+#define __PROC_CHANNELIZER_H__
+
+#include "baseband_processor.hpp"
+#include "baseband_thread.hpp"
+#include "rssi_thread.hpp"
+
+#include "dsp_channelizer.hpp"
+#include "linear_resampler.hpp"
+
+#include "audio_output.hpp"
+
+#include "message.hpp"
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+/* Splits the capture in channels with a polyphase filter bank, reports
+ * the power of all of them and FM demodulates the monitored ones, see
+ * ChannelizerConfigureMessage. */
+class ChannelizerProcessor : public BasebandProcessor {
+   public:
+    void execute(const buffer_c8_t& buffer) override;
+    void on_message(const Message* const message) override;
+
+   private:
+    using Channelizer = dsp::channelizer::PolyphaseChannelizer<ChannelizerConfigureMessage::channel_count>;
+
+    static constexpr size_t default_baseband_fs = 3'200'000;
+    static constexpr uint32_t audio_fs = 12'000;
+    static constexpr float deviation = 2'500.0f;
+    static constexpr size_t reports_per_second = 20;
+    static constexpr uint8_t squelch_hysteresis = 2 * 2;  // 2dB
+
+    struct Monitor {
+        int16_t channel{-1};
+        std::complex<float> last{};
+        float power{0.0f};
+        bool open{false};
+    };
+
+    bool configured{false};
+
+    Channelizer channelizer{};
+    Channelizer::Channels channels{};
+
+    // Sums of one analyze() per buffer.
+    std::array<float, Channelizer::channel_count> power{};
+    size_t analyzed{0};
+    size_t buffers_per_report{1};
+    ChannelizerActivityMessage activity{};
+
+    std::array<Monitor, ChannelizerConfigureMessage::max_monitored> monitors{};
+    Monitor recorder{};
+    bool recording{false};  // A capture stream is set.
+    size_t blocks{0};  // In this buffer.
+    uint8_t squelch_level{0};
+    float demod_k{0.0f};
+
+    dsp::interpolation::LinearResampler resampler{};
+    std::array<int16_t, 32> audio{};
+    size_t audio_count{0};
+    AudioOutput audio_output{};
+
+    /* NB: Threads should be the last members in the class definition. */
+    BasebandThread baseband_thread{default_baseband_fs, this, baseband::Direction::Receive};
+    RSSIThread rssi_thread{};
+
+    void configure(const ChannelizerConfigureMessage& message);
+    void capture_config(const CaptureConfigMessage& message);
+    void set_channel(Monitor& monitor, const int16_t channel);
+    void on_block();
+    float demodulate(Monitor& monitor);
+    bool update_squelch(Monitor& monitor);
+    void update_squelch();
+    void report();
+    void push_audio(const float sample);
+};
+
+#endif /*__PROC_CHANNELIZER_H__*/
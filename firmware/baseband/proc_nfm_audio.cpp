@@ -27,6 +27,7 @@
 #include "audio_dma.hpp"
 
 #include "event_m4.hpp"
+#include "tonesets.hpp"
 
 #include <cstdint>
 #include <cstddef>
@@ -71,26 +72,21 @@ void NarrowbandFMAudio::execute(const buffer_c8_t& buffer) {
                 audio_ctcss.count,
                 audio_ctcss.sampling_rate});
 
-            // Zero-crossing detection
-            for (size_t c = 0; c < audio_ctcss.count; c++) {
-                cur_sample = audio_f[c];
-                if (cur_sample * prev_sample < 0.0) {
-                    z_acc += z_timer;
-                    z_timer = 1;
-                    z_count++;
-                } else
-                    z_timer++;
-                prev_sample = cur_sample;
+            // Sum of the 8 samples -> 1.5kHz, plenty for tones up to 254Hz.
+            float ctcss_sample = 0.0f;
+            for (size_t i = 0; i < audio_ctcss.count; i++) {
+                ctcss_sample += audio_f[i];
             }
 
-            z_filter_count++;
-            if ((z_filter_count >= Z_MIN_FILTER_COUNT) && (z_count >= Z_MIN_ZERO_CROSSINGS)) {
-                ctcss_message.value = (100 * 12000 / 2 * z_count) / z_acc;
-                shared_memory.application_queue.push(ctcss_message);
-                z_filter_count = 0;
-                z_count = 0;
-                z_acc = 0;
-            }
+            ctcss_bank.execute(buffer_f32_t{&ctcss_sample, 1, ctcss_fs}, [this]() {
+                const auto detection = ctcss_bank.best();
+                const uint32_t tone = (detection.confidence >= ctcss_min_confidence) ? ctcss_tones[detection.index] : 0;
+                // 0 tells the application the tone is gone, once.
+                if (tone != 0 || ctcss_message.value != 0) {
+                    ctcss_message.value = tone;
+                    shared_memory.application_queue.push(ctcss_message);
+                }
+            });
         }
     } else {
         // Direction-finding mode; output tone with pitch related to RSSI
@@ -155,13 +151,22 @@ void NarrowbandFMAudio::configure(const NBFMConfigureMessage& message) {
     channel_filter_transition = message.channel_filter.transition_normalized * channel_filter_input_fs;
     channel_spectrum.set_decimation_factor(1.0f);
     audio_output.configure(message.audio_hpf_config, message.audio_deemph_config, (float)message.squelch_level / 100.0);
+    audio_output.set_fixed_point(true);  // 300Hz HPF + 300us de-emphasis are well within Q2.29
 
     hpf.configure(audio_24k_hpf_30hz_config);
     ctcss_filter.configure(taps_64_lp_025_025.taps);
+    ctcss_bank.reset();
 
     configured = true;
 }
 
+std::array<float, 50> NarrowbandFMAudio::ctcss_frequencies() {
+    std::array<float, 50> frequencies{};
+    for (size_t i = 0; i < frequencies.size(); i++)
+        frequencies[i] = ctcss_tones[i] / 100.0f;
+    return frequencies;
+}
+
 void NarrowbandFMAudio::pitch_rssi_config(const PitchRSSIConfigureMessage& message) {
     pitch_rssi_enabled = message.enabled;
     tone_delta = (message.rssi + 1000) * ((1ULL << 32) / 24000);
@@ -29,6 +29,7 @@
 
 #include "dsp_decimate.hpp"
 #include "dsp_demodulate.hpp"
+#include "dsp_goertzel.hpp"
 #include "dsp_iir.hpp"
 
 #include "audio_output.hpp"
@@ -36,9 +37,6 @@
 
 #include <cstdint>
 
-#define Z_MIN_FILTER_COUNT 224
-#define Z_MIN_ZERO_CROSSINGS 20
-
 class NarrowbandFMAudio : public BasebandProcessor {
    public:
     void execute(const buffer_c8_t& buffer) override;
@@ -72,9 +70,14 @@ class NarrowbandFMAudio : public BasebandProcessor {
     int32_t channel_filter_high_f = 0;
     int32_t channel_filter_transition = 0;
 
-    // For CTCSS decoding
+    // For CTCSS decoding: 533ms windows every 133ms, 1.9Hz apart bins
+    // for tones down to 2.3Hz apart.
+    static constexpr uint32_t ctcss_fs = 1500;
+    static constexpr size_t ctcss_block_size = 200;
+    static constexpr float ctcss_min_confidence = 0.25f;
     dsp::decimate::FIR64AndDecimateBy2Real ctcss_filter{};
     IIRBiquadFilter hpf{};
+    dsp::GoertzelBank<50> ctcss_bank{ctcss_frequencies(), ctcss_fs, ctcss_block_size};
 
     dsp::demodulate::FM demod{};
 
@@ -86,8 +89,6 @@ class NarrowbandFMAudio : public BasebandProcessor {
     uint32_t tone_delta{0};
     bool pitch_rssi_enabled{false};
 
-    float cur_sample{}, prev_sample{};
-    uint32_t z_acc{0}, z_timer{0}, z_count{0}, z_filter_count{0};
     bool ctcss_detect_enabled{true};
     static constexpr float k = 32768.0f;
     static constexpr float ki = 1.0f / k;
@@ -100,6 +101,7 @@ class NarrowbandFMAudio : public BasebandProcessor {
     BasebandThread baseband_thread{baseband_fs, this, baseband::Direction::Receive};
     RSSIThread rssi_thread{};
 
+    static std::array<float, 50> ctcss_frequencies();
     void pitch_rssi_config(const PitchRSSIConfigureMessage& message);
     void configure(const NBFMConfigureMessage& message);
     void capture_config(const CaptureConfigMessage& message);
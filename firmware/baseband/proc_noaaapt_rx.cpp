@@ -31,20 +31,20 @@
 #include <cstdint>
 #include <cstddef>
 
-#define NOAAAPT_PX_SIZE 2080.0
-
-// updates the per pixel timers
 void NoaaAptRx::update_params() {
-    // TODO HTOTOO
-    //  2080 px / line with chan a,b + sync + telemetry
-    pxRem = (double)12000.0 / NOAAAPT_PX_SIZE / 2.0;
-    samples_per_pixel = pxRem;
-    pxRem -= samples_per_pixel;
-    pxRoll = 0;
     status_message.state = 0;
     shared_memory.application_queue.push(status_message);
 }
 
+/* 0: looking for the sync, 1: locked, 2: lost it, cutting lines where it
+ * should be. */
+void NoaaAptRx::set_state(uint8_t state) {
+    if (status_message.state == state)
+        return;
+    status_message.state = state;
+    shared_memory.application_queue.push(status_message);
+}
+
 void NoaaAptRx::execute(const buffer_c8_t& buffer) {
     if (!configured) {
         return;
@@ -80,39 +80,31 @@ void NoaaAptRx::execute(const buffer_c8_t& buffer) {
     std::array<float, 32> audio_f;
     audio_output.apt_write(audio, audio_f);  // we are in added wfmam (noaa), decim_1.decimation_factor == 8
 
+    // The line only waits for a free slot between lines.
+    auto slot = line_fifo.in_slot();
+    line_sync.set_line_buffer(slot ? slot->words.data() : nullptr);
+
     for (size_t c = 0; c < audio.count; c++) {
-        if (status_message.state == 0 && false) {  // disabled this due to NIY
-            // first look for the sync!
-
-        } else {
-            cnt++;
-            if (cnt >= (samples_per_pixel + (uint32_t)pxRoll)) {  // got a pixel
-                cnt = 0;
-                if (pxRoll >= 1) pxRoll -= 1.0;
-                pxRoll += pxRem;
-
-                if (image_message.cnt < 400) {
-                    if (audio_f[c] >= 1) {
-                        image_message.image[image_message.cnt++] = 255;
-                    } else if (audio_f[c] <= 0) {
-                        image_message.image[image_message.cnt++] = 0;
-                    } else {
-                        image_message.image[image_message.cnt++] = (audio_f[c]) * 255;
-                    }
-                }
-                if (image_message.cnt >= 399) {
-                    shared_memory.application_queue.push(image_message);
-                    image_message.cnt = 0;
-                    if (status_message.state != 2) {
-                        status_message.state = 2;
-                        shared_memory.application_queue.push(status_message);
-                    }
-                }
-            }
-        }
+        resampler(audio_f[c], [this](const float sample) {
+            on_sample(sample);
+        });
     }
 }
 
+void NoaaAptRx::on_sample(const float sample) {
+    const uint8_t level = (sample >= 1.0f) ? 255 : (sample <= 0.0f) ? 0 : uint8_t(sample * 255.0f);
+    line_sync.execute(level, [this](const dsp::apt::LineSync::Line& line) {
+        auto slot = line_fifo.in_slot();
+        slot->synced = line.synced;
+        line_fifo.commit_in();
+        line_sync.set_line_buffer(nullptr);
+    });
+    if (line_sync.locked())
+        set_state(1);
+    else if (status_message.state == 1)
+        set_state(2);
+}
+
 void NoaaAptRx::on_message(const Message* const message) {
     switch (message->id) {
         case Message::ID::UpdateSpectrum:
@@ -161,6 +153,9 @@ void NoaaAptRx::configure(const NoaaAptRxConfigureMessage& message) {
     audio_output.configure(apt_audio_12k_notch_2k4_config, apt_audio_12k_lpf_2000hz_config);
     // channel_spectrum.set_decimation_factor(1);
     update_params();
+
+    NoaaAptRxLineConfigMessage line_config{&line_fifo};
+    shared_memory.application_queue.push(line_config);
     configured = true;
 }
 
@@ -26,9 +26,11 @@
 #include "baseband_thread.hpp"
 #include "rssi_thread.hpp"
 
+#include "dsp_apt.hpp"
 #include "dsp_decimate.hpp"
 #include "dsp_demodulate.hpp"
 #include "dsp_iir.hpp"
+#include "polyphase_resampler.hpp"
 #include "audio_compressor.hpp"
 
 #include "audio_output.hpp"
@@ -43,17 +45,8 @@ class NoaaAptRx : public BasebandProcessor {
 
    private:
     void update_params();
-    // todo rethink
-
-    uint32_t samples_per_pixel = 0;
-
-    // to exactly match the pixel / samples.
-    double pxRem = 0;   // if has remainder, it'll store it
-    double pxRoll = 0;  // summs remainders, so won't misalign
-
-    uint32_t cnt = 0;  // signal counter
-    uint16_t sync_cnt = 0;
-    uint16_t syncnot_cnt = 0;
+    void set_state(uint8_t state);
+    void on_sample(float sample);
 
     static constexpr size_t baseband_fs = 3072000;
     static constexpr auto spectrum_rate_hz = 50.0f;
@@ -114,7 +107,15 @@ class NoaaAptRx : public BasebandProcessor {
     void capture_config(const CaptureConfigMessage& message);
 
     NoaaAptRxStatusDataMessage status_message{0};
-    NoaaAptRxImageDataMessage image_message{};
+
+    // 12kHz AM envelope to two samples a word, 8320Hz: 52 / 75.
+    dsp::interpolation::PolyphaseResampler<52, 75> resampler{};
+    static_assert(12000 * 52 / 75 == dsp::apt::sample_rate, "APT resampling ratio");
+    dsp::apt::LineSync line_sync{};
+
+    NoaaAptLine lines[1 << NoaaAptRxLineConfigMessage::fifo_k]{};
+    NoaaAptLineFIFO line_fifo{lines, NoaaAptRxLineConfigMessage::fifo_k};
+    static_assert(NoaaAptLine::width == dsp::apt::words_per_line, "APT line width");
 
     /* NB: Threads should be the last members in the class definition. */
     BasebandThread baseband_thread{baseband_fs, this, baseband::Direction::Receive};
@@ -36,6 +36,7 @@
 #include "dsp_iir_config.hpp"
 #include "message.hpp"
 #include "pocsag.hpp"
+#include "pocsag_bits.hpp"
 #include "pocsag_packet.hpp"
 #include "portapack_shared_memory.hpp"
 #include "rssi_thread.hpp"
@@ -59,143 +60,6 @@ class AudioNormalizer {
     float t_lo_ = 1.0;
 };
 
-/* FIFO wrapper over a uint32_t's bits. */
-class BitQueue {
-   public:
-    void push(bool bit);
-    bool pop();
-    void reset();
-    uint8_t size() const;
-    uint32_t data() const;
-
-   private:
-    uint32_t data_ = 0;
-    uint8_t count_ = 0;
-
-    static constexpr uint8_t max_size_ = sizeof(data_) * 8;
-};
-
-/* Extracts bits and bitrate from audio stream. */
-class BitExtractor {
-   public:
-    BitExtractor(BitQueue& bits)
-        : bits_{bits} {}
-
-    void extract_bits(const buffer_f32_t& audio);
-    void configure(uint32_t sample_rate);
-    void reset();
-    void set_baud_config(int8_t baud_config);
-    uint16_t baud_rate() const;
-
-   private:
-    /* Clock signal detection magic number. */
-    static constexpr uint32_t clock_magic_number = 0xAAAAAAAA;
-
-    struct RateInfo {
-        enum class State : uint8_t {
-            WaitForSample,
-            ReadyToSend
-        };
-
-        const int16_t baud_rate = 0;
-        float sample_interval = 0.0;
-
-        State state = State::WaitForSample;
-        float samples_until_next = 0.0;
-        bool prev_value = false;
-        bool is_stable = false;
-        BitQueue bits{};
-
-        /* Updates a rate info with the given sample.
-         * Returns true if the rate info has a new bit in its queue. */
-        bool handle_sample(float sample);
-        void reset();
-    };
-
-    std::array<RateInfo, 3> known_rates_{
-        RateInfo{512},
-        RateInfo{1200},
-        RateInfo{2400}};
-
-    BitQueue& bits_;
-    int8_t baud_config_ = -1;
-    uint32_t sample_rate_ = 0;
-    RateInfo* current_rate_ = nullptr;
-};
-
-/* Extracts codeword batches from the BitQueue. */
-class CodewordExtractor {
-   public:
-    using batch_t = pocsag::batch_t;
-    using batch_handler_t = std::function<void(CodewordExtractor&)>;
-
-    CodewordExtractor(BitQueue& bits, batch_handler_t on_batch)
-        : bits_{bits}, on_batch_{on_batch} {}
-
-    /* Process the BitQueue to extract codeword batches. */
-    void process_bits();
-
-    /* Pad then send any pending frames. */
-    void flush();
-
-    /* Completely reset to prepare for a new message. */
-    void reset();
-
-    /* Gets the underlying batch array. */
-    const batch_t& batch() const { return batch_; }
-
-    /* Gets in-progress codeword. */
-    uint32_t current() const { return data_; }
-
-    /* Gets the count of completed codewords. */
-    uint8_t count() const { return word_count_; }
-
-    /* Returns true if the batch has as sync frame. */
-    bool has_sync() const { return has_sync_; }
-
-   private:
-    /* Sync frame codeword. */
-    static constexpr uint32_t sync_codeword = 0x7cd215d8;
-
-    /* Idle codeword used to pad a 16 codeword "batch". */
-    static constexpr uint32_t idle_codeword = 0x7a89c197;
-
-    /* Number of bits in 'data_' member. */
-    static constexpr uint8_t data_bit_count = sizeof(uint32_t) * 8;
-
-    /* Clears data_ and bit_count_ to prepare for next codeword. */
-    void clear_data_bits();
-
-    /* Pop a bit off the queue and add it to data_. */
-    void take_one_bit();
-
-    /* Handles receiving the sync frame codeword, start of batch. */
-    void handle_sync(bool inverted);
-
-    /* Saves the current codeword in data_ to the batch. */
-    void save_current_codeword();
-
-    /* Sends the batch to the handler, resets for next batch. */
-    void handle_batch_complete();
-
-    /* Fill the rest of the batch with 'idle' codewords. */
-    void pad_idle();
-
-    BitQueue& bits_;
-    batch_handler_t on_batch_{};
-
-    /* When true, sync frame has been received. */
-    bool has_sync_ = false;
-
-    /* When true, bit vales are flipped in the codewords. */
-    bool inverted_ = false;
-
-    uint32_t data_ = 0;
-    uint8_t bit_count_ = 0;
-    uint8_t word_count_ = 0;
-    batch_t batch_{};
-};
-
 /* Processes POCSAG signal into codeword batches. */
 class POCSAGProcessor : public BasebandProcessor {
    public:
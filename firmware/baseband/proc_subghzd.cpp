@@ -106,11 +106,19 @@ void SubGhzDProcessor::execute(const buffer_c8_t& buffer) {
             currentDuration += nsPerDecSamp;
         } else {  // called on change, so send the last duration and dir.
             if (currentDuration >= 30'000'000) sig_state = STATE_IDLE;
-            if (protoList) protoList->feed(currentHiLow, currentDuration / 1000);
+            if (edges.push(currentHiLow, currentDuration / 1000)) feed_edges();
             currentDuration = nsPerDecSamp;
             currentHiLow = meashl;
         }
     }
+
+    // Dispatch whatever edges this buffer produced.
+    feed_edges();
+}
+
+void SubGhzDProcessor::feed_edges() {
+    if (protoList && !edges.empty()) protoList->feed(edges);
+    edges.clear();
 }
 
 void SubGhzDProcessor::on_message(const Message* const message) {
@@ -75,8 +75,10 @@ class SubGhzDProcessor : public BasebandProcessor {
     bool currentHiLow = false;
     bool configured{false};
 
+    FProtoEdgeBatch edges{};  // edges collected during execute(), fed to protoList in batches
     FProtoListGeneral* protoList = new SubGhzDProtos();  // holds all the protocols we can parse
     void configure(const SubGhzFPRxConfigureMessage& message);
+    void feed_edges();
 
     /* NB: Threads should be the last members in the class definition. */
     BasebandThread baseband_thread{baseband_fs, this, baseband::Direction::Receive};
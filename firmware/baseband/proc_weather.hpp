@@ -72,8 +72,10 @@ class WeatherProcessor : public BasebandProcessor {
     bool currentHiLow = false;
     bool configured{false};
 
+    FProtoEdgeBatch edges{};  // edges collected during execute(), fed to protoList in batches
     FProtoListGeneral* protoList = new WeatherProtos();  // holds all the protocols we can parse
     void configure(const SubGhzFPRxConfigureMessage& message);
+    void feed_edges();
     void on_beep_message(const AudioBeepMessage& message);
 
     /* NB: Threads should be the last members in the class definition. */
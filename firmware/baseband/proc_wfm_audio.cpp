@@ -70,6 +70,16 @@ void WidebandFMAudio::execute(const buffer_c8_t& buffer) {
 
     auto audio_4fs = audio_dec_1.execute(audio_oversampled, work_audio_buffer);
 
+    /* 192kHz int16_t[128]   for wfm stereo
+     * -> 19kHz pilot PLL, 38kHz subcarrier mixed down to baseband
+     * -> CIC decimation by 2, then the same 15kHz FIR as the mono path
+     * -> 48kHz int16_t[32] L-R */
+    if (stereo_enabled) {
+        auto diff_4fs = stereo.execute(audio_4fs, stereo_audio_buffer);
+        auto diff_2fs = stereo_dec.execute(diff_4fs, stereo_audio_buffer);
+        stereo_filter.execute(diff_2fs, stereo_audio_buffer);
+    }
+
     /* 192kHz int16_t[128]   for wfm
      * -> 4th order CIC decimation by 2, gain of 1
      * -> 96kHz int16_t[64] */
@@ -146,7 +156,13 @@ void WidebandFMAudio::execute(const buffer_c8_t& buffer) {
     /* -> 12kHz int16_t[8]   for wfmam ,  */
 
     if (decim_1.decimation_factor() == 2) {
-        audio_output.write(audio);  // we are in original wfm , decim_1.decimation_factor == 2
+        if (stereo_enabled) {
+            const buffer_s16_t stereo_diff{stereo_audio.data(), audio.count, audio.sampling_rate};
+            stereo.matrix(audio, stereo_diff);
+            audio_output.write(audio, stereo_diff);
+        } else {
+            audio_output.write(audio);  // we are in original wfm , decim_1.decimation_factor == 2
+        }
     } else {
         audio_output.apt_write(audio);  // we are in added wfmam (noaa), decim_1.decimation_factor == 8
     }
@@ -209,6 +225,12 @@ void WidebandFMAudio::configure_wfm(const WFMConfigureMessage& message) {
     audio_filter.configure(message.audio_filter.taps);
     audio_output.configure(message.audio_hpf_config, message.audio_deemph_config);
 
+    // The 38kHz subcarrier sees ~1.7dB more droop than L+R in audio_dec_1 (CIC4 at 384kHz).
+    constexpr float stereo_subcarrier_gain = 1.2171f;
+    stereo_enabled = message.stereo;
+    stereo.configure(demod_input_fs / 2, stereo_subcarrier_gain);
+    stereo_filter.configure(message.audio_filter.taps);
+
     channel_spectrum.set_decimation_factor(1);
 
     configured = true;
@@ -240,6 +262,8 @@ void WidebandFMAudio::configure_wfmam(const WFMAMConfigureMessage& message) {
     audio_filter.configure(message.audio_filter.taps);
     audio_output.configure(message.audio_hpf_config, message.audio_deemph_config);
 
+    stereo_enabled = false;
+
     channel_spectrum.set_decimation_factor(1);
 
     configured = true;
@@ -30,6 +30,7 @@
 #include "dsp_types.hpp"
 #include "dsp_decimate.hpp"
 #include "dsp_demodulate.hpp"
+#include "dsp_fm_stereo.hpp"
 #include "block_decimator.hpp"
 
 #include "audio_output.hpp"
@@ -118,6 +119,18 @@ class WidebandFMAudio : public BasebandProcessor {
     dsp::decimate::DecimateBy2CIC4Real audio_dec_2{};
     dsp::decimate::FIR64AndDecimateBy2Real audio_filter{};
 
+    // Stereo L-R path, tapped off after audio_dec_1 (192kHz) so the
+    // demodulator and first CIC are shared with the mono path.
+    std::array<int16_t, 128> stereo_audio{};
+    const buffer_s16_t stereo_audio_buffer{
+        stereo_audio.data(),
+        stereo_audio.size()};
+
+    dsp::demodulate::FMStereo stereo{};
+    dsp::decimate::DecimateBy2CIC4Real stereo_dec{};
+    dsp::decimate::FIR64AndDecimateBy2Real stereo_filter{};
+    bool stereo_enabled{false};
+
     AudioOutput audio_output{};
 
     // For fs=96kHz FFT streaming
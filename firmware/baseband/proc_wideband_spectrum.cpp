@@ -23,6 +23,7 @@
 #include "audio_dma.hpp"
 
 #include "event_m4.hpp"
+#include "portapack_shared_memory.hpp"
 
 #include <cstdint>
 #include <cstddef>
@@ -35,6 +36,18 @@ void WidebandSpectrum::execute(const buffer_c8_t& buffer) {
 
     if (!configured) return;
 
+    if (sweep_hop_count) {
+        // Samples taken while the application retunes or the synthesizers settle are useless.
+        if (retuning) {
+            if (!hop_requested) send_hop_request();
+            return;
+        }
+        if (discard_remaining) {
+            discard_remaining--;
+            return;
+        }
+    }
+
     if (phase == 0) {
         std::fill(spectrum.begin(), spectrum.end(), 0);
     }
@@ -53,8 +66,13 @@ void WidebandSpectrum::execute(const buffer_c8_t& buffer) {
             buffer.sampling_rate};
         channel_spectrum.feed(
             buffer_c16,
-            0, 0, 0);
+            0, 0, 0,
+            sweep_hop_count ? hop_center(sweep_hop) : 0);
         phase = 0;
+
+        // Retune right away, the FFT runs while the next hop settles.
+        if (sweep_hop_count)
+            request_hop((sweep_hop + 1) % sweep_hop_count);
     } else {
         phase++;
     }
@@ -66,6 +84,47 @@ void WidebandSpectrum::on_signal_message(const RequestSignalMessage& message) {
     }
 }
 
+void WidebandSpectrum::request_hop(size_t hop) {
+    pending_hop = hop;
+    retuning = true;
+    send_hop_request();
+}
+
+void WidebandSpectrum::send_hop_request() {
+    // Tried again on the next buffer if the queue is busy.
+    SpectrumSweepRetuneMessage message{pending_hop};
+    hop_requested = shared_memory.application_queue.push(message);
+}
+
+int64_t WidebandSpectrum::hop_center(size_t hop) const {
+    return sweep_irregular ? sweep_centers[hop] : sweep_first_center + hop * sweep_step;
+}
+
+void WidebandSpectrum::on_sweep_config(const WidebandSpectrumSweepConfigMessage& message) {
+    sweep_first_center = message.first_center;
+    sweep_step = message.step;
+    sweep_irregular = message.irregular;
+    sweep_centers = message.centers;
+    sweep_hop_count = message.hop_count;
+    sweep_discard = message.discard;
+    phase = 0;
+
+    if (sweep_hop_count)
+        request_hop(0);
+    else
+        retuning = false;
+}
+
+void WidebandSpectrum::on_sweep_tuned(const SpectrumSweepTunedMessage& message) {
+    // Replies to requests from a previous sweep can still be in flight.
+    if (!sweep_hop_count || !retuning || message.hop != pending_hop) return;
+
+    sweep_hop = message.hop;
+    discard_remaining = sweep_discard;
+    phase = 0;
+    retuning = false;
+}
+
 void WidebandSpectrum::on_beep_message(const AudioBeepMessage& message) {
     audio::dma::beep_start(message.freq, message.sample_rate, message.duration_ms);
 }
@@ -80,6 +139,14 @@ void WidebandSpectrum::on_message(const Message* const msg) {
             on_beep_message(*reinterpret_cast<const AudioBeepMessage*>(msg));
             return;
 
+        case Message::ID::WidebandSpectrumSweepConfig:
+            on_sweep_config(*reinterpret_cast<const WidebandSpectrumSweepConfigMessage*>(msg));
+            return;
+
+        case Message::ID::SpectrumSweepTuned:
+            on_sweep_tuned(*reinterpret_cast<const SpectrumSweepTunedMessage*>(msg));
+            return;
+
         default:
             break;
     }
@@ -45,12 +45,30 @@ class WidebandSpectrum : public BasebandProcessor {
 
     void on_beep_message(const AudioBeepMessage& message);
     void on_signal_message(const RequestSignalMessage& message);
+    void on_sweep_config(const WidebandSpectrumSweepConfigMessage& message);
+    void on_sweep_tuned(const SpectrumSweepTunedMessage& message);
+    void request_hop(size_t hop);
+    void send_hop_request();
+    int64_t hop_center(size_t hop) const;
 
     SpectrumCollector channel_spectrum{};
 
     std::array<complex16_t, 256> spectrum{};
     size_t phase = 0, trigger = 127;
 
+    // Sweep mode, see WidebandSpectrumSweepConfigMessage.
+    int64_t sweep_first_center{0};
+    int64_t sweep_step{0};
+    bool sweep_irregular{false};
+    std::array<int64_t, WidebandSpectrumSweepConfigMessage::max_centers> sweep_centers{};
+    size_t sweep_hop_count{0};
+    size_t sweep_hop{0};
+    size_t sweep_discard{0};
+    size_t pending_hop{0};
+    size_t discard_remaining{0};
+    volatile bool retuning{false};
+    bool hop_requested{false};
+
     /* NB: Threads should be the last members in the class definition. */
     BasebandThread baseband_thread{baseband_fs, this, baseband::Direction::Receive};
     RSSIThread rssi_thread{};
@@ -77,11 +77,13 @@ void SpectrumCollector::feed(
     const buffer_c16_t& channel,
     const int32_t filter_low_frequency,
     const int32_t filter_high_frequency,
-    const int32_t filter_transition) {
+    const int32_t filter_transition,
+    const int64_t center_frequency) {
     // Called from baseband processing thread.
     channel_filter_low_frequency = filter_low_frequency;
     channel_filter_high_frequency = filter_high_frequency;
     channel_filter_transition = filter_transition;
+    channel_center_frequency = center_frequency;
 
     channel_spectrum_decimator.feed(
         channel,
@@ -95,6 +97,7 @@ void SpectrumCollector::post_message(const buffer_c16_t& data) {
     if (streaming && !channel_spectrum_request_update) {
         fft_swap(data, channel_spectrum);
         channel_spectrum_sampling_rate = data.sampling_rate;
+        channel_spectrum_center_frequency = channel_center_frequency;
         channel_spectrum_request_update = true;
         EventDispatcher::events_flag(EVT_MASK_SPECTRUM);
     }
@@ -139,6 +142,7 @@ void SpectrumCollector::update() {
         spectrum.channel_filter_low_frequency = channel_filter_low_frequency;
         spectrum.channel_filter_high_frequency = channel_filter_high_frequency;
         spectrum.channel_filter_transition = channel_filter_transition;
+        spectrum.center_frequency = channel_spectrum_center_frequency;
         for (size_t i = 0; i < spectrum.db.size(); i++) {
             const auto corrected_sample = spectrum_window_hamming_3(channel_spectrum, i);
             const auto mag2 = magnitude_squared(corrected_sample * (1.0f / 32768.0f));
@@ -45,7 +45,8 @@ class SpectrumCollector {
         const buffer_c16_t& channel,
         const int32_t filter_low_frequency,
         const int32_t filter_high_frequency,
-        const int32_t filter_transition);
+        const int32_t filter_transition,
+        const int64_t center_frequency = 0);
 
    private:
     BlockDecimator<complex16_t, 256> channel_spectrum_decimator{1};
@@ -59,6 +60,8 @@ class SpectrumCollector {
     int32_t channel_filter_low_frequency{0};
     int32_t channel_filter_high_frequency{0};
     int32_t channel_filter_transition{0};
+    int64_t channel_center_frequency{0};
+    int64_t channel_spectrum_center_frequency{0};
 
     void post_message(const buffer_c16_t& data);
 
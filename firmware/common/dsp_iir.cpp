@@ -55,6 +55,25 @@ void IIRBiquadFilter::execute_in_place(const buffer_f32_t& buffer) {
     execute(buffer, buffer);
 }
 
+void IIRBiquadFilter::reset() {
+    x = {0.0f, 0.0f, 0.0f};
+    y = {0.0f, 0.0f, 0.0f};
+}
+
+void IIRBiquadFixedFilter::configure(const iir_biquad_config_t& new_config) {
+    b0 = to_fixed(new_config.b[0]);
+    b1 = to_fixed(new_config.b[1]);
+    b2 = to_fixed(new_config.b[2]);
+    a1 = to_fixed(new_config.a[1]);
+    a2 = to_fixed(new_config.a[2]);
+}
+
+void IIRBiquadFixedFilter::reset() {
+    x1 = x2 = 0;
+    y1 = y2 = 0;
+    error = 0;
+}
+
 void IIRBiquadDF2Filter::configure(const iir_biquad_df2_config_t& config) {
     b0 = config[0] / config[3];
     b1 = config[1] / config[3];
@@ -62,12 +62,77 @@ class IIRBiquadFilter {
     void execute(const buffer_f32_t& buffer_in, const buffer_f32_t& buffer_out);
     void execute_in_place(const buffer_f32_t& buffer);
 
+    // Single sample step, for callers that fuse several stages into one loop.
+    float execute(const float in) {
+        x[0] = x[1];
+        x[1] = x[2];
+        x[2] = in;
+
+        y[0] = y[1];
+        y[1] = y[2];
+        y[2] = config.b[0] * x[2] + config.b[1] * x[1] + config.b[2] * x[0] - config.a[1] * y[1] - config.a[2] * y[0];
+
+        return y[2];
+    }
+
+    void reset();
+
    private:
     iir_biquad_config_t config;
     std::array<float, 3> x{{0.0f, 0.0f, 0.0f}};
     std::array<float, 3> y{{0.0f, 0.0f, 0.0f}};
 };
 
+/* Fixed point Direct Form I biquad for int16_t audio.
+ * Coefficients are Q2.29. Samples are carried with 8 extra fraction bits
+ * (int16_t << 8) and the truncation remainder is fed back into the next
+ * output, which keeps low cutoff HPFs (30Hz @ 48kHz) free of rumble. */
+class IIRBiquadFixedFilter {
+   public:
+    static constexpr int32_t coefficient_shift = 29;
+    static constexpr int32_t sample_shift = 8;
+
+    constexpr IIRBiquadFixedFilter()
+        : IIRBiquadFixedFilter(iir_config_no_pass) {
+    }
+
+    constexpr IIRBiquadFixedFilter(
+        const iir_biquad_config_t& config)
+        : b0{to_fixed(config.b[0])},
+          b1{to_fixed(config.b[1])},
+          b2{to_fixed(config.b[2])},
+          a1{to_fixed(config.a[1])},
+          a2{to_fixed(config.a[2])} {
+    }
+
+    void configure(const iir_biquad_config_t& new_config);
+    void reset();
+
+    // in and return value are int16_t << sample_shift.
+    int32_t execute(const int32_t in) {
+        const int64_t acc = (int64_t)b0 * in + (int64_t)b1 * x1 + (int64_t)b2 * x2 - (int64_t)a1 * y1 - (int64_t)a2 * y2 + error;
+        const int32_t out = acc >> coefficient_shift;
+        error = acc - ((int64_t)out << coefficient_shift);
+
+        x2 = x1;
+        x1 = in;
+        y2 = y1;
+        y1 = out;
+
+        return out;
+    }
+
+   private:
+    int32_t b0, b1, b2, a1, a2;
+    int32_t x1{0}, x2{0};
+    int32_t y1{0}, y2{0};
+    int32_t error{0};
+
+    static constexpr int32_t to_fixed(const double v) {
+        return v * (1 << coefficient_shift) + (v < 0 ? -0.5 : 0.5);
+    }
+};
+
 class IIRBiquadDF2Filter {
    public:
     void configure(const iir_biquad_df2_config_t& config);
@@ -117,6 +117,28 @@ class FIFO {
         return true;
     }
 
+    /* In place access, for elements too big to copy through a stack.
+     * The element in() would fill, or nullptr if full; commit_in() adds it. */
+    T* in_slot() {
+        return is_full() ? nullptr : &_data[_in & mask()];
+    }
+
+    void commit_in() {
+        smp_wmb();
+        _in += 1;
+    }
+
+    /* The element out() would return, or nullptr if empty; release_out()
+     * drops it once read. */
+    const T* out_slot() const {
+        return is_empty() ? nullptr : &_data[_out & mask()];
+    }
+
+    void release_out() {
+        smp_wmb();
+        _out += 1;
+    }
+
     size_t out(T* const buf, size_t len) {
         len = out_peek(buf, len);
         _out += len;
@@ -172,7 +194,12 @@ class FIFO {
     }
 
     void smp_wmb() {
+#if defined(__arm__)
         __DMB();
+#else
+        // Host builds (unit tests).
+        __sync_synchronize();
+#endif
     }
 
     size_t peek_n() {
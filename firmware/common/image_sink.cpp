@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "image_sink.hpp"
+
+#include "bmp.hpp"
+
+#include <cstring>
+
+namespace image {
+
+namespace {
+
+constexpr std::array<uint8_t, 8> png_signature{{0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a}};
+constexpr size_t png_ihdr_size = 4 + 4 + 13 + 4;
+
+void put_uint32_be(uint8_t* p, const uint32_t v) {
+    p[0] = (v >> 24) & 0xff;
+    p[1] = (v >> 16) & 0xff;
+    p[2] = (v >> 8) & 0xff;
+    p[3] = (v >> 0) & 0xff;
+}
+
+uint32_t bmp_row_size(const uint32_t width) {
+    return (width * 3 + 3) & ~3;
+}
+
+}  // namespace
+
+void RowEncoder::begin(Format format, uint32_t width, size_t block_size) {
+    format_ = format;
+    width_ = width;
+    block_size_ = block_size;
+    x_ = 0;
+    rows_ = 0;
+    buffer_.clear();
+    buffer_.reserve(block_size_ + 64);
+    offset_ = 0;
+    ready_ = 0;
+    chunk_start_ = no_chunk;
+    adler_ = {};
+
+    buffer_.resize(header_size());
+    header(buffer_.data());
+
+    if (format_ == Format::PNG) {
+        constexpr std::array<uint8_t, 2> zlib_header{{0x78, 0x01}};  // Deflate, no compression.
+        put(zlib_header.data(), zlib_header.size());
+    }
+}
+
+size_t RowEncoder::header_size() const {
+    return (format_ == Format::PNG) ? png_signature.size() + png_ihdr_size : sizeof(bmp_header_t);
+}
+
+size_t RowEncoder::header(uint8_t* out) const {
+    if (format_ == Format::PNG) {
+        std::memcpy(out, png_signature.data(), png_signature.size());
+        auto ihdr = out + png_signature.size();
+        put_uint32_be(&ihdr[0], 13);
+        std::memcpy(&ihdr[4], "IHDR", 4);
+        put_uint32_be(&ihdr[8], width_);
+        put_uint32_be(&ihdr[12], rows_);
+        ihdr[16] = 8;  // Bit depth.
+        ihdr[17] = 2;  // RGB.
+        ihdr[18] = 0;  // Deflate.
+        ihdr[19] = 0;  // Adaptive filtering, always 'none' here.
+        ihdr[20] = 0;  // Not interlaced.
+        auto crc = crc_;
+        crc.reset();
+        crc.process_bytes(&ihdr[4], 4 + 13);
+        put_uint32_be(&ihdr[21], crc.checksum());
+        return png_signature.size() + png_ihdr_size;
+    }
+
+    // As BMPFile::create() writes it.
+    const uint32_t row_size = bmp_row_size(width_);
+    const uint32_t rows = (offset_ > sizeof(bmp_header_t)) ? (offset_ - sizeof(bmp_header_t)) / row_size : 0;
+    const uint32_t data_size = rows * row_size;
+    bmp_header_t bmp_header{};
+    bmp_header.signature = 0x4D42;
+    bmp_header.size = sizeof(bmp_header_t) + data_size;
+    bmp_header.image_data = sizeof(bmp_header_t);
+    bmp_header.BIH_size = 0x28;
+    bmp_header.width = width_;
+    bmp_header.height = -int32_t(rows);  // Top-down.
+    bmp_header.planes = 1;
+    bmp_header.bpp = 24;
+    bmp_header.compression = 0;
+    bmp_header.data_size = data_size;
+    bmp_header.h_res = 100;
+    bmp_header.v_res = 100;
+    std::memcpy(out, &bmp_header, sizeof(bmp_header));
+    return sizeof(bmp_header);
+}
+
+void RowEncoder::row_prefix() {
+    // One stored deflate block per row, then the row's filter byte.
+    const uint32_t length = 1 + width_ * 3;
+    const std::array<uint8_t, 6> prefix{{
+        0x00,  // BFINAL=0, BTYPE=00
+        static_cast<uint8_t>(length & 0xff),
+        static_cast<uint8_t>((length >> 8) & 0xff),
+        static_cast<uint8_t>((length & 0xff) ^ 0xff),
+        static_cast<uint8_t>(((length >> 8) & 0xff) ^ 0xff),
+        0x00,  // Filter: none.
+    }};
+    put(prefix.data(), prefix.size());
+    adler_.feed(prefix[5]);
+}
+
+bool RowEncoder::pixel(ui::Color color) {
+    if (format_ == Format::PNG) {
+        if (x_ == 0)
+            row_prefix();
+        const std::array<uint8_t, 3> rgb{{color.r(), color.g(), color.b()}};
+        put(rgb.data(), rgb.size());
+        adler_.feed(rgb);
+    } else {
+        put_byte(color.b());
+        put_byte(color.g());
+        put_byte(color.r());
+    }
+
+    if (++x_ < width_)
+        return false;
+
+    x_ = 0;
+    rows_++;
+    if (format_ == Format::BMP) {
+        for (uint32_t i = width_ * 3; i < bmp_row_size(width_); i++)
+            put_byte(0);
+    }
+    return true;
+}
+
+void RowEncoder::finish() {
+    // Fills the last row, the PNG block lengths say it is complete.
+    while (x_ != 0)
+        pixel(ui::Color::black());
+
+    if (format_ == Format::PNG) {
+        constexpr std::array<uint8_t, 5> final_block{{0x01, 0x00, 0x00, 0xff, 0xff}};
+        put(final_block.data(), final_block.size());
+        const auto checksum = adler_.bytes();
+        put(checksum.data(), checksum.size());
+        if (chunk_start_ != no_chunk)
+            close_chunk();
+        put_chunk("IEND", nullptr, 0);
+    }
+    ready_ = buffer_.size();
+}
+
+void RowEncoder::consume() {
+    buffer_.erase(buffer_.begin(), buffer_.begin() + ready_);
+    offset_ += ready_;
+    if (chunk_start_ != no_chunk) {
+        chunk_start_ -= ready_;
+        chunk_end_ -= ready_;
+    }
+    ready_ = 0;
+}
+
+void RowEncoder::put_byte(const uint8_t b) {
+    if (format_ == Format::BMP) {
+        buffer_.push_back(b);
+        // Block sizes are powers of two.
+        ready_ = ((offset_ + buffer_.size()) & ~(block_size_ - 1)) - offset_;
+        return;
+    }
+
+    if (chunk_start_ == no_chunk)
+        open_chunk();
+    buffer_.push_back(b);
+    if (buffer_.size() == chunk_end_)
+        close_chunk();
+}
+
+void RowEncoder::put(const uint8_t* p, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        put_byte(p[i]);
+}
+
+/* Sized so that the chunk, CRC included, ends on the first block boundary
+ * after it that leaves room for some data. */
+void RowEncoder::open_chunk() {
+    chunk_start_ = buffer_.size();
+    const size_t start = offset_ + chunk_start_;
+    const size_t end = ((start + 12) / block_size_ + 1) * block_size_;
+    chunk_end_ = end - 4 - offset_;
+
+    buffer_.resize(chunk_start_ + 4);  // Length, see close_chunk().
+    buffer_.insert(buffer_.end(), {'I', 'D', 'A', 'T'});
+}
+
+void RowEncoder::close_chunk() {
+    const size_t length = buffer_.size() - chunk_start_ - 8;
+    put_uint32_be(&buffer_[chunk_start_], length);
+
+    crc_.reset();
+    crc_.process_bytes(&buffer_[chunk_start_ + 4], 4 + length);
+    const auto end = buffer_.size();
+    buffer_.resize(end + 4);
+    put_uint32_be(&buffer_[end], crc_.checksum());
+
+    chunk_start_ = no_chunk;
+    ready_ = buffer_.size();
+}
+
+void RowEncoder::put_chunk(const char* type, const uint8_t* p, size_t n) {
+    const auto start = buffer_.size();
+    buffer_.resize(start + 8 + n + 4);
+    put_uint32_be(&buffer_[start], n);
+    std::memcpy(&buffer_[start + 4], type, 4);
+    if (n)
+        std::memcpy(&buffer_[start + 8], p, n);
+
+    crc_.reset();
+    crc_.process_bytes(&buffer_[start + 4], 4 + n);
+    put_uint32_be(&buffer_[start + 8 + n], crc_.checksum());
+}
+
+}  // namespace image
+
+ImageSink::~ImageSink() {
+    close();
+}
+
+bool ImageSink::create(const std::filesystem::path& path, uint32_t width, image::Format format) {
+    close();
+    // Truncates an existing file.
+    if (file_.create(path).is_valid())
+        return false;
+
+    encoder_.begin(format, width);
+    is_open_ = true;
+    error_ = false;
+    return true;
+}
+
+void ImageSink::close() {
+    if (!is_open_)
+        return;
+
+    encoder_.finish();
+    flush();
+    write_header();
+    file_.close();
+    is_open_ = false;
+}
+
+bool ImageSink::write_pixel(ui::Color color) {
+    if (!is_open_ || error_)
+        return false;
+
+    const auto row_done = encoder_.pixel(color);
+    if (encoder_.ready() >= encoder_.block_size())
+        flush();
+    if (row_done && (encoder_.rows() % header_interval) == 0)
+        write_header();
+    return !error_;
+}
+
+void ImageSink::flush() {
+    if (encoder_.ready() == 0)
+        return;
+
+    const auto result = file_.write(encoder_.data(), encoder_.ready());
+    if (result.is_error())
+        error_ = true;
+    encoder_.consume();
+}
+
+/* Not while the header is still in the encoder's first block. */
+void ImageSink::write_header() {
+    std::array<uint8_t, image::RowEncoder::max_header_size> header{};
+    const auto size = encoder_.header(header.data());
+    if (encoder_.offset() < size)
+        return;
+
+    file_.seek(0);
+    file_.write(header.data(), size);
+    file_.seek(encoder_.offset());
+    file_.sync();
+}
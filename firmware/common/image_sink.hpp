@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __IMAGE_SINK_H__
+#define __IMAGE_SINK_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "crc.hpp"
+#include "file.hpp"
+#include "ui.hpp"
+
+namespace image {
+
+enum class Format : uint8_t {
+    BMP,  // 24 bit, top-down.
+    PNG,  // 8 bit RGB, stored (uncompressed) deflate blocks.
+};
+
+/* Turns pixels, row after row, into the bytes of a BMP or PNG file of
+ * fixed width and growing height. Hands the bytes out in whole blocks
+ * aligned to the start of the file, so the writes that follow cover
+ * whole SD card sectors. Block sizes are powers of two.
+ *
+ * The header goes out first with a height of 0, header() gives the one
+ * to write over it later. */
+class RowEncoder {
+   public:
+    static constexpr size_t default_block_size = 2048;
+
+    void begin(Format format, uint32_t width, size_t block_size = default_block_size);
+
+    /* Adds the next pixel, true when it ends a row. */
+    bool pixel(ui::Color color);
+    /* Ends the file, after which ready() covers everything left. */
+    void finish();
+
+    Format format() const { return format_; }
+    uint32_t width() const { return width_; }
+    uint32_t rows() const { return rows_; }
+
+    /* ready() bytes starting at file offset offset(). */
+    const uint8_t* data() const { return buffer_.data(); }
+    size_t ready() const { return ready_; }
+    uint32_t offset() const { return offset_; }
+    size_t block_size() const { return block_size_; }
+    /* The ready() bytes were written. */
+    void consume();
+
+    /* Header to write at offset 0, returns its size. A BMP header counts
+     * the rows consumed so far, so it can go out before finish(). */
+    static constexpr size_t max_header_size = 54;
+    size_t header_size() const;
+    size_t header(uint8_t* out) const;
+
+   private:
+    Format format_{Format::BMP};
+    uint32_t width_{0};
+    size_t block_size_{default_block_size};
+    uint32_t x_{0};
+    uint32_t rows_{0};
+
+    std::vector<uint8_t> buffer_{};
+    uint32_t offset_{0};
+    size_t ready_{0};
+
+    // PNG: the IDAT chunk being filled, ending on a block boundary.
+    static constexpr size_t no_chunk = SIZE_MAX;
+    size_t chunk_start_{no_chunk};  // Into buffer_.
+    size_t chunk_end_{0};           // Of its data, into buffer_.
+    Adler32 adler_{};
+    CRC<32, true, true> crc_{0x04c11db7, 0xffffffff, 0xffffffff};
+
+    void put_byte(uint8_t b);
+    void put(const uint8_t* p, size_t n);
+    void open_chunk();
+    void close_chunk();
+    void put_chunk(const char* type, const uint8_t* p, size_t n);
+    void row_prefix();
+};
+
+}  // namespace image
+
+/* Writes an image as it arrives, pixel by pixel, to the SD card in
+ * block sized writes. Rewrites the header on close() and, so a BMP cut
+ * short keeps what was received, every header_interval rows. */
+class ImageSink {
+   public:
+    static constexpr uint32_t header_interval = 64;
+
+    ~ImageSink();
+
+    bool create(const std::filesystem::path& path, uint32_t width, image::Format format = image::Format::BMP);
+    void close();
+    bool is_open() const { return is_open_; }
+
+    /* Rows wrap every 'width' pixels. False once a write failed. */
+    bool write_pixel(ui::Color color);
+
+    uint32_t rows() const { return encoder_.rows(); }
+
+   private:
+    File file_{};
+    image::RowEncoder encoder_{};
+    bool is_open_{false};
+    bool error_{false};
+
+    void flush();
+    void write_header();
+};
+
+#endif /*__IMAGE_SINK_H__*/
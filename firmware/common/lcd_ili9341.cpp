@@ -35,6 +35,7 @@ using namespace portapack;
 
 #include "portapack_persistent_memory.hpp"
 
+#include <algorithm>
 #include <complex>
 
 #include <cstring>
@@ -738,57 +739,82 @@ void ILI9341::draw_bitmap(
     const ui::Color foreground,
     const ui::Color background,
     uint8_t zoom_level) {
-    if (zoom_level <= 1) {
-        // Not a transparent background
-        if (ui::Color::magenta().v != background.v) {
-            lcd_start_ram_write(p, size);
-
-            const size_t count = size.width() * size.height();
-            for (size_t i = 0; i < count; i++) {
-                const auto pixel = pixels[i >> 3] & (1U << (i & 0x7));
-                io.lcd_write_pixel(pixel ? foreground : background);
-            }
-        } else {
-            // transparent bg
-            int x = p.x();
-            int y = p.y();
-            int maxX = x + size.width();
-            const size_t count = size.width() * size.height();
-            for (size_t i = 0; i < count; i++) {
-                const auto pixel = pixels[i >> 3] & (1U << (i & 0x7));
-                if (pixel) {
-                    if (x <= screen_width && y <= screen_height) draw_pixel(ui::Point(x, y), foreground);
-                }
-                // move to next px
-                x++;
-                if (x >= maxX) {
-                    x = p.x();
-                    y++;
-                }
-            }
-        }
-    } else {  // zoom
-
-        // dot to square
-        for (int y = 0; y < size.height(); y++) {
-            for (int x = 0; x < size.width(); x++) {
-                // pos
-                size_t bit_index = y * size.width() + x;
-                int byte_index = bit_index >> 3;
-                int bit_pos = bit_index & 0x7;
-
-                // val
-                const auto pixel = pixels[byte_index] & (1U << bit_pos);
-                /*                 ^ the byte_index-th bit AKA current bit
-                                                         ^ current px in current byte*/
-
-                if (pixel || background.v != ui::Color::magenta().v) {
-                    fill_rectangle(
-                        {p.x() + x * zoom_level, p.y() + y * zoom_level,
-                         zoom_level, zoom_level},
-                        pixel ? foreground : background);
-                }
+    // Transparent background (magenta) or zoomed.
+    if (zoom_level > 1 || ui::Color::magenta().v == background.v) {
+        draw_bitmap_runs(p, size, pixels, foreground, background, std::max<uint8_t>(zoom_level, 1));
+        return;
+    }
+
+    // Pixel i is bit i % 8 of byte i / 8, rows are not padded.
+    lcd_start_ram_write(p, size);
+    const auto words = expand_nibbles(foreground, background);
+    const size_t count = size.width() * size.height();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto byte = pixels[i >> 3];
+        io.lcd_write_words(&words[(byte & 15) * 4], 4);
+        io.lcd_write_words(&words[(byte >> 4) * 4], 4);
+    }
+    for (; i < count; i++) {
+        const auto pixel = pixels[i >> 3] & (1U << (i & 0x7));
+        io.lcd_write_word(words[pixel ? 15 * 4 : 0]);
+    }
+}
+
+const uint16_t* ILI9341::expand_nibbles(const ui::Color foreground, const ui::Color background) {
+    const uint8_t dimming = io.dark_cover_enabled ? 1 + io.brightness : 0;
+    for (const auto& entry : nibble_colors) {
+        if (entry.foreground.v == foreground.v && entry.background.v == background.v && entry.dimming == dimming)
+            return entry.words.data();
+    }
+
+    auto& entry = nibble_colors[nibble_colors_next];
+    nibble_colors_next = (nibble_colors_next + 1) % nibble_colors.size();
+    entry.foreground = foreground;
+    entry.background = background;
+    entry.dimming = dimming;
+
+    auto fg = foreground.v;
+    auto bg = background.v;
+    if (dimming) {
+        fg = DARKENED_PIXEL(fg, io.brightness);
+        bg = DARKENED_PIXEL(bg, io.brightness);
+    }
+    for (size_t nibble = 0; nibble < 16; nibble++) {
+        for (size_t bit = 0; bit < 4; bit++)
+            entry.words[nibble * 4 + bit] = (nibble & (1U << bit)) ? fg : bg;
+    }
+    return entry.words.data();
+}
+
+void ILI9341::draw_bitmap_runs(
+    const ui::Point p,
+    const ui::Size size,
+    const uint8_t* const pixels,
+    const ui::Color foreground,
+    const ui::Color background,
+    uint8_t zoom) {
+    const bool transparent = ui::Color::magenta().v == background.v;
+    const auto bit = [pixels](size_t i) {
+        return (pixels[i >> 3] >> (i & 0x7)) & 1;
+    };
+
+    for (int y = 0; y < size.height(); y++) {
+        const size_t row = y * size.width();
+        int x = 0;
+        while (x < size.width()) {
+            const auto value = bit(row + x);
+            int end = x + 1;
+            while (end < size.width() && bit(row + end) == value)
+                end++;
+
+            // fill_rectangle() clips to the screen.
+            if (value || !transparent) {
+                fill_rectangle(
+                    {p.x() + x * zoom, p.y() + y * zoom, (end - x) * zoom, zoom},
+                    value ? foreground : background);
             }
+            x = end;
         }
     }
 }
@@ -158,6 +158,31 @@ class ILI9341 {
     void read_pixels(const ui::Rect r, ui::ColorRGB888* const colors, const size_t count);
 
    private:
+    /* Opaque 1 bit bitmaps (the fonts and icons) go out 4 pixels at a time
+     * from the RGB565 words of every 4 bit pattern, worked out once per
+     * foreground, background and dimming. The last two color pairs are
+     * kept: text mostly comes in one style and its inverse. */
+    struct NibbleColors {
+        ui::Color foreground;
+        ui::Color background;
+        uint8_t dimming;  // 0: off, else 1 + brightness.
+        std::array<uint16_t, 16 * 4> words;
+    };
+    std::array<NibbleColors, 2> nibble_colors{};
+    size_t nibble_colors_next{0};
+
+    const uint16_t* expand_nibbles(const ui::Color foreground, const ui::Color background);
+
+    /* Draws the runs of 'zoom' sized dots, skipping the background ones
+     * when it is transparent. */
+    void draw_bitmap_runs(
+        const ui::Point p,
+        const ui::Size size,
+        const uint8_t* const pixels,
+        const ui::Color foreground,
+        const ui::Color background,
+        uint8_t zoom);
+
     struct scroll_t {
         ui::Coord top_area;
         ui::Coord bottom_area;
@@ -133,9 +133,15 @@ class Message {
         WFMAMConfigure = 76,
         NoaaAptRxConfigure = 77,
         NoaaAptRxStatusData = 78,
-        NoaaAptRxImageData = 79,
+        NoaaAptRxLineConfig = 79,
         FSKPacket = 80,
         EPIRBPacket = 81,
+        WidebandSpectrumSweepConfig = 82,
+        SpectrumSweepRetune = 83,
+        SpectrumSweepTuned = 84,
+        ChannelizerConfigure = 85,
+        ChannelizerActivity = 86,
+        AnalogTvField = 87,
         MAX
     };
 
@@ -290,6 +296,71 @@ class WidebandSpectrumConfigMessage : public Message {
     size_t trigger{0};
 };
 
+/* Sweep mode for the wideband spectrum. The baseband steps through the
+ * hop_count center frequencies first_center + n * step over and over,
+ * asking the application to retune to each one with a
+ * SpectrumSweepRetuneMessage and dropping 'discard' buffers after the
+ * SpectrumSweepTunedMessage reply while the synthesizers settle. Spectra
+ * are tagged with the center frequency they were taken at.
+ * Irregular hop lists of up to max_centers are copied into 'centers'
+ * instead. hop_count == 0 stops sweeping. */
+class WidebandSpectrumSweepConfigMessage : public Message {
+   public:
+    static constexpr size_t max_centers = 64;
+
+    constexpr WidebandSpectrumSweepConfigMessage(
+        int64_t first_center,
+        int64_t step,
+        size_t hop_count,
+        size_t discard)
+        : Message{ID::WidebandSpectrumSweepConfig},
+          first_center{first_center},
+          step{step},
+          hop_count{hop_count},
+          discard{discard} {
+    }
+
+    WidebandSpectrumSweepConfigMessage(
+        const int64_t* const centers,
+        size_t hop_count,
+        size_t discard)
+        : Message{ID::WidebandSpectrumSweepConfig},
+          hop_count{std::min(hop_count, max_centers)},
+          discard{discard},
+          irregular{true} {
+        std::copy_n(centers, this->hop_count, this->centers.begin());
+    }
+
+    int64_t first_center{0};
+    int64_t step{0};
+    size_t hop_count{0};
+    size_t discard{0};
+    bool irregular{false};
+    std::array<int64_t, max_centers> centers{};
+};
+
+class SpectrumSweepRetuneMessage : public Message {
+   public:
+    constexpr SpectrumSweepRetuneMessage(
+        size_t hop)
+        : Message{ID::SpectrumSweepRetune},
+          hop{hop} {
+    }
+
+    size_t hop{0};
+};
+
+class SpectrumSweepTunedMessage : public Message {
+   public:
+    constexpr SpectrumSweepTunedMessage(
+        size_t hop)
+        : Message{ID::SpectrumSweepTuned},
+          hop{hop} {
+    }
+
+    size_t hop{0};
+};
+
 struct AudioSpectrum {
     std::array<uint8_t, 128> db{{0}};
     // uint32_t sampling_rate { 0 };
@@ -312,6 +383,7 @@ struct ChannelSpectrum {
     int32_t channel_filter_low_frequency{0};
     int32_t channel_filter_high_frequency{0};
     int32_t channel_filter_transition{0};
+    int64_t center_frequency{0};  // Only set by sweeping processors.
 };
 
 using ChannelSpectrumFIFO = FIFO<ChannelSpectrum>;
@@ -596,6 +668,47 @@ class NBFMConfigureMessage : public Message {
     const uint8_t squelch_level;
 };
 
+/* One receiver window split in channel_count channels, sampling_rate /
+ * channel_count apart. Up to max_monitored of them (channel index as in
+ * ChannelizerActivityMessage, -1 for none) are FM demodulated and mixed
+ * to the audio output while above squelch_level (activity level scale).
+ * While a capture stream is set, the audio is the recorded channel alone. */
+class ChannelizerConfigureMessage : public Message {
+   public:
+    static constexpr size_t channel_count = 256;
+    static constexpr size_t max_monitored = 4;
+
+    constexpr ChannelizerConfigureMessage(
+        const uint32_t sampling_rate,
+        const std::array<int16_t, max_monitored> monitored,
+        const uint8_t squelch_level,
+        const int16_t recorded)
+        : Message{ID::ChannelizerConfigure},
+          sampling_rate{sampling_rate},
+          monitored(monitored),
+          squelch_level{squelch_level},
+          recorded{recorded} {
+    }
+
+    const uint32_t sampling_rate;
+    const std::array<int16_t, max_monitored> monitored;
+    const uint8_t squelch_level;
+    const int16_t recorded;
+};
+
+/* Average power of every channel since the last message, in half dB
+ * steps with 255 at the full scale of the 8 bit input. Channels are
+ * indexed like FFT bins: 0 at the center, channel_count / 2.. below it. */
+class ChannelizerActivityMessage : public Message {
+   public:
+    constexpr ChannelizerActivityMessage()
+        : Message{ID::ChannelizerActivity} {
+    }
+
+    std::array<uint8_t, ChannelizerConfigureMessage::channel_count> level{};
+    uint8_t open_mask{0};  // Bit n: monitored[n] is above squelch.
+};
+
 class WFMConfigureMessage : public Message {
    public:
     constexpr WFMConfigureMessage(
@@ -604,14 +717,16 @@ class WFMConfigureMessage : public Message {
         const fir_taps_real<64> audio_filter,
         const size_t deviation,
         const iir_biquad_config_t audio_hpf_config,
-        const iir_biquad_config_t audio_deemph_config)
+        const iir_biquad_config_t audio_deemph_config,
+        const bool stereo = false)
         : Message{ID::WFMConfigure},
           decim_0_filter(decim_0_filter),
           decim_1_filter(decim_1_filter),
           audio_filter(audio_filter),
           deviation{deviation},
           audio_hpf_config(audio_hpf_config),
-          audio_deemph_config(audio_deemph_config) {
+          audio_deemph_config(audio_deemph_config),
+          stereo{stereo} {
     }
 
     const fir_taps_real<24> decim_0_filter;
@@ -620,6 +735,7 @@ class WFMConfigureMessage : public Message {
     const size_t deviation;
     const iir_biquad_config_t audio_hpf_config;
     const iir_biquad_config_t audio_deemph_config;
+    const bool stereo;
 };
 
 class WFMAMConfigureMessage : public Message {
@@ -770,7 +886,7 @@ struct CaptureConfig {
             return 0;
         } else {
             const size_t percent = baseband_bytes_dropped * 100U / baseband_bytes_received;
-            return std::max(1U, percent);
+            return std::max<size_t>(1U, percent);
         }
     }
 };
@@ -1561,12 +1677,58 @@ class NoaaAptRxStatusDataMessage : public Message {
     uint8_t state = 0;
 };
 
-class NoaaAptRxImageDataMessage : public Message {
+/* One line of a NOAA APT image: sync A, channel A, sync B, channel B and
+ * their telemetry, one byte a word. */
+struct NoaaAptLine {
+    static constexpr size_t width = 2080;
+
+    std::array<uint8_t, width> words;
+    bool synced;  // Its sync was found, else it starts where one was expected.
+};
+
+using NoaaAptLineFIFO = FIFO<NoaaAptLine>;
+
+/* Lines are too big for messages, the M0 reads them off this FIFO in
+ * place: see FIFO::out_slot(). */
+class NoaaAptRxLineConfigMessage : public Message {
    public:
-    constexpr NoaaAptRxImageDataMessage()
-        : Message{ID::NoaaAptRxImageData} {}
-    uint8_t image[400]{0};
-    uint32_t cnt = 0;
+    static constexpr size_t fifo_k = 1;
+
+    constexpr NoaaAptRxLineConfigMessage(
+        NoaaAptLineFIFO* fifo)
+        : Message{ID::NoaaAptRxLineConfig},
+          fifo{fifo} {
+    }
+
+    NoaaAptLineFIFO* fifo{nullptr};
+};
+
+/* One field of analog TV, cut at its syncs and scaled to 'width' x
+ * 'height', one grey byte a pixel. */
+struct AnalogTvField {
+    static constexpr size_t width = 120;
+    static constexpr size_t height = 180;
+
+    std::array<uint8_t, width * height> pixels;
+    uint16_t lines;  // Rows filled, fewer if vertical sync came early.
+    bool line_locked;
+    bool field_locked;
+};
+
+using AnalogTvFieldFIFO = FIFO<AnalogTvField>;
+
+/* Sent for every field, read in place like NoaaAptRxLineConfigMessage. */
+class AnalogTvFieldMessage : public Message {
+   public:
+    static constexpr size_t fifo_k = 1;
+
+    constexpr AnalogTvFieldMessage(
+        AnalogTvFieldFIFO* fifo)
+        : Message{ID::AnalogTvField},
+          fifo{fifo} {
+    }
+
+    AnalogTvFieldFIFO* fifo{nullptr};
 };
 
 #endif /*__MESSAGE_H__*/
@@ -225,133 +225,6 @@ void pocsag_encode(const MessageType type, BCHCode& BCH_code, const uint32_t fun
     } while (char_idx < message_size);
 }
 
-// ----------------------------------------------------------------------------
-// EccContainer
-// ----------------------------------------------------------------------------
-EccContainer::EccContainer() {
-    setup_ecc();
-}
-
-void EccContainer::setup_ecc() {
-    unsigned int srr = 0x3b4;
-    unsigned int i, n, j, k;
-
-    /* calculate all information needed to implement error correction */
-    // Note : this is only for 31,21 code used in pocsag & flex
-    //        one should probably also make use of 32nd parity bit
-    for (i = 0; i <= 20; i++) {
-        ecs[i] = srr;
-        if ((srr & 0x01) != 0)
-            srr = (srr >> 1) ^ 0x3B4;
-        else
-            srr = srr >> 1;
-    }
-
-    /* bch holds a syndrome look-up table telling which bits to correct */
-    // first 5 bits hold location of first error; next 5 bits hold location
-    // of second error; bits 12 & 13 tell how many bits are bad
-    for (i = 0; i < 1024; i++) bch[i] = 0;
-
-    /* two errors in data */
-    for (n = 0; n <= 20; n++) {
-        for (i = 0; i <= 20; i++) {
-            j = (i << 5) + n;
-            k = ecs[n] ^ ecs[i];
-            bch[k] = j + 0x2000;
-        }
-    }
-
-    /* one error in data */
-    for (n = 0; n <= 20; n++) {
-        k = ecs[n];
-        j = n + (0x1f << 5);
-        bch[k] = j + 0x1000;
-    }
-
-    /* one error in data and one error in ecc portion */
-    for (n = 0; n <= 20; n++) {
-        for (i = 0; i < 10; i++) /* ecc screwed up bit */
-        {
-            k = ecs[n] ^ (1 << i);
-            j = n + (0x1f << 5);
-            bch[k] = j + 0x2000;
-        }
-    }
-
-    /* one error in ecc */
-    for (n = 0; n < 10; n++) {
-        k = 1 << n;
-        bch[k] = 0x3ff + 0x1000;
-    }
-
-    /* two errors in ecc */
-    for (n = 0; n < 10; n++) {
-        for (i = 0; i < 10; i++) {
-            if (i != n) {
-                k = (1 << n) ^ (1 << i);
-                bch[k] = 0x3ff + 0x2000;
-            }
-        }
-    }
-}
-
-int EccContainer::error_correct(uint32_t& val) {
-    int i, synd, errl, acc, pari, ecc, b1, b2;
-
-    errl = 0;
-    pari = 0;
-
-    ecc = 0;
-    for (i = 31; i >= 11; --i) {
-        if (val & (1 << i)) {
-            ecc = ecc ^ ecs[31 - i];
-            pari = pari ^ 0x01;
-        }
-    }
-
-    acc = 0;
-    for (i = 10; i >= 1; --i) {
-        acc = acc << 1;
-        if (val & (1 << i)) {
-            acc = acc ^ 0x01;
-        }
-    }
-
-    synd = ecc ^ acc;
-
-    errl = 0;
-
-    if (synd != 0) /* if nonzero syndrome we have error */
-    {
-        if (bch[synd] != 0) /* check for correctable error */
-        {
-            b1 = bch[synd] & 0x1f;
-            b2 = bch[synd] >> 5;
-            b2 = b2 & 0x1f;
-
-            if (b2 != 0x1f) {
-                val ^= 0x01 << (31 - b2);
-                ecc = ecc ^ ecs[b2];
-            }
-
-            if (b1 != 0x1f) {
-                val ^= 0x01 << (31 - b1);
-                ecc = ecc ^ ecs[b1];
-            }
-
-            errl = bch[synd] >> 12;
-        } else {
-            errl = 3;
-        }
-
-        if (errl == 1) pari = pari ^ 0x01;
-    }
-
-    if (errl == 4) errl = 3;
-
-    return errl;
-}
-
 bool pocsag_decode_batch(const POCSAGPacket& batch, POCSAGState& state) {
     constexpr uint8_t codeword_max = 16;
     state.output.clear();
@@ -360,10 +233,11 @@ bool pocsag_decode_batch(const POCSAGPacket& batch, POCSAGState& state) {
         auto codeword = batch[state.codeword_index];
         bool is_address = (codeword & 0x80000000U) == 0;
 
-        // Error correct twice. First time to fix any errors it can,
-        // second time to count number of errors that couldn't be fixed.
-        state.ecc->error_correct(codeword);
-        auto error_count = state.ecc->error_correct(codeword);
+        // The baseband has already corrected what it could,
+        // only count the errors that are left.
+        uint32_t error_count = 0;
+        if (batch.errors(state.codeword_index) == bch::uncorrectable)
+            error_count = bch::uncorrectable;
 
         switch (state.mode) {
             case STATE_CLEAR:
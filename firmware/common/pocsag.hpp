@@ -30,6 +30,7 @@
 #define POCSAG_AUDIO_RATE 24000
 #define POCSAG_BATCH_LENGTH (17 * 32)
 
+#include "pocsag_bch.hpp"
 #include "pocsag_packet.hpp"
 #include "bch_code.hpp"
 
@@ -56,29 +57,7 @@ enum MessageType : uint32_t {
     ALPHANUMERIC
 };
 
-/* Holds error correction arrays. This allows the arrays to
- * be freed when POCSAG is not running, saving ~4kb of RAM. */
-class EccContainer {
-   public:
-    EccContainer();
-
-    EccContainer(const EccContainer&) = delete;
-    EccContainer(EccContainer&&) = delete;
-    EccContainer& operator=(const EccContainer&) = delete;
-    EccContainer& operator=(EccContainer&&) = delete;
-
-    int error_correct(uint32_t& val);
-
-   private:
-    void setup_ecc();
-
-    /* error correction sequence */
-    uint32_t ecs[32];
-    uint32_t bch[1025];
-};
-
 struct POCSAGState {
-    EccContainer* ecc = nullptr;
     uint8_t codeword_index = 0;
     uint32_t function = 0;
     uint32_t address = 0;
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __POCSAG_BCH_H__
+#define __POCSAG_BCH_H__
+
+#include <array>
+#include <cstdint>
+
+/* BCH(31,21) + even parity error correction for POCSAG codewords.
+ *
+ * Codeword layout: bits 31..11 data, bits 10..1 BCH check bits, bit 0
+ * even parity. The syndrome of the 31 bit BCH part indexes a table that
+ * is built at compile time, so correcting a codeword is one polynomial
+ * division and one lookup, with no setup cost or RAM for the table. */
+namespace pocsag {
+namespace bch {
+
+/* g(x) = x^10 + x^9 + x^8 + x^6 + x^5 + x^3 + 1 */
+constexpr uint32_t generator = 0x769;
+constexpr uint8_t check_bits = 10;
+constexpr uint8_t code_bits = 31;
+
+/* Returned by correct() when the codeword has more errors than can be fixed. */
+constexpr uint8_t uncorrectable = 3;
+
+/* Remainder of the 31 bit BCH part (codeword >> 1) divided by g(x). */
+constexpr uint16_t syndrome(uint32_t codeword) {
+    uint32_t value = codeword >> 1;
+    for (int8_t bit = code_bits - 1; bit >= check_bits; --bit) {
+        if (value & (1u << bit))
+            value ^= generator << (bit - check_bits);
+    }
+    return value;
+}
+
+/* Syndrome table entry: bits 0-4 and 5-9 are the codeword bit numbers (1-31)
+ * of up to two flipped bits, bits 10-11 the error count.
+ * Zero means the syndrome doesn't belong to a correctable pattern. */
+using syndrome_table_t = std::array<uint16_t, 1 << check_bits>;
+
+constexpr syndrome_table_t make_syndrome_table() {
+    syndrome_table_t table{};
+    for (uint8_t i = 1; i <= code_bits; ++i) {
+        const auto single = syndrome(1u << i);
+        table[single] = (1 << 10) | i;
+
+        for (uint8_t j = i + 1; j <= code_bits; ++j) {
+            const auto pair = single ^ syndrome(1u << j);
+            table[pair] = (2 << 10) | (j << 5) | i;
+        }
+    }
+    return table;
+}
+
+inline constexpr syndrome_table_t syndrome_table = make_syndrome_table();
+
+/* Fills in the check and parity bits of a codeword whose data bits are set. */
+constexpr uint32_t encode(uint32_t codeword) {
+    codeword &= 0xFFFFF800;
+    codeword |= syndrome(codeword) << 1;
+    return codeword | (__builtin_popcount(codeword) & 1);
+}
+
+/* Corrects the codeword in place. Returns the number of bits that were
+ * flipped, or 'uncorrectable' if the codeword is beyond repair (in which
+ * case it is left as received). */
+inline uint8_t correct(uint32_t& codeword) {
+    const uint32_t received = codeword;
+    uint8_t errors = 0;
+
+    if (const auto s = syndrome(codeword); s != 0) {
+        const auto entry = syndrome_table[s];
+        if (entry == 0)
+            return uncorrectable;
+
+        const uint8_t first = entry & 0x1F;
+        const uint8_t second = (entry >> 5) & 0x1F;
+        codeword ^= 1u << first;
+        if (second != 0)
+            codeword ^= 1u << second;
+        errors = entry >> 10;
+    }
+
+    // A parity error left over is a flip in the parity bit itself.
+    if (__builtin_popcount(codeword) & 1) {
+        if (errors == 2) {
+            codeword = received;
+            return uncorrectable;
+        }
+        codeword ^= 1;
+        ++errors;
+    }
+
+    return errors;
+}
+
+} /* namespace bch */
+} /* namespace pocsag */
+
+#endif /*__POCSAG_BCH_H__*/
@@ -72,6 +72,19 @@ class POCSAGPacket {
         return (index < batch_size) ? codewords[index] : 0;
     }
 
+    /* Bit errors corrected in a codeword by the baseband,
+     * bch::uncorrectable if it could not be repaired. */
+    void set_errors(size_t index, uint8_t count) {
+        if (index < batch_size) {
+            const auto shift = index * 2;
+            errors_ = (errors_ & ~(0x3u << shift)) | ((count & 0x3u) << shift);
+        }
+    }
+
+    uint8_t errors(size_t index) const {
+        return (index < batch_size) ? (errors_ >> (index * 2)) & 0x3 : 0;
+    }
+
     void set_bitrate(uint16_t bitrate) {
         bitrate_ = bitrate;
     }
@@ -90,6 +103,7 @@ class POCSAGPacket {
 
     void clear() {
         codewords.fill(0);
+        errors_ = 0;
         bitrate_ = 0u;
         flag_ = NORMAL;
     }
@@ -98,6 +112,7 @@ class POCSAGPacket {
     uint16_t bitrate_{0};
     PacketFlag flag_{NORMAL};
     batch_t codewords{};
+    uint32_t errors_{0};  // 2 bits per codeword.
     Timestamp timestamp_{};
 };
 
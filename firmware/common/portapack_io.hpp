@@ -357,6 +357,13 @@ class IO {
         return (LPC_GPIO->MPIN[gpio_data_port_id] >> gpio_data_shift) & 0xffU;
     }
 
+#if defined(PORTAPACK_HOST_DISPLAY)
+    /* Host builds replace the LCD bus with an emulated controller, see
+     * test/ui/host_display.cpp. */
+    void lcd_command(const uint32_t value);
+    void lcd_write_data(const uint32_t value);
+    uint32_t lcd_read_data();
+#else
     void lcd_command(const uint32_t value) {
         data_write_high(0); /* Drive high byte (with zero -- don't care) */
         dir_write();        /* Turn around data bus, MCU->CPLD */
@@ -462,6 +469,8 @@ class IO {
         return original_value;
     }
 
+#endif
+
     void io_write(const bool address, const uint_fast16_t value) {
         data_write_low(value);
         dir_write();
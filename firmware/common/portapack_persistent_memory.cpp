@@ -37,6 +37,7 @@
 #include "utility.hpp"
 #include "rtc_time.hpp"
 #include "file_path.hpp"
+#include "word_crc.hpp"
 
 #include <algorithm>
 #include <string>
@@ -379,6 +380,33 @@ struct backup_ram_t {
         copy(*this, dst);
     }
 
+    /* As persist_to(), but `persisted` holds what was last persisted and
+     * its check value: only the words that changed since then go into
+     * the check value, and only the words `dst` doesn't hold already
+     * get written. Returns true if any word changed.
+     */
+    bool persist_changes_to(backup_ram_t& persisted, backup_ram_t& dst) {
+        static constexpr WordCRC32<PMEM_SIZE_WORDS - 1> word_crc{};
+
+        bool changed = false;
+        uint32_t check = persisted.check_value;
+        for (size_t i = 0; i < PMEM_SIZE_WORDS - 1; i++) {
+            const uint32_t word = regfile[i];
+            if (word != persisted.regfile[i]) {
+                check = word_crc.update(check, i, persisted.regfile[i], word);
+                persisted.regfile[i] = word;
+                changed = true;
+            }
+            if (dst.regfile[i] != word)
+                dst.regfile[i] = word;
+        }
+        persisted.check_value = check;
+        check_value = check;
+        if (dst.check_value != check)
+            dst.check_value = check;
+        return changed;
+    }
+
     /* Access functions for DebugPmemView */
     uint32_t pmem_data_word(uint32_t index) {
         return (index > sizeof(regfile) / sizeof(uint32_t)) ? 0xFFFFFFFF : regfile[index];
@@ -404,12 +432,35 @@ static_assert(sizeof(data_t) <= sizeof(backup_ram_t) - sizeof(uint32_t));
 static backup_ram_t* const backup_ram = reinterpret_cast<backup_ram_t*>(memory::map::backup_ram.base());
 
 static backup_ram_t cached_backup_ram;
-static data_t* data = reinterpret_cast<data_t*>(&cached_backup_ram);
+
+/* The cache as of the last persist(), for the check value to follow. */
+static backup_ram_t persisted_backup_ram;
+static bool cache_dirty = true;
+
+/* Setters go through `data`, which marks the cache for the next
+ * persist() to compare. Reads go through `cdata`, so a clean cache stays
+ * clean; getters that reset an out of range value only use `data` when
+ * they do. */
+static struct {
+    data_t* operator->() const {
+        cache_dirty = true;
+        return reinterpret_cast<data_t*>(&cached_backup_ram);
+    }
+} data;
+static const data_t* const cdata = reinterpret_cast<const data_t*>(&cached_backup_ram);
+
+/* Write-behind of the settings file, see save_persistent_settings_to_file_later(). */
+static constexpr uint8_t settings_file_delay = 2;  // persist() calls, i.e. seconds.
+static uint8_t settings_file_wait = 0;
+static uint32_t settings_file_check = 0;
+
+static bool write_settings_file();
 
 namespace cache {
 
 void defaults() {
     cached_backup_ram = backup_ram_t();
+    cache_dirty = true;
 
     // If the desired default is 0/false, then no need to set it here (buffer is initialized to 0)
     // NB: This function is only called when pmem is reset; also see firmware upgrade handling below.
@@ -472,16 +523,28 @@ void init() {
     // Firmware upgrade handling - adjust newly defined fields where 0 is an invalid default
     if (fake_brightness_level() == 0) set_fake_brightness_level(BRIGHTNESS_50);
     if (menu_color().v == 0) set_menu_color(Color::grey());
+
+    // The one full check value; persist() follows the changes from here.
+    cached_backup_ram.persist_to(persisted_backup_ram);
+    cache_dirty = true;
 }
 
 void persist() {
-    cached_backup_ram.persist_to(*backup_ram);
+    if (cache_dirty) {
+        cache_dirty = false;
+        cached_backup_ram.persist_changes_to(persisted_backup_ram, *backup_ram);
+    }
+
+    if (settings_file_wait > 0 && --settings_file_wait == 0) {
+        if (cached_backup_ram.pmem_stored_checksum() != settings_file_check)
+            write_settings_file();
+    }
 }
 
 } /* namespace cache */
 
 uint32_t get_data_structure_version() {
-    return data->structure_version;
+    return cdata->structure_version;
 }
 
 uint32_t pmem_data_word(uint32_t index) {
@@ -497,8 +560,9 @@ uint32_t pmem_calculated_checksum(void) {
 }
 
 rf::Frequency target_frequency() {
-    rf::tuning_range.reset_if_outside(data->target_frequency, target_frequency_reset_value);
-    return data->target_frequency;
+    if (!rf::tuning_range.contains_inc(cdata->target_frequency))
+        data->target_frequency = target_frequency_reset_value;
+    return cdata->target_frequency;
 }
 
 void set_target_frequency(const rf::Frequency new_value) {
@@ -506,7 +570,7 @@ void set_target_frequency(const rf::Frequency new_value) {
 }
 
 volume_t headphone_volume() {
-    auto volume = volume_t::centibel(data->headphone_volume_cb);
+    auto volume = volume_t::centibel(cdata->headphone_volume_cb);
     volume = audio::headphone::volume_range().limit(volume);
     return volume;
 }
@@ -517,8 +581,9 @@ void set_headphone_volume(volume_t new_value) {
 }
 
 ppb_t correction_ppb() {
-    ppb_range.reset_if_outside(data->correction_ppb, ppb_reset_value);
-    return data->correction_ppb;
+    if (!ppb_range.contains_inc(cdata->correction_ppb))
+        data->correction_ppb = ppb_reset_value;
+    return cdata->correction_ppb;
 }
 
 void set_correction_ppb(const ppb_t new_value) {
@@ -533,15 +598,16 @@ void set_touch_calibration(const touch::Calibration& new_value) {
 }
 
 const touch::Calibration& touch_calibration() {
-    if (data->touch_calibration_magic != TOUCH_CALIBRATION_MAGIC) {
+    if (cdata->touch_calibration_magic != TOUCH_CALIBRATION_MAGIC) {
         set_touch_calibration(touch::Calibration());
     }
-    return data->touch_calibration;
+    return cdata->touch_calibration;
 }
 
 int32_t tone_mix() {
-    tone_mix_range.reset_if_outside(data->tone_mix, tone_mix_reset_value);
-    return data->tone_mix;
+    if (!tone_mix_range.contains_inc(cdata->tone_mix))
+        data->tone_mix = tone_mix_reset_value;
+    return cdata->tone_mix;
 }
 
 void set_tone_mix(const int32_t new_value) {
@@ -549,8 +615,9 @@ void set_tone_mix(const int32_t new_value) {
 }
 
 int32_t afsk_mark_freq() {
-    afsk_freq_range.reset_if_outside(data->afsk_mark_freq, afsk_mark_reset_value);
-    return data->afsk_mark_freq;
+    if (!afsk_freq_range.contains_inc(cdata->afsk_mark_freq))
+        data->afsk_mark_freq = afsk_mark_reset_value;
+    return cdata->afsk_mark_freq;
 }
 
 void set_afsk_mark(const int32_t new_value) {
@@ -558,8 +625,9 @@ void set_afsk_mark(const int32_t new_value) {
 }
 
 int32_t afsk_space_freq() {
-    afsk_freq_range.reset_if_outside(data->afsk_space_freq, afsk_space_reset_value);
-    return data->afsk_space_freq;
+    if (!afsk_freq_range.contains_inc(cdata->afsk_space_freq))
+        data->afsk_space_freq = afsk_space_reset_value;
+    return cdata->afsk_space_freq;
 }
 
 void set_afsk_space(const int32_t new_value) {
@@ -567,12 +635,13 @@ void set_afsk_space(const int32_t new_value) {
 }
 
 uint32_t get_modem_def_index() {
-    return data->modem_def_index;
+    return cdata->modem_def_index;
 }
 
 int32_t modem_baudrate() {
-    modem_baudrate_range.reset_if_outside(data->modem_baudrate, modem_baudrate_reset_value);
-    return data->modem_baudrate;
+    if (!modem_baudrate_range.contains_inc(cdata->modem_baudrate))
+        data->modem_baudrate = modem_baudrate_reset_value;
+    return cdata->modem_baudrate;
 }
 
 void set_modem_baudrate(const int32_t new_value) {
@@ -580,7 +649,7 @@ void set_modem_baudrate(const int32_t new_value) {
 }
 
 int32_t modem_bw() {
-    return data->modem_bw;
+    return cdata->modem_bw;
 }
 
 /*void set_modem_bw(const int32_t new_value) {
@@ -589,8 +658,9 @@ int32_t modem_bw() {
 */
 
 uint8_t modem_repeat() {
-    modem_repeat_range.reset_if_outside(data->modem_repeat, modem_repeat_reset_value);
-    return data->modem_repeat;
+    if (!modem_repeat_range.contains_inc(cdata->modem_repeat))
+        data->modem_repeat = modem_repeat_reset_value;
+    return cdata->modem_repeat;
 }
 
 void set_modem_repeat(const uint32_t new_value) {
@@ -598,7 +668,7 @@ void set_modem_repeat(const uint32_t new_value) {
 }
 
 serial_format_t serial_format() {
-    return data->serial_format;
+    return cdata->serial_format;
 }
 
 void set_serial_format(const serial_format_t new_value) {
@@ -606,72 +676,72 @@ void set_serial_format(const serial_format_t new_value) {
 }
 
 bool show_gui_return_icon() {  // add return icon in touchscreen menu
-    return data->ui_config.show_gui_return_icon != 0;
+    return cdata->ui_config.show_gui_return_icon != 0;
 }
 
 bool disable_touchscreen() {  // Option to disable touch screen
-    return data->ui_config.disable_touchscreen;
+    return cdata->ui_config.disable_touchscreen;
 }
 
 bool hide_clock() {  // Hide clock from main menu
-    return data->ui_config.hide_clock;
+    return cdata->ui_config.hide_clock;
 }
 
 bool clock_with_date() {  // Show clock with date, if not hidden
-    return data->ui_config.clock_show_date;
+    return cdata->ui_config.clock_show_date;
 }
 
 bool clkout_enabled() {
-    return data->ui_config.clkout_enabled;
+    return cdata->ui_config.clkout_enabled;
 }
 
 bool config_audio_mute() {
-    return data->misc_config.mute_audio;
+    return cdata->misc_config.mute_audio;
 }
 
 bool config_speaker_disable() {
-    return data->misc_config.disable_speaker;
+    return cdata->misc_config.disable_speaker;
 }
 
 bool config_disable_external_tcxo() {
-    return data->misc_config.config_disable_external_tcxo;
+    return cdata->misc_config.config_disable_external_tcxo;
 }
 
 bool config_disable_config_mode() {
-    return data->misc_config.config_disable_config_mode;
+    return cdata->misc_config.config_disable_config_mode;
 }
 
 bool beep_on_packets() {
-    return data->misc_config.beep_on_packets;
+    return cdata->misc_config.beep_on_packets;
 }
 
 bool config_sdcard_high_speed_io() {
-    return data->misc_config.config_sdcard_high_speed_io;
+    return cdata->misc_config.config_sdcard_high_speed_io;
 }
 
 bool stealth_mode() {
-    return data->ui_config.stealth_mode;
+    return cdata->ui_config.stealth_mode;
 }
 
 bool apply_fake_brightness() {
-    return data->ui_config.apply_fake_brightness;
+    return cdata->ui_config.apply_fake_brightness;
 }
 
 bool config_login() {
-    return data->ui_config.config_login;
+    return cdata->ui_config.config_login;
 }
 
 bool config_splash() {
-    return data->ui_config.config_splash;
+    return cdata->ui_config.config_splash;
 }
 
 uint8_t config_cpld() {
-    return data->hardware_config;
+    return cdata->hardware_config;
 }
 
 backlight_config_t config_backlight_timer() {
-    return {static_cast<backlight_timeout_t>(data->ui_config.backlight_timeout),
-            data->ui_config.enable_backlight_timeout == 1};
+    return {static_cast<backlight_timeout_t>(cdata->ui_config.backlight_timeout),
+            cdata->ui_config.enable_backlight_timeout == 1};
 }
 
 void set_gui_return_icon(bool v) {
@@ -679,7 +749,7 @@ void set_gui_return_icon(bool v) {
 }
 
 bool load_app_settings() {
-    return data->ui_config.load_app_settings;
+    return cdata->ui_config.load_app_settings;
 }
 
 void set_load_app_settings(bool v) {
@@ -687,7 +757,7 @@ void set_load_app_settings(bool v) {
 }
 
 bool save_app_settings() {
-    return data->ui_config.save_app_settings;
+    return cdata->ui_config.save_app_settings;
 }
 
 void set_save_app_settings(bool v) {
@@ -769,7 +839,7 @@ void set_apply_fake_brightness(const bool v) {
 }
 
 uint32_t pocsag_last_address() {
-    return data->pocsag_last_address;
+    return cdata->pocsag_last_address;
 }
 
 void set_pocsag_last_address(uint32_t address) {
@@ -777,7 +847,7 @@ void set_pocsag_last_address(uint32_t address) {
 }
 
 uint32_t pocsag_ignore_address() {
-    return data->pocsag_ignore_address;
+    return cdata->pocsag_ignore_address;
 }
 
 void set_pocsag_ignore_address(uint32_t address) {
@@ -785,12 +855,12 @@ void set_pocsag_ignore_address(uint32_t address) {
 }
 
 uint16_t clkout_freq() {
-    auto freq = data->ui_config.clkout_freq;
+    auto freq = cdata->ui_config.clkout_freq;
 
     if (freq < clkout_freq_range.minimum || freq > clkout_freq_range.maximum)
         set_clkout_freq(clkout_freq_reset_value);
 
-    return data->ui_config.clkout_freq;
+    return cdata->ui_config.clkout_freq;
 }
 
 void set_clkout_freq(uint16_t freq) {
@@ -814,17 +884,18 @@ enum recon_config_bits {
     RC_REPEAT_AMP = 20,
     RC_LOAD_REPEATERS = 19,
     RC_REPEAT_FILE_MODE = 18,
+    RC_WIDEBAND_ASSIST = 17,
 };
 
 bool check_recon_config_bit(uint8_t rc_bit) {
-    return ((data->recon_config >> rc_bit) & 1) != 0;
+    return ((cdata->recon_config >> rc_bit) & 1) != 0;
 }
 void set_recon_config_bit(uint8_t rc_bit, bool v) {
     auto bit_mask = 1LL << rc_bit;
     data->recon_config = v ? (data->recon_config | bit_mask) : (data->recon_config & ~bit_mask);
 }
 uint64_t get_recon_config() {
-    return data->recon_config;
+    return cdata->recon_config;
 }
 bool recon_autosave_freqs() {
     return check_recon_config_bit(RC_AUTOSAVE_FREQS);
@@ -860,13 +931,13 @@ bool recon_repeat_recorded() {
     return check_recon_config_bit(RC_REPEAT_RECORDED);
 }
 int8_t recon_repeat_nb() {
-    return data->recon_repeat_nb;
+    return cdata->recon_repeat_nb;
 }
 int8_t recon_repeat_gain() {
-    return data->recon_repeat_gain;
+    return cdata->recon_repeat_gain;
 }
 uint8_t recon_repeat_delay() {
-    return data->recon_repeat_delay;
+    return cdata->recon_repeat_delay;
 }
 bool recon_repeat_amp() {
     return check_recon_config_bit(RC_REPEAT_AMP);
@@ -877,6 +948,9 @@ bool recon_load_repeaters() {
 bool recon_repeat_recorded_file_mode() {
     return check_recon_config_bit(RC_REPEAT_FILE_MODE);
 }
+bool recon_wideband_assist() {
+    return check_recon_config_bit(RC_WIDEBAND_ASSIST);
+}
 void set_recon_autosave_freqs(const bool v) {
     set_recon_config_bit(RC_AUTOSAVE_FREQS, v);
 }
@@ -928,61 +1002,64 @@ void set_recon_load_repeaters(const bool v) {
 void set_recon_repeat_recorded_file_mode(const bool v) {
     set_recon_config_bit(RC_REPEAT_FILE_MODE, v);
 }
+void set_recon_wideband_assist(const bool v) {
+    set_recon_config_bit(RC_WIDEBAND_ASSIST, v);
+}
 
 /* UI Config 2 */
 bool ui_hide_speaker() {
-    return data->ui_config2.hide_speaker;
+    return cdata->ui_config2.hide_speaker;
 }
 bool ui_hide_mute() {
-    return data->ui_config2.hide_mute;
+    return cdata->ui_config2.hide_mute;
 }
 bool ui_hide_converter() {
-    return data->ui_config2.hide_converter;
+    return cdata->ui_config2.hide_converter;
 }
 bool ui_hide_stealth() {
-    return data->ui_config2.hide_stealth;
+    return cdata->ui_config2.hide_stealth;
 }
 bool ui_hide_camera() {
-    return data->ui_config2.hide_camera;
+    return cdata->ui_config2.hide_camera;
 }
 bool ui_hide_sleep() {
-    return data->ui_config2.hide_sleep;
+    return cdata->ui_config2.hide_sleep;
 }
 bool ui_hide_bias_tee() {
-    return data->ui_config2.hide_bias_tee;
+    return cdata->ui_config2.hide_bias_tee;
 }
 bool ui_hide_clock() {
-    return data->ui_config2.hide_clock;
+    return cdata->ui_config2.hide_clock;
 }
 bool ui_hide_sd_card() {
-    return data->ui_config2.hide_sd_card;
+    return cdata->ui_config2.hide_sd_card;
 }
 bool ui_hide_fake_brightness() {
-    return data->ui_config2.hide_fake_brightness;
+    return cdata->ui_config2.hide_fake_brightness;
 }
 bool ui_hide_numeric_battery() {
-    return data->ui_config2.hide_numeric_battery;
+    return cdata->ui_config2.hide_numeric_battery;
 }
 bool ui_hide_battery_icon() {
-    return data->ui_config2.hide_battery_icon;
+    return cdata->ui_config2.hide_battery_icon;
 }
 uint8_t ui_theme_id() {
-    return data->ui_config2.theme_id;
+    return cdata->ui_config2.theme_id;
 }
 bool ui_override_batt_calc() {
-    return data->ui_config2.override_batt_calc;
+    return cdata->ui_config2.override_batt_calc;
 }
 bool ui_button_repeat_delay() {
-    return data->ui_config2.button_repeat_delay;
+    return cdata->ui_config2.button_repeat_delay;
 }
 bool ui_button_repeat_speed() {
-    return data->ui_config2.button_repeat_speed;
+    return cdata->ui_config2.button_repeat_speed;
 }
 bool ui_button_long_press_delay() {
-    return data->ui_config2.button_long_press_delay;
+    return cdata->ui_config2.button_long_press_delay;
 }
 bool ui_battery_charge_hint() {
-    return data->ui_config2.battery_charge_hint;
+    return cdata->ui_config2.battery_charge_hint;
 }
 
 void set_ui_hide_speaker(bool v) {
@@ -1044,13 +1121,13 @@ void set_ui_battery_charge_hint(bool v) {
 
 /* Converter */
 bool config_converter() {
-    return data->converter;
+    return cdata->converter;
 }
 bool config_updown_converter() {
-    return data->updown_converter;
+    return cdata->updown_converter;
 }
 int64_t config_converter_freq() {
-    return data->converter_frequency_offset;
+    return cdata->converter_frequency_offset;
 }
 
 void set_config_converter(bool v) {
@@ -1066,16 +1143,16 @@ void set_config_converter_freq(int64_t v) {
 // Frequency correction settings
 
 bool config_freq_tx_correction_updown() {
-    return data->updown_frequency_tx_correction;
+    return cdata->updown_frequency_tx_correction;
 }
 bool config_freq_rx_correction_updown() {
-    return data->updown_frequency_rx_correction;
+    return cdata->updown_frequency_rx_correction;
 }
 uint32_t config_freq_tx_correction() {
-    return data->frequency_tx_correction;
+    return cdata->frequency_tx_correction;
 }
 uint32_t config_freq_rx_correction() {
-    return data->frequency_rx_correction;
+    return cdata->frequency_rx_correction;
 }
 void set_freq_tx_correction_updown(bool v) {
     data->updown_frequency_tx_correction = v;
@@ -1092,7 +1169,7 @@ void set_config_freq_rx_correction(uint32_t v) {
 
 // IPS vs TFT
 bool config_lcd_normally_black() {
-    return data->lcd_normally_black;
+    return cdata->lcd_normally_black;
 }
 void set_lcd_normally_black(bool v) {
     data->lcd_normally_black = v;
@@ -1100,13 +1177,13 @@ void set_lcd_normally_black(bool v) {
 
 // Rotary encoder dial settings
 uint8_t encoder_dial_sensitivity() {
-    return data->encoder_dial_sensitivity;
+    return cdata->encoder_dial_sensitivity;
 }
 void set_encoder_dial_sensitivity(uint8_t v) {
     data->encoder_dial_sensitivity = v;
 }
 uint8_t encoder_rate_multiplier() {
-    uint8_t v = data->encoder_rate_multiplier;
+    uint8_t v = cdata->encoder_rate_multiplier;
     if (v == 0) v = 1;  // minimum value is 1; treat 0 the same as 1
     return v;
 }
@@ -1115,7 +1192,7 @@ void set_encoder_rate_multiplier(uint8_t v) {
 }
 
 bool encoder_dial_direction() {
-    return data->encoder_dial_direction;
+    return cdata->encoder_dial_direction;
 }
 void set_encoder_dial_direction(bool v) {
     data->encoder_dial_direction = v;
@@ -1139,14 +1216,14 @@ bool config_disable_config_mode_direct() {
 
 // Daylight savings time
 bool dst_enabled() {
-    return data->dst_config.b.dst_enabled;
+    return cdata->dst_config.b.dst_enabled;
 }
 void set_dst_enabled(bool v) {
     data->dst_config.b.dst_enabled = v;
     rtc_time::dst_init();
 }
 dst_config_t config_dst() {
-    return data->dst_config;
+    return cdata->dst_config;
 }
 void set_config_dst(dst_config_t v) {
     data->dst_config = v;
@@ -1155,7 +1232,7 @@ void set_config_dst(dst_config_t v) {
 
 // Fake brightness level (switch is in another place)
 uint8_t fake_brightness_level() {
-    return data->fake_brightness_level;
+    return cdata->fake_brightness_level;
 }
 void set_fake_brightness_level(uint8_t v) {
     data->fake_brightness_level = v;
@@ -1164,7 +1241,7 @@ void set_fake_brightness_level(uint8_t v) {
 // Cycle through 4 brightness options: disabled -> enabled/50% -> enabled/25% -> enabled/12.5% -> disabled
 void toggle_fake_brightness_level() {
     bool fbe = apply_fake_brightness();
-    if ((!fbe) || (data->fake_brightness_level >= BRIGHTNESS_12p5)) {
+    if ((!fbe) || (cdata->fake_brightness_level >= BRIGHTNESS_12p5)) {
         set_apply_fake_brightness(!fbe);
         data->fake_brightness_level = BRIGHTNESS_50;
     } else {
@@ -1174,14 +1251,14 @@ void toggle_fake_brightness_level() {
 
 // Menu Color Scheme
 Color menu_color() {
-    return data->menu_color;
+    return cdata->menu_color;
 }
 void set_menu_color(Color v) {
     data->menu_color = v;
 }
 
 uint16_t touchscreen_threshold() {
-    return data->touchscreen_threshold;
+    return cdata->touchscreen_threshold;
 }
 void set_touchscreen_threshold(uint16_t v) {
     data->touchscreen_threshold = v;
@@ -1193,18 +1270,35 @@ bool should_use_sdcard_for_pmem() {
     return std::filesystem::file_exists(settings_dir / PMEM_FILEFLAG);
 }
 
-int save_persistent_settings_to_file() {
+/* Expects the check value of the cache to be up to date. */
+static bool write_settings_file() {
     File outfile;
 
+    settings_file_wait = 0;
     ensure_directory(settings_dir);
     auto error = outfile.create(settings_dir / PMEM_SETTING_FILE);
     if (error)
         return false;
 
     outfile.write(reinterpret_cast<char*>(&cached_backup_ram), sizeof(backup_ram_t));
+    settings_file_check = cached_backup_ram.pmem_stored_checksum();
     return true;
 }
 
+int save_persistent_settings_to_file() {
+    cache::persist();
+    return write_settings_file();
+}
+
+void save_persistent_settings_to_file_later() {
+    settings_file_wait = settings_file_delay;
+}
+
+void flush_persistent_settings_file() {
+    if (settings_file_wait > 0)
+        save_persistent_settings_to_file();
+}
+
 int load_persistent_settings_from_file() {
     File infile;
     auto error = infile.open(settings_dir / PMEM_SETTING_FILE);
@@ -1212,6 +1306,9 @@ int load_persistent_settings_from_file() {
         return false;
 
     infile.read(reinterpret_cast<char*>(&cached_backup_ram), sizeof(backup_ram_t));
+    cache_dirty = true;
+    cache::persist();
+    settings_file_check = cached_backup_ram.pmem_stored_checksum();
     return true;
 }
 
@@ -150,9 +150,11 @@ void defaults();
  * if persistent RAM contents appear to be invalid. */
 void init();
 
-/* Calculate a check value for cached settings, and copy the check value and
- * settings into persistent RAM. Intended to be called periodically to update
- * persistent settings with current settings. */
+/* Copy the settings changed since the last call into persistent RAM, along
+ * with an updated check value; nothing to do if none changed. Intended to be
+ * called periodically to update persistent settings with current settings.
+ * Also writes the settings file once save_persistent_settings_to_file_later()
+ * has waited long enough. */
 void persist();
 
 } /* namespace cache */
@@ -314,6 +316,7 @@ bool recon_repeat_amp();
 bool recon_load_hamradios();
 bool recon_match_mode();
 uint8_t recon_repeat_delay();
+bool recon_wideband_assist();
 void set_recon_autosave_freqs(const bool v);
 void set_recon_autostart_recon(const bool v);
 void set_recon_continuous(const bool v);
@@ -331,6 +334,7 @@ void set_recon_load_hamradios(const bool v);
 void set_recon_load_repeaters(const bool v);
 void set_recon_match_mode(const bool v);
 void set_recon_repeat_delay(const uint8_t v);
+void set_recon_wideband_assist(const bool v);
 
 /* UI Config 2 */
 bool ui_hide_speaker();
@@ -374,6 +378,12 @@ void set_ui_battery_charge_hint(bool v);
 // sd persisting settings
 bool should_use_sdcard_for_pmem();
 int save_persistent_settings_to_file();
+/* Saves the settings to the SD card a couple of persist() calls from now,
+ * once for any number of calls in between, and only if they changed since
+ * the file was last written or read. */
+void save_persistent_settings_to_file_later();
+/* Writes a pending save now, e.g. before the SD card goes away. */
+void flush_persistent_settings_file();
 int load_persistent_settings_from_file();
 
 uint32_t get_data_structure_version();
@@ -121,15 +121,16 @@ constexpr image_tag_t image_tag_subghzd{'P', 'S', 'G', 'D'};
 constexpr image_tag_t image_tag_protoview{'P', 'P', 'V', 'W'};
 constexpr image_tag_t image_tag_wefaxrx{'P', 'W', 'F', 'X'};
 constexpr image_tag_t image_tag_noaaapt_rx{'P', 'N', 'O', 'A'};
+constexpr image_tag_t image_tag_channelizer{'P', 'C', 'H', 'Z'};
 
 constexpr image_tag_t image_tag_noop{'P', 'N', 'O', 'P'};
 
 constexpr image_tag_t image_tag_hackrf{'H', 'R', 'F', '1'};
 
+/* 'data' is an image_blocks stream, see application/image_blocks.hpp. */
 struct chunk_t {
     const image_tag_t tag;
     const uint32_t length;
-    const uint32_t compressed_data_size;
     const uint8_t data[];
 
     const chunk_t* next() const {
@@ -147,13 +148,13 @@ struct region_t {
 };
 
 const region_t images{
-    .offset = reinterpret_cast<uint32_t>(&_textend),
-    .size = portapack::memory::map::spifi_cached.size() - reinterpret_cast<uint32_t>(&_textend),
+    .offset = reinterpret_cast<uintptr_t>(&_textend),
+    .size = portapack::memory::map::spifi_cached.size() - reinterpret_cast<uintptr_t>(&_textend),
 };
 
 const region_t application{
     .offset = 0x00000,
-    .size = reinterpret_cast<uint32_t>(&_textend),
+    .size = reinterpret_cast<uintptr_t>(&_textend),
 };
 
 } /* namespace spi_flash */
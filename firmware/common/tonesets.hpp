@@ -114,6 +114,14 @@ const std::array<uint32_t, 16> zvei_deltas = {
     TONES_F2D(2600, TONES_SAMPLERATE),
     TONES_F2D(680, TONES_SAMPLERATE)};
 
+// CTCSS tones in 0.01Hz, ascending. Same as tonekey::tone_keys 1 to 50.
+const std::array<uint16_t, 50> ctcss_tones = {
+    6700, 6930, 7190, 7440, 7700, 7970, 8250, 8540, 8850, 9150,
+    9480, 9740, 10000, 10350, 10720, 11090, 11480, 11880, 12300, 12730,
+    13180, 13650, 14130, 14620, 15140, 15670, 15980, 16220, 16550, 16790,
+    17130, 17380, 17730, 17990, 18350, 18620, 18990, 19280, 19660, 19950,
+    20350, 20650, 21070, 21810, 22570, 22910, 23360, 24180, 25030, 25410};
+
 const uint32_t beep_deltas[BEEP_TONES_NB] = {
     TONES_F2D(1475, TONES_SAMPLERATE),
     TONES_F2D(740, TONES_SAMPLERATE),
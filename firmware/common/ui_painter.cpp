@@ -105,7 +105,16 @@ void Painter::draw_rectangle(Rect r, Color c) {
 }
 
 void Painter::fill_rectangle(Rect r, Color c) {
-    display.fill_rectangle(r, c);
+    if (!compositing_) {
+        display.fill_rectangle(r, c);
+        return;
+    }
+
+    r = r.intersect(display.screen_rect());
+    const auto filled_before = stats_.filled_area;
+    for (const auto& d : damage_)
+        fill_unoccluded(r.intersect(d), c);
+    stats_.clipped_area += r.width() * r.height() - (stats_.filled_area - filled_before);
 }
 
 void Painter::fill_rectangle_unrolled8(Rect r, Color c) {
@@ -114,34 +123,198 @@ void Painter::fill_rectangle_unrolled8(Rect r, Color c) {
 
 void Painter::paint_widget_tree(Widget* w) {
     if (ui::is_dirty()) {
+        damage_.clear();
+        collect_damage(w, false, {});
+        stats_ = {};
+        stats_.damaged_area = damage_.area();
+
+        compositing_ = true;
         paint_widget(w);
+        compositing_ = false;
+        occluder_count_ = 0;
+
         ui::dirty_clear();
     }
 }
 
+static bool contains(const Rect& outer, const Rect& inner) {
+    return inner.left() >= outer.left() && inner.right() <= outer.right() &&
+           inner.top() >= outer.top() && inner.bottom() <= outer.bottom();
+}
+
+/* Adds the rectangles of the dirty widgets, and of children of dirty
+ * widgets reaching outside of them. */
+void Painter::collect_damage(Widget* w, bool forced, Rect repainted) {
+    if (w->hidden())
+        return;
+
+    if (forced || w->dirty()) {
+        const auto r = w->screen_rect();
+        if (!contains(repainted, r)) {
+            damage_.add(r);
+            repainted = r;
+        }
+        forced = true;
+    }
+
+    for (const auto child : w->children())
+        collect_damage(child, forced, repainted);
+}
+
 void Painter::paint_widget(Widget* w) {
     if (w->hidden()) {
         // Mark widget (and all children) as invisible.
         w->visible(false);
-    } else {
-        // Mark this widget as visible and recurse.
-        w->visible(true);
+        return;
+    }
 
-        if (w->dirty()) {
-            w->paint(*this);
-            // Force-paint all children.
-            for (const auto child : w->children()) {
-                child->set_dirty();
-                paint_widget(child);
+    // Mark this widget as visible and recurse.
+    w->visible(true);
+
+    const auto& children = w->children();
+    const bool repaint = w->dirty();
+    const auto occluders_before = occluder_count_;
+
+    if (repaint) {
+        const auto r = w->screen_rect();
+        if (damage_.intersects(r) && !occluded(r)) {
+            // Children paint over the fills of their parent.
+            for (const auto child : children) {
+                if (!child->hidden() && child->opaque())
+                    push_occluder(child->screen_rect());
             }
-            w->set_clean();
+            w->paint(*this);
+            occluder_count_ = occluders_before;
+            stats_.painted++;
         } else {
-            // Selectively paint all children.
-            for (const auto child : w->children()) {
-                paint_widget(child);
-            }
+            stats_.occluded++;
+        }
+    }
+
+    for (size_t i = 0; i < children.size(); i++) {
+        // Siblings painted later cover this child. When not repainting
+        // everything (all children forced), only the dirty ones are.
+        occluder_count_ = occluders_before;
+        for (size_t j = i + 1; j < children.size(); j++) {
+            const auto sibling = children[j];
+            if (!sibling->hidden() && sibling->opaque() && (repaint || sibling->dirty()))
+                push_occluder(sibling->screen_rect());
         }
+
+        // Force-paint all children of a repainted widget.
+        if (repaint)
+            children[i]->set_dirty();
+        paint_widget(children[i]);
     }
+    occluder_count_ = occluders_before;
+
+    if (repaint)
+        w->set_clean();
+}
+
+/* Occluders past the capacity are dropped, which only costs painting. */
+void Painter::push_occluder(const Rect& r) {
+    if (occluder_count_ < occluders_.size() && !r.is_empty())
+        occluders_[occluder_count_++] = r;
+}
+
+/* The parts of 'r' around 'o' (inside 'r'): above, below, left and right. */
+static std::array<Rect, 4> parts_around(const Rect& r, const Rect& o) {
+    return {{
+        {r.left(), r.top(), r.width(), o.top() - r.top()},
+        {r.left(), o.bottom(), r.width(), r.bottom() - o.bottom()},
+        {r.left(), o.top(), o.left() - r.left(), o.height()},
+        {o.right(), o.top(), r.right() - o.right(), o.height()},
+    }};
+}
+
+bool Painter::occluded(const Rect& r, size_t first_occluder) const {
+    if (r.is_empty())
+        return true;
+
+    for (size_t i = first_occluder; i < occluder_count_; i++) {
+        const auto o = r.intersect(occluders_[i]);
+        if (o.is_empty())
+            continue;
+
+        for (const auto& part : parts_around(r, o)) {
+            if (!occluded(part, i + 1))
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+void Painter::fill_unoccluded(const Rect& r, Color c, size_t first_occluder) {
+    if (r.is_empty())
+        return;
+
+    for (size_t i = first_occluder; i < occluder_count_; i++) {
+        const auto o = r.intersect(occluders_[i]);
+        if (o.is_empty())
+            continue;
+
+        for (const auto& part : parts_around(r, o))
+            fill_unoccluded(part, c, i + 1);
+        return;
+    }
+
+    display.fill_rectangle(r, c);
+    stats_.filled_area += r.width() * r.height();
+}
+
+/* DamageRegion **********************************************************/
+
+void DamageRegion::add(Rect r) {
+    if (r.is_empty())
+        return;
+
+    // Swallow everything the new rectangle overlaps, until it overlaps nothing.
+    for (size_t i = 0; i < count_;) {
+        if (r.intersect(rects_[i]).is_empty()) {
+            i++;
+            continue;
+        }
+        r += rects_[i];
+        rects_[i] = rects_[--count_];
+        i = 0;
+    }
+
+    if (count_ < capacity) {
+        rects_[count_++] = r;
+        return;
+    }
+
+    size_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (size_t i = 0; i < count_; i++) {
+        auto merged = rects_[i];
+        merged += r;
+        const uint32_t growth = merged.width() * merged.height() - rects_[i].width() * rects_[i].height();
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    r += rects_[best];
+    rects_[best] = rects_[--count_];
+    add(r);
+}
+
+bool DamageRegion::intersects(const Rect& r) const {
+    for (const auto& d : *this) {
+        if (!r.intersect(d).is_empty())
+            return true;
+    }
+    return false;
+}
+
+uint32_t DamageRegion::area() const {
+    uint32_t total = 0;
+    for (const auto& d : *this)
+        total += d.width() * d.height();
+    return total;
 }
 
 } /* namespace ui */
@@ -26,6 +26,8 @@
 #include "ui.hpp"
 #include "ui_text.hpp"
 
+#include <array>
+#include <cstddef>
 #include <string_view>
 
 namespace ui {
@@ -63,6 +65,28 @@ struct MutableStyle {
 
 class Widget;
 
+/* Screen area to repaint in a frame, as up to 'capacity' disjoint
+ * rectangles. Overlapping rectangles are merged into their bounding box;
+ * once full, a new rectangle is merged into the one it grows the least. */
+class DamageRegion {
+   public:
+    static constexpr size_t capacity = 8;
+
+    void clear() { count_ = 0; }
+    void add(Rect r);
+
+    bool intersects(const Rect& r) const;
+    uint32_t area() const;
+
+    size_t size() const { return count_; }
+    const Rect* begin() const { return rects_.data(); }
+    const Rect* end() const { return rects_.data() + count_; }
+
+   private:
+    std::array<Rect, capacity> rects_{};
+    size_t count_{0};
+};
+
 class Painter {
    public:
     Painter(){};
@@ -81,13 +105,40 @@ class Painter {
     void fill_rectangle(Rect r, Color c);
     void fill_rectangle_unrolled8(Rect r, Color c);
 
+    /* Repaints the dirty widgets under 'w'. Fills are clipped to the
+     * damaged area and left out under opaque widgets painted after them;
+     * widgets entirely under opaque widgets are not painted at all. */
     void paint_widget_tree(Widget* w);
 
     void draw_hline(Point p, int width, Color c);
     void draw_vline(Point p, int height, Color c);
 
+    struct FrameStats {
+        uint32_t damaged_area;  // Pixels.
+        uint32_t filled_area;   // Pixels filled on the display.
+        uint32_t clipped_area;  // Pixels of fills left out.
+        uint16_t painted;       // Widgets.
+        uint16_t occluded;      // Widgets not painted.
+    };
+
+    /* Of the last paint_widget_tree() that painted something. */
+    const FrameStats& frame_stats() const { return stats_; }
+
    private:
+    static constexpr size_t max_occluders = 32;
+
+    bool compositing_{false};
+    DamageRegion damage_{};
+    std::array<Rect, max_occluders> occluders_{};
+    size_t occluder_count_{0};
+    FrameStats stats_{};
+
+    void collect_damage(Widget* w, bool forced, Rect repainted);
     void paint_widget(Widget* w);
+
+    void push_occluder(const Rect& r);
+    bool occluded(const Rect& r, size_t first_occluder = 0) const;
+    void fill_unoccluded(const Rect& r, Color c, size_t first_occluder = 0);
 };
 
 } /* namespace ui */
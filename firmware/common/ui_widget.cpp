@@ -257,6 +257,7 @@ void Widget::getWidgetName(std::string& result) {
 /* View ******************************************************************/
 
 void View::paint(Painter& painter) {
+    paints_background_ = true;
     painter.fill_rectangle(
         screen_rect(),
         style().background);
@@ -3072,7 +3073,7 @@ VuMeter::VuMeter(
       LEDs_{LEDs},
       show_max_{show_max} {
     // set_focusable(false);
-    LED_height = std::max(1UL, parent_rect.size().height() / LEDs);
+    LED_height = std::max<uint32_t>(1, parent_rect.size().height() / LEDs);
     split = 256 / LEDs;
 }
 
@@ -102,6 +102,10 @@ class Widget {
 
     virtual void paint(Painter& painter) = 0;
 
+    /* True when paint() covers every pixel of screen_rect(), so the
+     * Painter can leave out what it would paint underneath. */
+    virtual bool opaque() const { return false; }
+
     virtual void on_show() { return; };
     virtual void on_hide() { return; };
 
@@ -174,6 +178,7 @@ class View : public Widget {
     // TODO: ~View() should on_hide() all children?
 
     void paint(Painter& painter) override;
+    bool opaque() const override { return paints_background_; }
 
     void add_child(Widget* const widget);
     void add_children(const std::initializer_list<Widget*> children);
@@ -187,6 +192,10 @@ class View : public Widget {
     std::vector<Widget*> children_{};
 
     void invalidate_child(Widget* const widget);
+
+   private:
+    // Set by View::paint(), which subclasses may not call.
+    bool paints_background_{false};
 };
 
 class Rectangle : public Widget {
@@ -219,6 +228,7 @@ class Text : public Widget {
     void set(std::string_view value);
 
     void paint(Painter& painter) override;
+    bool opaque() const override { return true; }
     void getAccessibilityText(std::string& result) override;
     void getWidgetName(std::string& result) override;
 
@@ -439,6 +449,7 @@ class Button : public Widget {
     std::string text() const;
 
     void paint(Painter& painter) override;
+    bool opaque() const override { return true; }
 
     void on_focus() override;
     bool on_key(const KeyEvent key) override;
@@ -529,6 +540,7 @@ class NewButton : public Widget {
     void getWidgetName(std::string& result) override;
 
     void paint(Painter& painter) override;
+    bool opaque() const override { return bitmap_ || !text_.empty(); }
 
    protected:
     virtual Style paint_style();
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __WORD_CRC_H__
+#define __WORD_CRC_H__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/* The CRC-32 that CRC<32>{0x04c11db7, 0xffffffff, 0xffffffff} gives over
+ * the bytes of N little endian words, kept up to date one changed word at
+ * a time.
+ *
+ * A CRC is linear: the checksums of two images that differ in word i
+ * differ by the CRC register of the difference alone, shifted through
+ * the N - 1 - i words that follow it. Shifting through 32 zero bits
+ * multiplies the register by x^32 mod P, so a table of x^(32 * k) mod P
+ * turns an update into two 32 step loops, wherever the word is. */
+template <size_t N>
+class WordCRC32 {
+   public:
+    static constexpr uint32_t polynomial = 0x04c11db7;
+
+    constexpr WordCRC32()
+        : shift{} {
+        shift[N - 1] = 1;  // x^0
+        const uint32_t x32 = register_of(1U << 24);
+        for (size_t i = N - 1; i > 0; i--)
+            shift[i - 1] = multiply(shift[i], x32);
+    }
+
+    /* Checksum of the image once word 'index' goes from 'old_word' to
+     * 'new_word', given its checksum before. */
+    constexpr uint32_t update(const uint32_t checksum, const size_t index, const uint32_t old_word, const uint32_t new_word) const {
+        const uint32_t difference = old_word ^ new_word;
+        if (difference == 0)
+            return checksum;
+        return checksum ^ multiply(register_of(difference), shift[index]);
+    }
+
+   private:
+    /* shift[i]: x^(32 * (N - 1 - i)) mod P. */
+    std::array<uint32_t, N> shift;
+
+    /* Register after the 4 bytes of 'word', low byte first, from 0. */
+    static constexpr uint32_t register_of(const uint32_t word) {
+        uint32_t r = 0;
+        for (size_t byte = 0; byte < 4; byte++) {
+            r ^= ((word >> (byte * 8)) & 0xff) << 24;
+            for (size_t bit = 0; bit < 8; bit++)
+                r = (r << 1) ^ ((r & 0x80000000) ? polynomial : 0);
+        }
+        return r;
+    }
+
+    /* a * b mod P. */
+    static constexpr uint32_t multiply(const uint32_t a, const uint32_t b) {
+        uint32_t r = 0;
+        for (size_t bit = 32; bit > 0; bit--) {
+            r = (r << 1) ^ ((r & 0x80000000) ? polynomial : 0);
+            if (b & (1U << (bit - 1)))
+                r ^= a;
+        }
+        return r;
+    }
+};
+
+#endif /*__WORD_CRC_H__*/
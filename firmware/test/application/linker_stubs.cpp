@@ -72,9 +72,21 @@ FRESULT f_truncate(FIL*) {
 FRESULT f_unlink(const TCHAR*) {
     return FR_OK;
 }
+FRESULT f_utime(const TCHAR*, const FILINFO*) {
+    return FR_OK;
+}
 FRESULT f_write(FIL*, const void*, UINT, UINT*) {
     return FR_OK;
 }
 
+/* ChibiOS stubs */
+#include "ch.h"
+#include "hal.h"
+void chThdSleep(systime_t) {}
+void halPolledDelay(halrtcnt_t) {}
+#if HAL_USE_PAL
+extern "C" void _pal_lld_setgroupmode(ioportid_t, ioportmask_t, iomode_t) {}
+#endif
+
 /* Debug */
 void __debug_log(const std::string&) {}
@@ -133,12 +133,12 @@ TEST_CASE("It can parse frequency step") {
     REQUIRE(
         parse_freqman_entry(
             "f=123000000,d=This is the description.,s=0.1kHz", e));
-    CHECK_EQ(e.step, 0);
+    CHECK_EQ(e.step, 2);
 
     REQUIRE(
         parse_freqman_entry(
             "f=123000000,d=This is the description.,s=50kHz", e));
-    CHECK_EQ(e.step, 11);
+    CHECK_EQ(e.step, 13);
 
     REQUIRE(
         parse_freqman_entry(
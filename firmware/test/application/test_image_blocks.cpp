@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "image_blocks.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+/* tools/image_blocks.py's pack() of image() with 256 byte blocks: a
+ * compressed block, a stored one and a short compressed one. */
+const std::vector<uint8_t> packed{
+    0x64, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7d, 0x15, 0x0f, 0xd2, 0x1c, 0x00, 0x00, 0x00,
+    0xff, 0x02, 0x50, 0x6f, 0x72, 0x74, 0x61, 0x50, 0x61, 0x63, 0x6b, 0x20, 0x4d, 0x61, 0x79, 0x68,
+    0x65, 0x6d, 0x20, 0x11, 0x00, 0xd7, 0x50, 0x68, 0x65, 0x6d, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0xc6, 0x7e, 0x81, 0x6b, 0x4b, 0xfb, 0xe2, 0xfb, 0x54, 0xf6, 0xbd, 0xdf,
+    0x7c, 0x1c, 0xe1, 0x87, 0x01, 0xbf, 0x31, 0xde, 0x56, 0x72, 0x0f, 0x47, 0x67, 0x66, 0x87, 0x59,
+    0xaa, 0x88, 0x3c, 0x59, 0xea, 0x56, 0x13, 0x7b, 0xd2, 0x85, 0xa1, 0xd8, 0x3c, 0x54, 0x55, 0x2f,
+    0x37, 0xae, 0x65, 0x5b, 0xda, 0x02, 0x79, 0x98, 0xcc, 0xe3, 0x1a, 0x76, 0x8e, 0x5f, 0xd9, 0x99,
+    0x8f, 0x1f, 0x3f, 0x36, 0xee, 0x43, 0x78, 0x4d, 0x0d, 0xfa, 0xbe, 0xa6, 0xda, 0xe4, 0x86, 0x8e,
+    0xdc, 0x29, 0x6d, 0x4e, 0xff, 0x56, 0xe1, 0x70, 0x20, 0xfb, 0x8f, 0xb1, 0x58, 0x05, 0x90, 0xc5,
+    0x09, 0xdc, 0x53, 0xcd, 0xaa, 0x3b, 0x48, 0x99, 0x52, 0xd3, 0x52, 0x9d, 0x06, 0x9f, 0xea, 0xb5,
+    0xc2, 0x06, 0x13, 0x98, 0x49, 0xb2, 0x01, 0x1e, 0xac, 0x32, 0x88, 0x31, 0x9c, 0x52, 0x46, 0x95,
+    0x71, 0x36, 0x8f, 0x57, 0xf6, 0x39, 0x1d, 0x16, 0xfa, 0x88, 0x74, 0xf5, 0x98, 0x7c, 0x17, 0x5c,
+    0x41, 0xbb, 0x6d, 0x71, 0x8e, 0x0f, 0x70, 0x59, 0xc7, 0x01, 0x1b, 0x2f, 0x33, 0x3d, 0x91, 0xc0,
+    0x1d, 0xa5, 0x0d, 0x0d, 0xab, 0x33, 0x8d, 0x7e, 0x5e, 0x8f, 0x3e, 0xe6, 0x68, 0x74, 0xa6, 0x3a,
+    0xb1, 0xc3, 0x93, 0x11, 0xa8, 0x64, 0xc7, 0xdb, 0xca, 0xe0, 0x60, 0xe1, 0xf3, 0xbf, 0x09, 0x00,
+    0x67, 0xa2, 0xe3, 0x25, 0xa0, 0x21, 0x31, 0x87, 0xd5, 0x62, 0xc5, 0xa8, 0x4f, 0x7e, 0x2e, 0x09,
+    0x6b, 0x94, 0x9f, 0xb0, 0x6d, 0xa9, 0x9e, 0x5a, 0x0b, 0x46, 0x70, 0x80, 0xb6, 0xcf, 0x47, 0x0c,
+    0xa6, 0xa5, 0x2a, 0xd8, 0xac, 0xfb, 0xa0, 0xeb, 0xb7, 0x79, 0x24, 0x72, 0x23, 0x92, 0x48, 0x80,
+    0xc5, 0xa6, 0xa7, 0x85, 0xb7, 0xd7, 0x8c, 0x90, 0xe4, 0xab, 0x63, 0x44, 0x52, 0x66, 0xe3, 0x9c,
+    0x33, 0x25, 0xf9, 0x5e, 0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x4b, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+std::vector<uint8_t> image() {
+    std::vector<uint8_t> data{};
+    const char text[] = "PortaPack Mayhem ";
+    for (size_t i = 0; i < 256; i++)
+        data.push_back(text[i % (sizeof(text) - 1)]);
+    uint32_t x = 1;
+    for (size_t i = 0; i < 256; i++) {
+        x = x * 1103515245 + 12345;
+        data.push_back((x >> 16) & 0xff);
+    }
+    data.resize(data.size() + 100, 0);
+    return data;
+}
+
+size_t extend(size_t length, const uint8_t*& p) {
+    if (length == 15) {
+        uint8_t more;
+        do {
+            more = *p++;
+            length += more;
+        } while (more == 255);
+    }
+    return length;
+}
+
+/* Does what lz4.S's unlz4_len() does, down to the match it makes out of
+ * the 2 bytes past the end of the block. */
+void unlz4_len_like(const void* src, void* dst, uint32_t length) {
+    auto* s = static_cast<const uint8_t*>(src);
+    const auto* const end = s + length;
+    auto* d = static_cast<uint8_t*>(dst);
+    do {
+        const uint8_t token = *s++;
+        const size_t literals = extend(token >> 4, s);
+        memcpy(d, s, literals);
+        d += literals;
+        s += literals;
+
+        const size_t offset = s[0] | (s[1] << 8);
+        s += 2;
+        const size_t match = extend(token & 15, s) + 4;
+        for (size_t i = 0; i < match; i++, d++)
+            *d = *(d - offset);
+    } while (s < end);
+}
+
+constexpr size_t slack = 4;
+constexpr uint8_t untouched = 0xa5;
+
+struct Target {
+    std::vector<uint8_t> memory;
+    image_blocks::Unpacker unpacker;
+
+    Target(size_t capacity)
+        : memory(capacity + slack, untouched),
+          unpacker{memory.data(), capacity, unlz4_len_like} {
+    }
+
+    std::vector<uint8_t> unpacked() const {
+        return {memory.begin(), memory.begin() + unpacker.unpacked_size()};
+    }
+};
+
+uint32_t word_at(const std::vector<uint8_t>& data, size_t offset) {
+    uint32_t word;
+    memcpy(&word, &data[offset], sizeof(word));
+    return word;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Image blocks");
+
+TEST_CASE("crc32() is zlib's.") {
+    CHECK(image_blocks::crc32(0, "123456789", 9) == 0xcbf43926);
+    CHECK(image_blocks::crc32(image_blocks::crc32(0, "1234", 4), "56789", 5) == 0xcbf43926);
+}
+
+TEST_CASE("A packed image unpacks and verifies.") {
+    const auto expected = image();
+    Target target{expected.size()};
+    REQUIRE(target.unpacker.unpack(packed.data(), packed.size()));
+    CHECK(target.unpacker.verified());
+    CHECK(target.unpacker.block_count() == 3);
+    CHECK(target.unpacked() == expected);
+}
+
+TEST_CASE("Unpacking writes nothing past the image.") {
+    const auto expected = image();
+    Target target{expected.size()};
+    REQUIRE(target.unpacker.unpack(packed.data(), packed.size()));
+    for (size_t i = expected.size(); i < target.memory.size(); i++)
+        CHECK(target.memory[i] == untouched);
+}
+
+TEST_CASE("Blocks unpack one at a time, sized ahead.") {
+    const auto expected = image();
+    Target target{expected.size()};
+    image_blocks::Header header;
+    memcpy(&header, packed.data(), sizeof(header));
+    REQUIRE(target.unpacker.begin(header));
+
+    // Like the SD card reader: each read takes a block's data and the
+    // header of the next one, sized before the current block unpacks.
+    size_t offset = sizeof(header);
+    uint32_t block_header = word_at(packed, offset);
+    offset += 4;
+    for (size_t index = 0; index < target.unpacker.block_count(); index++) {
+        const size_t size = target.unpacker.data_size(block_header, index);
+        REQUIRE(size > 0);
+        const std::vector<uint8_t> data(packed.begin() + offset, packed.begin() + offset + size);
+        offset += size;
+
+        uint32_t next_header = 0;
+        if (index + 1 < target.unpacker.block_count()) {
+            next_header = word_at(packed, offset);
+            offset += 4;
+            CHECK(target.unpacker.data_size(next_header, index + 1) > 0);
+        }
+
+        CHECK(target.unpacker.next_block() == index);
+        REQUIRE(target.unpacker.block(block_header, data.data()));
+        block_header = next_header;
+    }
+    CHECK(offset == packed.size());
+    CHECK(target.unpacker.verified());
+    CHECK(target.unpacked() == expected);
+}
+
+TEST_CASE("A corrupt image fails its CRC.") {
+    auto corrupt = packed;
+    corrupt[100] ^= 0x10;  // In the stored block.
+    Target target{image().size()};
+    CHECK_FALSE(target.unpacker.unpack(corrupt.data(), corrupt.size()));
+    CHECK(target.unpacker.done());
+    CHECK_FALSE(target.unpacker.verified());
+}
+
+TEST_CASE("Malformed streams are refused.") {
+    const size_t capacity = image().size();
+
+    SUBCASE("Too big for the destination") {
+        Target target{capacity - 1};
+        CHECK_FALSE(target.unpacker.unpack(packed.data(), packed.size()));
+        CHECK_FALSE(target.unpacker.verified());
+    }
+
+    SUBCASE("Truncated") {
+        Target target{capacity};
+        CHECK_FALSE(target.unpacker.unpack(packed.data(), packed.size() - 4));
+        CHECK_FALSE(target.unpacker.unpack(packed.data(), 10));
+    }
+
+    SUBCASE("Stored block of the wrong size") {
+        auto bad = packed;
+        bad[48] = 0xff;  // Second block header: 0x800000ff.
+        bad[49] = 0x00;
+        Target target{capacity};
+        CHECK_FALSE(target.unpacker.unpack(bad.data(), bad.size()));
+    }
+
+    SUBCASE("Compressed block no smaller than the image block") {
+        Target target{capacity};
+        image_blocks::Header header;
+        memcpy(&header, packed.data(), sizeof(header));
+        REQUIRE(target.unpacker.begin(header));
+        CHECK(target.unpacker.data_size(256, 0) == 0);
+        CHECK(target.unpacker.data_size(255, 0) == 260);
+        CHECK(target.unpacker.data_size(100, 2) == 0);
+        CHECK(target.unpacker.data_size(99, 2) == 104);
+        CHECK(target.unpacker.data_size(10, 3) == 0);
+    }
+
+    SUBCASE("Compressed block not followed by zeros") {
+        auto bad = packed;
+        bad[16 + 28] = 1;  // Right past the first block's 28 bytes.
+        Target target{capacity};
+        CHECK_FALSE(target.unpacker.unpack(bad.data(), bad.size()));
+    }
+}
+
+TEST_SUITE_END();
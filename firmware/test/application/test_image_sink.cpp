@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "image_sink.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using image::Format;
+using image::RowEncoder;
+
+ui::Color test_pixel(uint32_t x, uint32_t y) {
+    return {uint8_t(x * 7 + y), uint8_t(x ^ y), uint8_t(255 - y)};
+}
+
+/* Encodes width x height pixels, checking every write is whole aligned
+ * blocks, and returns the file with its header rewritten. */
+std::vector<uint8_t> encode(Format format, uint32_t width, uint32_t height, size_t block_size = 512) {
+    RowEncoder encoder{};
+    encoder.begin(format, width, block_size);
+    std::vector<uint8_t> file{};
+
+    auto consume = [&]() {
+        REQUIRE(encoder.offset() == file.size());
+        file.insert(file.end(), encoder.data(), encoder.data() + encoder.ready());
+        encoder.consume();
+    };
+
+    bool rows_end = true;
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x++) {
+            rows_end &= (encoder.pixel(test_pixel(x, y)) == (x == width - 1));
+            if (encoder.ready() >= block_size) {
+                CHECK(encoder.ready() % block_size == 0);
+                consume();
+            }
+        }
+    }
+    CHECK(rows_end);
+    encoder.finish();
+    consume();
+
+    uint8_t header[RowEncoder::max_header_size];
+    const auto size = encoder.header(header);
+    REQUIRE(size == encoder.header_size());
+    std::memcpy(file.data(), header, size);
+    return file;
+}
+
+uint32_t get_uint32_le(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (uint32_t(p[3]) << 24);
+}
+
+uint32_t get_uint32_be(const uint8_t* p) {
+    return (uint32_t(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+/* The image data of a PNG written by RowEncoder: checks the chunk CRCs,
+ * unpacks the stored deflate blocks and checks the Adler-32. */
+std::vector<uint8_t> png_image_data(const std::vector<uint8_t>& file, uint32_t& width, uint32_t& height) {
+    REQUIRE(file.size() > 8);
+    CHECK(file[0] == 0x89);
+    CHECK(std::memcmp(&file[1], "PNG", 3) == 0);
+
+    std::vector<uint8_t> zlib{};
+    size_t pos = 8;
+    bool iend = false;
+    while (pos + 12 <= file.size()) {
+        const auto length = get_uint32_be(&file[pos]);
+        REQUIRE(pos + 12 + length <= file.size());
+        const auto type = &file[pos + 4];
+
+        CRC<32, true, true> crc{0x04c11db7, 0xffffffff, 0xffffffff};
+        crc.process_bytes(type, 4 + length);
+        CHECK(get_uint32_be(&file[pos + 8 + length]) == crc.checksum());
+
+        if (std::memcmp(type, "IHDR", 4) == 0) {
+            width = get_uint32_be(&file[pos + 8]);
+            height = get_uint32_be(&file[pos + 12]);
+        } else if (std::memcmp(type, "IDAT", 4) == 0) {
+            zlib.insert(zlib.end(), &file[pos + 8], &file[pos + 8 + length]);
+        } else if (std::memcmp(type, "IEND", 4) == 0) {
+            iend = true;
+        }
+        pos += 12 + length;
+    }
+    CHECK(iend);
+    CHECK(pos == file.size());
+
+    REQUIRE(zlib.size() >= 6);
+    CHECK(((zlib[0] << 8) | zlib[1]) % 31 == 0);
+    std::vector<uint8_t> data{};
+    size_t z = 2;
+    bool final_block = false;
+    while (!final_block) {
+        REQUIRE(z + 5 <= zlib.size());
+        final_block = zlib[z] & 1;
+        CHECK((zlib[z] >> 1) == 0);  // Stored.
+        const uint16_t length = zlib[z + 1] | (zlib[z + 2] << 8);
+        const uint16_t inverse = zlib[z + 3] | (zlib[z + 4] << 8);
+        CHECK(uint16_t(~length) == inverse);
+        REQUIRE(z + 5 + length <= zlib.size());
+        data.insert(data.end(), &zlib[z + 5], &zlib[z + 5 + length]);
+        z += 5 + length;
+    }
+    REQUIRE(z + 4 == zlib.size());
+    Adler32 adler{};
+    adler.feed(data.data(), data.size());
+    const auto checksum = adler.bytes();
+    CHECK(std::memcmp(&zlib[z], checksum.data(), 4) == 0);
+    return data;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Image sink");
+
+TEST_CASE("BMP rows are padded and the header counts them.") {
+    for (const uint32_t width : {1u, 2u, 840u, 2080u}) {
+        CAPTURE(width);
+        const uint32_t height = 9;
+        const auto file = encode(Format::BMP, width, height);
+        const uint32_t row_size = (width * 3 + 3) & ~3;
+
+        REQUIRE(file.size() == 54 + height * row_size);
+        CHECK(file[0] == 'B');
+        CHECK(file[1] == 'M');
+        CHECK(get_uint32_le(&file[2]) == file.size());
+        CHECK(get_uint32_le(&file[10]) == 54);
+        CHECK(get_uint32_le(&file[18]) == width);
+        CHECK(int32_t(get_uint32_le(&file[22])) == -int32_t(height));
+        CHECK(get_uint32_le(&file[34]) == height * row_size);
+
+        bool pixels_match = true;
+        for (uint32_t y = 0; y < height; y++) {
+            for (uint32_t x = 0; x < width; x++) {
+                const auto p = &file[54 + y * row_size + x * 3];
+                auto expected = test_pixel(x, y);
+                pixels_match &= (p[0] == expected.b() && p[1] == expected.g() && p[2] == expected.r());
+            }
+        }
+        CHECK(pixels_match);
+    }
+}
+
+TEST_CASE("PNG is valid and holds the pixels.") {
+    for (const uint32_t width : {1u, 3u, 840u, 2080u}) {
+        for (const size_t block_size : {64u, 512u, 4096u}) {
+            CAPTURE(width);
+            CAPTURE(block_size);
+            const uint32_t height = 7;
+            const auto file = encode(Format::PNG, width, height, block_size);
+
+            uint32_t png_width = 0;
+            uint32_t png_height = 0;
+            const auto data = png_image_data(file, png_width, png_height);
+            CHECK(png_width == width);
+            CHECK(png_height == height);
+            REQUIRE(data.size() == height * (1 + width * 3));
+
+            bool pixels_match = true;
+            for (uint32_t y = 0; y < height; y++) {
+                const auto row = &data[y * (1 + width * 3)];
+                pixels_match &= (row[0] == 0);  // Filter.
+                for (uint32_t x = 0; x < width; x++) {
+                    auto expected = test_pixel(x, y);
+                    pixels_match &= (row[1 + x * 3] == expected.r() && row[2 + x * 3] == expected.g() && row[3 + x * 3] == expected.b());
+                }
+            }
+            CHECK(pixels_match);
+        }
+    }
+}
+
+TEST_CASE("finish() completes a partial row.") {
+    RowEncoder encoder{};
+    encoder.begin(Format::BMP, 4);
+    for (size_t i = 0; i < 6; i++)
+        encoder.pixel(ui::Color::white());
+    encoder.finish();
+    CHECK(encoder.rows() == 2);
+    CHECK(encoder.ready() == 54 + 2 * 12);
+}
+
+TEST_CASE("Writes per NOAA APT image.") {
+    /* BMPFile wrote every pixel on its own and rewrote the header after
+     * every row: 3 writes and 2 seeks a pixel. */
+    const uint32_t width = 2080;
+    const uint32_t height = 100;
+    RowEncoder encoder{};
+    encoder.begin(Format::BMP, width);
+    size_t writes = 0;
+    for (uint32_t i = 0; i < width * height; i++) {
+        encoder.pixel(ui::Color::black());
+        if (encoder.ready() >= encoder.block_size()) {
+            writes++;
+            encoder.consume();
+        }
+    }
+    const size_t bytes = 54 + height * width * 3;
+    MESSAGE(writes << " writes of " << encoder.block_size() << " bytes for " << height << " rows, was " << height * width << " pixel writes");
+    CHECK(writes == bytes / encoder.block_size());
+}
+
+TEST_SUITE_END();
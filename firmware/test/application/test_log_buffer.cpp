@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "doctest.h"
+#include "log_buffer.hpp"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string drain(LogBuffer& buffer) {
+    std::string out{};
+    while (buffer.pending()) {
+        const auto chunk = buffer.peek();
+        out += chunk;
+        buffer.consume(chunk.size());
+    }
+    return out;
+}
+
+/* The writer thread's loop, polled every 'poll_ms', against a card that
+ * counts writes and syncs. */
+struct Writer {
+    LogBuffer& buffer;
+    GroupCommit commit{};
+    std::string file{};
+    size_t writes{0};
+    size_t syncs{0};
+    size_t synced_size{0};
+
+    void poll(uint32_t now) {
+        if (commit.write_due(buffer.pending(), now)) {
+            while (buffer.pending()) {
+                const auto chunk = buffer.peek();
+                file += chunk;
+                writes++;
+                buffer.consume(chunk.size());
+                commit.written(chunk.size(), now);
+            }
+        }
+        if (commit.sync_due(now)) {
+            syncs++;
+            synced_size = file.size();
+            commit.synced();
+        }
+    }
+};
+
+std::string line(size_t n) {
+    return "20260101120000 *8d4840d6202cc371c32ce0576098 #" + std::to_string(n);
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Log buffer");
+
+TEST_CASE("Lines come out whole and in order, across the wrap.") {
+    LogBuffer buffer{64};
+    std::string expected{};
+    for (size_t n = 0; n < 50; n++) {
+        const auto number = std::to_string(n);
+        REQUIRE(buffer.write_line({"line ", number, " end"}));
+        expected += "line " + number + " end\r\n";
+        if (n % 3 == 2) {
+            CHECK(drain(buffer) == expected);
+            expected.clear();
+        }
+    }
+    CHECK(drain(buffer) == expected);
+    CHECK(buffer.stats().lines == 50);
+    CHECK(buffer.stats().dropped_lines == 0);
+}
+
+TEST_CASE("A line that doesn't fit is dropped and counted.") {
+    LogBuffer buffer{32};
+    CHECK(buffer.write_line({"0123456789"}));  // 12 bytes
+    CHECK(buffer.write_line({"0123456789"}));
+    CHECK_FALSE(buffer.write_line({"0123456789"}));
+    CHECK(buffer.write_line({"012345"}));  // Exactly fills it.
+    CHECK(buffer.pending() == 32);
+    CHECK(buffer.stats().dropped_lines == 1);
+    CHECK(buffer.stats().dropped_bytes == 12);
+    CHECK(buffer.stats().high_water == 32);
+
+    buffer.consume(buffer.peek().size());
+    CHECK(buffer.write_line({"0123456789"}));
+    CHECK(drain(buffer) == "0123456789\r\n");
+}
+
+TEST_CASE("Writes go out in blocks or when old, syncs cover many writes.") {
+    GroupCommit commit{{100, 250, 300, 2000}};
+    CHECK_FALSE(commit.write_due(0, 0));
+    CHECK_FALSE(commit.write_due(40, 10));
+    CHECK_FALSE(commit.write_due(80, 200));
+    CHECK(commit.write_due(80, 260));  // Waiting since 10.
+    commit.written(80, 260);
+    CHECK(commit.write_due(100, 270));
+    commit.written(100, 270);
+
+    CHECK_FALSE(commit.sync_due(300));
+    CHECK(commit.sync_due(2260));  // Unsynced since 260.
+    commit.written(200, 280);
+    CHECK(commit.sync_due(290));  // 380 bytes.
+    commit.synced();
+    CHECK_FALSE(commit.sync_due(5000));
+}
+
+TEST_CASE("Everything logged reaches the card, with far fewer syncs.") {
+    // ADS-B in a busy area: bursts of 10 lines every 100ms for a minute.
+    LogBuffer buffer{2048};
+    Writer writer{buffer};
+    std::string expected{};
+    size_t lines = 0;
+    for (uint32_t now = 0; now < 60'000; now += 50) {
+        if (now % 100 == 0) {
+            for (size_t i = 0; i < 10; i++) {
+                const auto text = line(lines++);
+                REQUIRE(buffer.write_line({text}));
+                expected += text + "\r\n";
+            }
+        }
+        writer.poll(now);
+    }
+    // Everything older than the sync interval is on the card.
+    CHECK(writer.synced_size + 4096 + 2048 >= expected.size());
+    for (uint32_t now = 60'000; now < 65'000; now += 50)
+        writer.poll(now);
+
+    CHECK(writer.file == expected);
+    CHECK(writer.synced_size == expected.size());
+    CHECK(buffer.stats().dropped_lines == 0);
+
+    // Before: write_line() made 2 f_write and 1 f_sync calls a line.
+    MESSAGE(lines << " lines: " << writer.writes << " writes and " << writer.syncs << " syncs, were "
+                  << 2 * lines << " writes and " << lines << " syncs. High water "
+                  << buffer.stats().high_water << " of " << buffer.capacity() << " bytes");
+    CHECK(writer.syncs * 50 < lines);
+}
+
+TEST_CASE("A stalled card drops lines instead of blocking.") {
+    LogBuffer buffer{2048};
+    Writer writer{buffer};
+    size_t lines = 0;
+    size_t bytes = 0;
+    for (uint32_t now = 0; now < 3'000; now += 50) {
+        for (size_t i = 0; i < 5; i++) {
+            const auto text = line(lines++);
+            buffer.write_line({text});
+            bytes += text.size() + 2;
+        }
+        // The card takes 1s to come back.
+        if (now < 1'000 || now >= 2'000)
+            writer.poll(now);
+    }
+    const auto& stats = buffer.stats();
+    CHECK(stats.dropped_lines > 0);
+    CHECK(stats.lines + stats.dropped_lines == lines);
+    CHECK(stats.high_water <= buffer.capacity());
+
+    for (uint32_t now = 3'000; now < 6'000; now += 50)
+        writer.poll(now);
+    CHECK(writer.file.size() + stats.dropped_bytes == bytes);
+}
+
+TEST_SUITE_END();
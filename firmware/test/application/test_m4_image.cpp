@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "m4_image.hpp"
+
+#include <vector>
+
+namespace {
+
+using Residency = M4ImageResidency<uint32_t>;
+
+std::vector<uint32_t> region(size_t words, uint32_t seed) {
+    std::vector<uint32_t> r(words);
+    for (auto& word : r) {
+        seed = seed * 1664525 + 1013904223;
+        word = seed;
+    }
+    return r;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("M4 image residency");
+
+TEST_CASE("Nothing is resident at first.") {
+    const auto code = region(64, 1);
+    const Residency residency{};
+    CHECK_FALSE(residency.holds(0, code.data(), code.size()));
+}
+
+TEST_CASE("The image unpacked last is resident, others aren't.") {
+    const auto code = region(64, 1);
+    Residency residency{};
+    residency.unpacked(7, code.data(), code.size());
+    CHECK(residency.holds(7, code.data(), code.size()));
+    CHECK_FALSE(residency.holds(8, code.data(), code.size()));
+
+    const auto other = code;
+    CHECK_FALSE(residency.holds(7, other.data(), other.size()));
+}
+
+TEST_CASE("Any write to the region makes it unpack again.") {
+    auto code = region(8192, 1);
+    Residency residency{};
+    residency.unpacked(7, code.data(), code.size());
+
+    for (const size_t index : {size_t(0), size_t(4095), size_t(8191)}) {
+        CAPTURE(index);
+        auto changed = code;
+        changed[index] ^= 1;
+        code.swap(changed);
+        CHECK_FALSE(residency.holds(7, code.data(), code.size()));
+        code.swap(changed);
+    }
+    CHECK(residency.holds(7, code.data(), code.size()));
+}
+
+TEST_CASE("invalidate() forgets the image.") {
+    const auto code = region(64, 1);
+    Residency residency{};
+    residency.unpacked(7, code.data(), code.size());
+    residency.invalidate();
+    CHECK_FALSE(residency.holds(7, code.data(), code.size()));
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "doctest.h"
+#include "packet_log.hpp"
+#include "string_format.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace packet_log;
+
+namespace {
+
+const uint8_t frame[14] = {0x8d, 0x48, 0x40, 0xd6, 0x20, 0x2c, 0xc3, 0x71, 0xc3, 0x2c, 0xe0, 0x57, 0x60, 0x98};
+
+std::string adsb_record(uint32_t seconds, int32_t altitude) {
+    Record record{Type::ADSB, seconds};
+    record.raw(frame, sizeof(frame))
+        .field(adsb::ICAO, int32_t(0x4840d6))
+        .field(adsb::Altitude, altitude)
+        .field(adsb::Latitude, degrees_e7(51.9893512))
+        .field(adsb::Longitude, degrees_e7(-4.3758))
+        .field(adsb::Callsign, std::string_view{"KLM1023"});
+    return std::string{record.bytes()};
+}
+
+std::string sync(uint32_t seconds, uint32_t records) {
+    return std::string{Record::sync(seconds, records).bytes()};
+}
+
+std::vector<Entry> read_all(Reader& reader) {
+    std::vector<Entry> entries{};
+    Entry entry{};
+    while (reader.next(entry))
+        entries.push_back(entry);
+    return entries;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Packet log");
+
+TEST_CASE("Timestamps are seconds since 2000.") {
+    CHECK(seconds_since_2000(rtc::RTC{2000, 1, 1, 0, 0, 0}) == 0);
+    CHECK(seconds_since_2000(rtc::RTC{2024, 2, 29, 23, 59, 59}) == 762566399);
+    CHECK(seconds_since_2000(rtc::RTC{2026, 10, 19, 12, 34, 56}) == 845728496);
+}
+
+TEST_CASE("Records read back with their fields.") {
+    const auto data = sync(100, 0) + adsb_record(100, 38000) + adsb_record(101, -1000);
+    Reader reader{data};
+    const auto entries = read_all(reader);
+    REQUIRE(entries.size() == 2);
+    CHECK(reader.skipped() == 0);
+
+    CHECK(entries[1].type == Type::ADSB);
+    CHECK(entries[1].seconds == 101);
+    CHECK(entries[1].raw == std::string_view{reinterpret_cast<const char*>(frame), sizeof(frame)});
+
+    auto fields = entries[1].fields;
+    Field field{};
+    REQUIRE(next_field(fields, field));
+    CHECK(field.id == adsb::ICAO);
+    CHECK(field.kind == Kind::Int);
+    CHECK(field.int_value == 0x4840d6);
+    REQUIRE(next_field(fields, field));
+    CHECK(field.int_value == -1000);
+    REQUIRE(next_field(fields, field));
+    CHECK(field.kind == Kind::Int);
+    CHECK(field.int_value == 519893512);
+    REQUIRE(next_field(fields, field));
+    CHECK(field.id == adsb::Longitude);
+    CHECK(field.int_value == -43758000);
+    REQUIRE(next_field(fields, field));
+    CHECK(field.kind == Kind::Text);
+    CHECK(field.text == "KLM1023");
+    CHECK_FALSE(next_field(fields, field));
+}
+
+TEST_CASE("Ints of any size.") {
+    for (const int32_t value : {0, 1, -1, 63, -64, 64, 1000000, INT32_MAX, INT32_MIN}) {
+        CAPTURE(value);
+        Record record{Type::ADSB, 0};
+        record.raw(nullptr, 0).field(9, value);
+        const std::string data{record.bytes()};
+        Reader reader{data};
+        Entry entry{};
+        REQUIRE(reader.next(entry));
+        Field field{};
+        REQUIRE(next_field(entry.fields, field));
+        CHECK(field.id == 9);
+        CHECK(field.int_value == value);
+    }
+}
+
+TEST_CASE("Floats and positions.") {
+    Record record{Type::ADSB, 0};
+    record.raw(nullptr, 0)
+        .field(adsb::Speed, 452.5f)
+        .field(adsb::Latitude, degrees_e7(-89.9999999))
+        .field(adsb::Longitude, degrees_e7(180.0));
+    const std::string data{record.bytes()};
+    Reader reader{data};
+    Entry entry{};
+    REQUIRE(reader.next(entry));
+    Field field{};
+    REQUIRE(next_field(entry.fields, field));
+    CHECK(field.kind == Kind::Float);
+    CHECK(field.float_value == 452.5f);
+    REQUIRE(next_field(entry.fields, field));
+    CHECK(field.int_value == -899999999);
+    REQUIRE(next_field(entry.fields, field));
+    CHECK(field.int_value == 1800000000);
+}
+
+TEST_CASE("Fields that don't fit are left out.") {
+    Record record{Type::ADSB, 0};
+    const std::string text(200, 'x');
+    record.raw(frame, sizeof(frame)).field(1, text).field(2, text).field(3, int32_t(7));
+    CHECK_FALSE(record.complete());
+
+    const std::string data{record.bytes()};
+    CHECK(data.size() <= max_record);
+    Reader reader{data};
+    Entry entry{};
+    REQUIRE(reader.next(entry));
+    Field field{};
+    REQUIRE(next_field(entry.fields, field));
+    CHECK(field.text == text);
+    REQUIRE(next_field(entry.fields, field));
+    CHECK(field.id == 3);
+    CHECK_FALSE(next_field(entry.fields, field));
+}
+
+TEST_CASE("Damaged data is skipped up to the next sync record.") {
+    std::string data = sync(0, 0);
+    for (uint32_t n = 0; n < 10; n++)
+        data += adsb_record(n, n);
+    const auto second_sync = data.size();
+    data += sync(10, 10);
+    for (uint32_t n = 10; n < 15; n++)
+        data += adsb_record(n, n);
+
+    SUBCASE("Flipped bit") {
+        data[second_sync - 20] ^= 0x04;
+        Reader reader{data};
+        const auto entries = read_all(reader);
+        REQUIRE(entries.size() == 14);
+        CHECK(entries[8].seconds == 8);
+        CHECK(entries[9].seconds == 10);
+        CHECK(reader.skipped() == adsb_record(9, 9).size());
+    }
+
+    SUBCASE("Torn write, then more records") {
+        data.erase(second_sync - 7, 7);
+        Reader reader{data};
+        CHECK(read_all(reader).size() == 14);
+    }
+
+    SUBCASE("Torn last record") {
+        data.resize(data.size() - 3);
+        Reader reader{data};
+        CHECK(read_all(reader).size() == 14);
+        CHECK(reader.skipped() == adsb_record(14, 14).size() - 3);
+    }
+}
+
+TEST_CASE("Smaller than the text log.") {
+    // A line of the ADS-B text log as it was.
+    const std::string text = "20261019123456 " + to_string_hex_array(const_cast<uint8_t*>(frame), 14) +
+                             " ICAO:4840D6 KLM1023 Alt:38000 Lat:" + to_string_decimal(51.9893f, 7) +
+                             " Lon:" + to_string_decimal(4.3758f, 7) + "\r\n";
+    const auto binary = adsb_record(0, 38000);
+    MESSAGE("ADS-B position: " << binary.size() << " bytes, " << text.size() << " as text");
+    CHECK(binary.size() * 2 < text.size());
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "doctest.h"
+#include "recent_entries.hpp"
+
+#include <array>
+#include <chrono>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct TestEntry {
+    using Key = uint64_t;
+    static constexpr Key invalid_key = 0xffffffffffffffff;
+
+    Key id;
+    size_t received_count{0};
+    std::array<uint8_t, 96> data{};  // About the size of a decoder entry.
+
+    TestEntry(Key id)
+        : id{id} {
+    }
+
+    Key key() const { return id; }
+};
+
+using Entries = RecentEntries<TestEntry, 16>;
+
+template <size_t N>
+std::vector<uint64_t> keys_of(const RecentEntries<TestEntry, N>& entries) {
+    std::vector<uint64_t> keys{};
+    for (const auto& entry : entries)
+        keys.push_back(entry.key());
+    return keys;
+}
+
+std::vector<uint64_t> keys_of(const std::list<TestEntry>& entries) {
+    std::vector<uint64_t> keys{};
+    for (const auto& entry : entries)
+        keys.push_back(entry.key());
+    return keys;
+}
+
+/* on_packet() as it was over a std::list. */
+TestEntry& list_on_packet(std::list<TestEntry>& entries, uint64_t key, size_t max) {
+    auto matching_recent = find(entries, key);
+    if (matching_recent != std::end(entries)) {
+        entries.push_front(*matching_recent);
+        entries.erase(matching_recent);
+    } else {
+        entries.emplace_front(key);
+        truncate_entries(entries, max);
+    }
+    return entries.front();
+}
+
+/* Packets from 'senders' senders, the lower ones heard more often. */
+std::vector<uint64_t> traffic(size_t packets, size_t senders) {
+    std::vector<uint64_t> keys{};
+    uint32_t seed = 1;
+    for (size_t i = 0; i < packets; i++) {
+        seed = seed * 1664525 + 1013904223;
+        const auto r = (seed >> 8) % senders;
+        keys.push_back(0xa0000000 + r * r / senders);
+    }
+    return keys;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("RecentEntries");
+
+TEST_CASE("on_packet moves the entry to the front and keeps it.") {
+    Entries entries{};
+    for (const uint64_t key : {1, 2, 3})
+        on_packet(entries, key).received_count++;
+    CHECK(keys_of(entries) == std::vector<uint64_t>{3, 2, 1});
+
+    auto& entry = on_packet(entries, 1);
+    CHECK(&entry == &entries.front());
+    CHECK(entry.received_count == 1);
+    CHECK(keys_of(entries) == std::vector<uint64_t>{1, 3, 2});
+
+    CHECK(find(entries, 3) != entries.end());
+    CHECK(find(entries, 4) == entries.end());
+    CHECK(entries.back().key() == 2);
+}
+
+TEST_CASE("Past the capacity, the last entry is dropped.") {
+    Entries entries{};
+    for (uint64_t key = 0; key < 40; key++)
+        entries.emplace_front(key);
+    CHECK(entries.size() == Entries::capacity);
+    CHECK(entries.back().key() == 40 - Entries::capacity);
+    CHECK(find(entries, 40 - Entries::capacity - 1) == entries.end());
+    for (uint64_t key = 40 - Entries::capacity; key < 40; key++)
+        CHECK(find(entries, key) != entries.end());
+}
+
+TEST_CASE("Capacities past the largest bucket count keep every entry.") {
+    RecentEntries<TestEntry, 200> entries{};
+    for (uint64_t key = 0; key < 300; key++)
+        on_packet(entries, key);
+    CHECK(entries.size() == 200);
+    for (uint64_t key = 100; key < 300; key++)
+        CHECK(find(entries, key) != entries.end());
+}
+
+TEST_CASE("erase, reverse iteration, pop and clear.") {
+    Entries entries{};
+    for (uint64_t key = 0; key < 8; key++)
+        entries.emplace_back(key);
+
+    auto it = entries.erase(find(entries, 3));
+    CHECK(it->key() == 4);
+    CHECK(find(entries, 3) == entries.end());
+
+    // Like remove_expired_entries() in ADS-B RX.
+    auto r = entries.rbegin();
+    std::advance(r, 2);
+    entries.erase(r.base(), entries.end());
+    CHECK(keys_of(entries) == std::vector<uint64_t>{0, 1, 2, 4, 5});
+
+    entries.pop_front();
+    entries.pop_back();
+    CHECK(keys_of(entries) == std::vector<uint64_t>{1, 2, 4});
+
+    const Entries& const_entries = entries;
+    CHECK(find(const_entries, 2)->key() == 2);
+
+    entries.clear();
+    CHECK(entries.empty());
+    CHECK(find(entries, 2) == entries.end());
+    entries.emplace_front(9);
+    CHECK(keys_of(entries) == std::vector<uint64_t>{9});
+}
+
+TEST_CASE("sort is stable.") {
+    Entries entries{};
+    for (uint64_t key : {15, 4, 23, 8, 42, 16, 7, 1})
+        entries.emplace_back(key);
+
+    entries.sort([](const TestEntry& a, const TestEntry& b) { return a.key() % 4 < b.key() % 4; });
+    CHECK(keys_of(entries) == std::vector<uint64_t>{4, 8, 16, 1, 42, 15, 23, 7});
+
+    sortEntriesBy(entries, [](const TestEntry& e) { return e.key(); }, false);
+    CHECK(keys_of(entries) == std::vector<uint64_t>{42, 23, 16, 15, 8, 7, 4, 1});
+
+    // Still indexed.
+    for (uint64_t key : {15, 4, 23, 8, 42, 16, 7, 1})
+        CHECK(find(entries, key)->key() == key);
+}
+
+TEST_CASE("Same order as the std::list version.") {
+    Entries entries{};
+    std::list<TestEntry> reference{};
+    for (const auto key : traffic(2000, 40)) {
+        on_packet(entries, key).received_count++;
+        list_on_packet(reference, key, Entries::capacity).received_count++;
+        REQUIRE(keys_of(entries) == keys_of(reference));
+        REQUIRE(entries.front().received_count == reference.front().received_count);
+    }
+}
+
+TEST_CASE("Pair and enum keys.") {
+    enum class Kind { A, B };
+    struct PairEntry {
+        using Key = std::pair<Kind, uint32_t>;
+        Key k;
+        PairEntry(Key k)
+            : k{k} {
+        }
+        Key key() const { return k; }
+    };
+
+    RecentEntries<PairEntry> entries{};
+    on_packet(entries, PairEntry::Key{Kind::A, 1});
+    on_packet(entries, PairEntry::Key{Kind::B, 1});
+    CHECK(entries.size() == 2);
+    CHECK(find(entries, PairEntry::Key{Kind::A, 1}) != entries.end());
+    CHECK(find(entries, PairEntry::Key{Kind::A, 2}) == entries.end());
+}
+
+TEST_CASE("Benchmark") {
+    const auto packets = traffic(20000, 300);
+    using Clock = std::chrono::steady_clock;
+
+    RecentEntries<TestEntry> entries{};
+    auto start = Clock::now();
+    for (const auto key : packets)
+        on_packet(entries, key).received_count++;
+    const auto keyed = Clock::now() - start;
+
+    std::list<TestEntry> reference{};
+    start = Clock::now();
+    for (const auto key : packets)
+        list_on_packet(reference, key, 64).received_count++;
+    const auto list = Clock::now() - start;
+
+    CHECK(keys_of(entries) == keys_of(reference));
+    const auto ns = [&](Clock::duration d) { return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count() / packets.size(); };
+    MESSAGE(packets.size() << " packets from 300 senders, 64 entries: " << ns(keyed) << " ns per packet, " << ns(list) << " ns with std::list, on the host");
+}
+
+TEST_SUITE_END();
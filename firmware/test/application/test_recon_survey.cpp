@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "recon_survey.hpp"
+
+#include <algorithm>
+
+namespace {
+
+std::vector<ReconSurvey::Channel> channels(rf::Frequency first, rf::Frequency step, size_t count) {
+    std::vector<ReconSurvey::Channel> list{};
+    // Reversed, set_channels() has to sort them.
+    for (size_t i = count; i-- > 0;)
+        list.push_back({i, first + rf::Frequency(i) * step});
+    return list;
+}
+
+/* Every channel in exactly one window, inside the usable span and clear of DC. */
+void check_windows(const ReconSurvey& survey, size_t channel_count) {
+    const rf::Frequency half_span = survey.sampling_rate() * 4 / 5 / 2;
+    const rf::Frequency guard = survey.sampling_rate() / 256;
+
+    size_t covered = 0;
+    for (const auto& window : survey.windows()) {
+        REQUIRE(window.first == covered);
+        REQUIRE(window.count > 0);
+        covered += window.count;
+        for (size_t i = window.first; i < window.first + window.count; i++) {
+            const auto offset = survey.channels()[i].frequency - window.center;
+            CHECK(std::abs(offset) <= half_span);
+            CHECK(std::abs(offset) > guard);
+        }
+    }
+    CHECK(covered == channel_count);
+    CHECK(std::is_sorted(survey.centers().begin(), survey.centers().end()));
+}
+
+/* Flat noise floor with a carrier on the given offset. */
+ReconSurvey::Spectrum spectrum_with_carrier(const ReconSurvey& survey, rf::Frequency offset) {
+    ReconSurvey::Spectrum db{};
+    db.fill(100);
+    const int32_t bin = (offset + int32_t(survey.sampling_rate() / 512)) / int32_t(survey.sampling_rate() / 256);
+    db[bin & 0xff] = 200;
+    return db;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Recon survey");
+
+TEST_CASE("A PMR446 list fits one window.") {
+    ReconSurvey survey{};
+    survey.set_channels(channels(446'006'250, 12'500, 16));
+    CHECK(survey.windows().size() == 1);
+    check_windows(survey, 16);
+}
+
+TEST_CASE("Sparse and dense lists are covered.") {
+    ReconSurvey survey{};
+
+    // 500 airband channels at 25kHz, dense enough to need DC gaps.
+    survey.set_channels(channels(118'000'000, 25'000, 500));
+    check_windows(survey, 500);
+    MESSAGE("500 airband channels: " << survey.windows().size() << " windows");
+    CHECK(survey.windows().size() < 15);
+
+    // Far apart channels get a window each.
+    survey.set_channels(channels(100'000'000, 50'000'000, 10));
+    check_windows(survey, 10);
+    CHECK(survey.windows().size() == 10);
+
+    // Duplicates.
+    auto list = channels(433'920'000, 0, 3);
+    survey.set_channels(list);
+    check_windows(survey, 3);
+    CHECK(survey.windows().size() == 1);
+}
+
+TEST_CASE("window_at finds the window by its center.") {
+    ReconSurvey survey{};
+    survey.set_channels(channels(100'000'000, 50'000'000, 4));
+    for (size_t i = 0; i < survey.centers().size(); i++)
+        CHECK(survey.window_at(survey.centers()[i]) == int32_t(i));
+    CHECK(survey.window_at(survey.centers()[0] + 1) == -1);
+}
+
+TEST_CASE("find_hits reports the channel carrying a signal.") {
+    ReconSurvey survey{};
+    survey.set_channels(channels(446'006'250, 25'000, 8));
+    REQUIRE(survey.windows().size() == 1);
+    const auto& window = survey.windows()[0];
+
+    for (size_t i = 0; i < window.count; i++) {
+        const auto& channel = survey.channels()[window.first + i];
+        std::vector<size_t> hits{};
+        survey.find_hits(0, spectrum_with_carrier(survey, channel.frequency - window.center), hits);
+        REQUIRE(hits.size() == 1);
+        CHECK(hits[0] == channel.index);
+    }
+
+    // Nothing stands out.
+    ReconSurvey::Spectrum flat{};
+    flat.fill(120);
+    std::vector<size_t> hits{};
+    survey.find_hits(0, flat, hits);
+    CHECK(hits.empty());
+}
+
+TEST_SUITE_END();
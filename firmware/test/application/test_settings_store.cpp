@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "mock_file.hpp"
+#include "settings_store.hpp"
+
+#include <string>
+
+using settings_store::Block;
+using Index = settings_store::Index<MockFile>;
+
+namespace {
+
+Block make_block(std::string_view app_name, uint32_t value, std::string text = {}) {
+    Block block{app_name};
+    block.add("value", 2, &value, sizeof(value));
+    block.add("text", 4, text.data(), text.size());
+    return block;
+}
+
+uint32_t value_of(const Block& block) {
+    uint32_t value = 0;
+    block.for_each([&value](const Block::Record& record) {
+        if (record.name_hash == settings_store::hash("value"))
+            memcpy(&value, record.value.data(), sizeof(value));
+    });
+    return value;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Settings store");
+
+TEST_CASE("A block gives back its records in order.") {
+    const auto block = make_block("rx", 433920000, "hello");
+    CHECK(block.app_name() == "rx");
+
+    std::string names{};
+    std::string text{};
+    const bool ok = block.for_each([&](const Block::Record& record) {
+        names += std::string{record.name} + ",";
+        if (record.type == 4)
+            text = std::string{record.value};
+    });
+    CHECK(ok);
+    CHECK(names == "value,text,");
+    CHECK(text == "hello");
+    CHECK(value_of(block) == 433920000);
+}
+
+TEST_CASE("A cut short block is malformed.") {
+    auto block = make_block("rx", 1, "hello");
+    block.bytes().resize(block.bytes().size() - 2);
+    CHECK_FALSE(block.for_each([](const Block::Record&) {}));
+}
+
+TEST_CASE("Blocks read back from a reloaded store.") {
+    MockFile file{""};
+    Index index{};
+    REQUIRE(index.load(file));
+    CHECK(index.write(file, settings_store::hash("a"), make_block("a", 1)));
+    CHECK(index.write(file, settings_store::hash("b"), make_block("b", 2)));
+
+    Index reloaded{};
+    REQUIRE(reloaded.load(file));
+    CHECK(reloaded.slots().size() == 2);
+
+    Block block{};
+    REQUIRE(reloaded.read(file, settings_store::hash("b"), block));
+    CHECK(block.app_name() == "b");
+    CHECK(value_of(block) == 2);
+    CHECK_FALSE(reloaded.read(file, settings_store::hash("c"), block));
+}
+
+TEST_CASE("A block that fits is rewritten in place, one that doesn't moves.") {
+    MockFile file{""};
+    Index index{};
+    REQUIRE(index.load(file));
+    const auto a = settings_store::hash("a");
+    REQUIRE(index.write(file, a, make_block("a", 1, "12345678")));
+    REQUIRE(index.write(file, settings_store::hash("b"), make_block("b", 2)));
+    const auto offset = index.slots()[0].offset;
+    const auto size = file.size();
+
+    REQUIRE(index.write(file, a, make_block("a", 3, "1234")));
+    CHECK(index.slots()[0].offset == offset);
+    CHECK(file.size() == size);
+
+    REQUIRE(index.write(file, a, make_block("a", 4, std::string(100, 'x'))));
+    CHECK(index.slots()[0].offset > offset);
+
+    Index reloaded{};
+    REQUIRE(reloaded.load(file));
+    Block block{};
+    REQUIRE(reloaded.read(file, a, block));
+    CHECK(value_of(block) == 4);
+    REQUIRE(reloaded.read(file, settings_store::hash("b"), block));
+    CHECK(value_of(block) == 2);
+}
+
+TEST_CASE("Apps past the slot capacity don't fit.") {
+    MockFile file{""};
+    Index index{};
+    REQUIRE(index.load(file));
+    for (uint32_t i = 0; i < Index::slot_capacity; i++)
+        REQUIRE(index.write(file, i, make_block("app", i)));
+    CHECK_FALSE(index.write(file, Index::slot_capacity, make_block("app", 0)));
+
+    // Existing ones still do.
+    CHECK(index.write(file, 5, make_block("app", 50)));
+}
+
+TEST_CASE("A removed app is gone after reloading, the others stay.") {
+    MockFile file{""};
+    Index index{};
+    REQUIRE(index.load(file));
+    REQUIRE(index.write(file, settings_store::hash("a"), make_block("a", 1)));
+    REQUIRE(index.write(file, settings_store::hash("b"), make_block("b", 2)));
+    REQUIRE(index.write(file, settings_store::hash("c"), make_block("c", 3)));
+
+    CHECK(index.remove(file, settings_store::hash("a")));
+    CHECK(index.remove(file, settings_store::hash("x")));
+
+    Index reloaded{};
+    REQUIRE(reloaded.load(file));
+    CHECK(reloaded.slots().size() == 2);
+    Block block{};
+    CHECK_FALSE(reloaded.read(file, settings_store::hash("a"), block));
+    REQUIRE(reloaded.read(file, settings_store::hash("b"), block));
+    CHECK(value_of(block) == 2);
+    REQUIRE(reloaded.read(file, settings_store::hash("c"), block));
+    CHECK(value_of(block) == 3);
+}
+
+TEST_CASE("A file that isn't a store doesn't load.") {
+    MockFile file{"rx_frequency=433920000\r\n"};
+    Index index{};
+    CHECK_FALSE(index.load(file));
+    CHECK(index.slots().empty());
+}
+
+TEST_SUITE_END();
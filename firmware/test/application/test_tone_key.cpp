@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "doctest.h"
+#include "tone_key.hpp"
+#include "tonesets.hpp"
+
+using namespace tonekey;
+
+TEST_SUITE_BEGIN("Tone keys");
+
+TEST_CASE("The baseband CTCSS list matches the tone keys.") {
+    REQUIRE(tone_keys.size() > ctcss_tones.size());
+    for (size_t i = 0; i < ctcss_tones.size(); i++) {
+        CAPTURE(i);
+        CHECK(tone_keys[i + 1].second == ctcss_tones[i]);
+        CHECK(tone_key_index_by_value(ctcss_tones[i]) == tone_index(i + 1));
+    }
+}
+
+TEST_CASE("A reported tone shows once it repeats, 0 clears it.") {
+    CHECK(tone_key_string_by_value(0, 20) == "        ");
+    CHECK(tone_key_string_by_value(8850, 20) == "        ");
+    CHECK(tone_key_string_by_value(8850, 20) == "T:88.5 #8 YB");
+    CHECK(tone_key_string_by_value(0, 20) == "        ");
+    CHECK(tone_key_string_by_value(8850, 20) == "        ");
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "max2837.hpp"
+#include "rffc507x.hpp"
+#include "tuning.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+/* Mock SPI buses. Each one keeps the register file the chip would have
+ * after the writes it saw, starting from the values init() flushes. */
+namespace {
+
+template <size_t N>
+struct MockChip {
+    std::array<uint16_t, N> registers;
+    size_t writes{0};
+
+    void write(const size_t reg_num, const uint16_t value) {
+        registers[reg_num] = value;
+        writes++;
+    }
+};
+
+using MAX2837Chip = MockChip<max2837::reg_count>;
+using RFFC507xChip = MockChip<rffc507x::reg_count + 1>;
+
+MAX2837Chip* max2837_chip = nullptr;
+RFFC507xChip* rffc507x_chip = nullptr;
+
+MAX2837Chip max2837_reset() {
+    return {max2837::initial_register_values.w};
+}
+
+RFFC507xChip rffc507x_reset() {
+    RFFC507xChip chip{};
+    std::copy(rffc507x::default_hackrf_one.w.begin(), rffc507x::default_hackrf_one.w.end(), chip.registers.begin());
+    return chip;
+}
+
+}  // namespace
+
+/* MAX283x: 16 bit SSP words, bit 15 = read, bits 14-10 = address. */
+extern "C" {
+void spiStart(SPIDriver*, const SPIConfig*) {}
+void spiStop(SPIDriver*) {}
+void spiSelect(SPIDriver*) {}
+void spiUnselect(SPIDriver*) {}
+void spiAcquireBus(SPIDriver*) {}
+void spiReleaseBus(SPIDriver*) {}
+void spiExchange(SPIDriver*, size_t, const void* txbuf, void*) {
+    const auto word = *static_cast<const uint16_t*>(txbuf);
+    if ((word & 0x8000) == 0)
+        max2837_chip->write((word >> 10) & 0x1f, word & 0x3ff);
+}
+}
+
+/* RFFC507x: bit-banged, mocked above the GPIO level. */
+namespace rffc507x::spi {
+void SPI::init() {}
+data_t SPI::transfer_word(const Direction direction, const address_t address, const data_t data_out) {
+    if (direction == Direction::Write)
+        rffc507x_chip->write(address, data_out);
+    return 0;
+}
+}  // namespace rffc507x::spi
+
+namespace {
+
+SPIDriver mock_driver{};
+SPI mock_bus{&mock_driver};
+spi::arbiter::Arbiter mock_arbiter{mock_bus};
+spi::arbiter::Target mock_target{mock_arbiter, SPIConfig{}};
+
+/* The radio front end as far as tuning goes, see radio::set_tuning(). */
+struct Radio {
+    MAX2837Chip second_if_chip{max2837_reset()};
+    RFFC507xChip first_if_chip{rffc507x_reset()};
+    max2837::MAX2837 second_if{mock_target};
+    rffc507x::RFFC507x first_if{};
+
+    struct Writes {
+        size_t first_if;
+        size_t second_if;
+    };
+
+    Writes tune(const tuning::Hop& hop) {
+        max2837_chip = &second_if_chip;
+        rffc507x_chip = &first_if_chip;
+        const Writes before{first_if_chip.writes, second_if_chip.writes};
+
+        if (hop.first_lo_frequency)
+            first_if.tune(hop.first_lo);
+        else if (first_if.enabled())
+            first_if.disable();
+        second_if.set_frequency(hop.second_lo);
+
+        return {first_if_chip.writes - before.first_if, second_if_chip.writes - before.second_if};
+    }
+};
+
+/* Hops through the list twice and checks every step leaves both chips
+ * where a radio tuned straight to that frequency would be. */
+Radio::Writes hop_through(const std::vector<rf::Frequency>& frequencies) {
+    std::vector<tuning::Hop> plan{};
+    for (const auto f : frequencies)
+        plan.push_back(tuning::Hop::create(f));
+
+    Radio radio{};
+    Radio::Writes total{0, 0};
+    for (size_t pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < plan.size(); i++) {
+            const auto writes = radio.tune(plan[i]);
+            total.first_if += writes.first_if;
+            total.second_if += writes.second_if;
+
+            Radio reference{};
+            reference.tune(tuning::Hop::create(frequencies[i]));
+            REQUIRE(radio.second_if_chip.registers == reference.second_if_chip.registers);
+            // A disabled RFFC507x can keep whatever it was last tuned to.
+            REQUIRE(radio.first_if.enabled() == reference.first_if.enabled());
+            if (plan[i].first_lo_frequency)
+                REQUIRE(radio.first_if_chip.registers == reference.first_if_chip.registers);
+        }
+    }
+    return total;
+}
+
+std::vector<rf::Frequency> channels(rf::Frequency first, rf::Frequency step, size_t count) {
+    std::vector<rf::Frequency> frequencies{};
+    for (size_t i = 0; i < count; i++)
+        frequencies.push_back(first + i * step);
+    return frequencies;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Tuning");
+
+TEST_CASE("Hop::create matches tuning::config::create.") {
+    for (const rf::Frequency f : {1'000'000ULL, 433'920'000ULL, 2'400'000'000ULL, 5'800'000'000ULL}) {
+        const auto config = tuning::config::create(f);
+        const auto hop = tuning::Hop::create(f);
+        REQUIRE(hop.is_valid());
+        CHECK(hop.first_lo_frequency == config.first_lo_frequency);
+        CHECK(hop.rf_path_band == config.rf_path_band);
+        CHECK(hop.mixer_invert == config.mixer_invert);
+        CHECK(hop.second_lo.band_index < max283x::lo::band.size());
+    }
+    CHECK_FALSE(tuning::Hop::create(7'300'000'000ULL).is_valid());
+}
+
+TEST_CASE("Tuning to the current frequency writes nothing.") {
+    Radio radio{};
+    const auto hop = tuning::Hop::create(433'920'000);
+    const auto first = radio.tune(hop);
+    CHECK(first.first_if > 0);
+    CHECK(first.second_if > 0);
+
+    const auto again = radio.tune(hop);
+    CHECK(again.first_if == 0);
+    CHECK(again.second_if == 0);
+}
+
+TEST_CASE("Mid band hops leave the RFFC507x alone.") {
+    Radio radio{};
+    radio.tune(tuning::Hop::create(433'920'000));
+    CHECK(radio.first_if.enabled());
+
+    // Disabled once on the way into the mid band, never touched after.
+    CHECK(radio.tune(tuning::Hop::create(2'402'000'000)).first_if == 1);
+    CHECK_FALSE(radio.first_if.enabled());
+    CHECK(radio.tune(tuning::Hop::create(2'426'000'000)).first_if == 0);
+}
+
+TEST_CASE("Register writes per hop.") {
+    /* Every hop used to disable, program (4 registers) and enable the
+     * RFFC507x and write 4 MAX2837 registers: 6 + 4 writes. */
+    struct List {
+        std::string name;
+        std::vector<rf::Frequency> frequencies;
+    };
+    const List lists[] = {
+        {"PMR446, 12.5kHz", channels(446'006'250, 12'500, 16)},
+        {"FM broadcast, 100kHz", channels(88'000'000, 100'000, 200)},
+        {"Looking Glass, 20MHz", channels(2'400'000'000 - 400'000'000, 20'000'000, 40)},
+        {"2.4GHz ISM, 2MHz", channels(2'402'000'000, 2'000'000, 40)},
+    };
+
+    for (const auto& list : lists) {
+        CAPTURE(list.name);
+        const auto hops = 2 * list.frequencies.size();
+        const auto writes = hop_through(list.frequencies);
+        const double first_if = double(writes.first_if) / hops;
+        const double second_if = double(writes.second_if) / hops;
+        MESSAGE(list.name << ": " << first_if << " RFFC507x + " << second_if << " MAX2837 writes/hop");
+        CHECK(first_if + second_if < 10.0);
+    }
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "doctest.h"
+#include "waterfall_history.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+using Row = WaterfallHistory::Row;
+
+constexpr size_t width = 240;
+
+/* Noise floor around 'floor' (a few steps either way) with a carrier at
+ * column 'carrier'. */
+Row noise_row(uint32_t& seed, uint8_t floor, size_t carrier) {
+    Row row{};
+    for (size_t i = 0; i < width; i++) {
+        seed = seed * 1664525 + 1013904223;
+        const int noise = int((seed >> 24) & 7) + int((seed >> 16) & 7) - 7;
+        row[i] = std::clamp(floor + noise + (i == carrier ? 120 : 0), 0, 255);
+    }
+    return row;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("WaterfallHistory");
+
+TEST_CASE("Rows come back as pushed, newest first.") {
+    WaterfallHistory history{width, 8192};
+    uint32_t seed = 1;
+    std::vector<Row> rows{};
+    for (size_t i = 0; i < 20; i++) {
+        rows.push_back(noise_row(seed, 40 + i, i * 7));
+        history.push(rows.back());
+    }
+
+    // Extremes: escapes everywhere.
+    Row extremes{};
+    for (size_t i = 0; i < width; i++)
+        extremes[i] = (i & 1) ? 255 : 0;
+    rows.push_back(extremes);
+    history.push(extremes);
+
+    REQUIRE(history.size() == rows.size());
+    Row out{};
+    for (size_t age = 0; age < rows.size(); age++) {
+        CAPTURE(age);
+        REQUIRE(history.row(age, out));
+        CHECK(out == rows[rows.size() - 1 - age]);
+    }
+    CHECK_FALSE(history.row(rows.size(), out));
+
+    history.clear();
+    CHECK(history.size() == 0);
+}
+
+TEST_CASE("Spectrum bins are laid out like the screen.") {
+    WaterfallHistory history{width, 1024};
+    WaterfallHistory::Spectrum db;
+    for (size_t i = 0; i < db.size(); i++)
+        db[i] = i;
+    history.push(db);
+
+    Row row{};
+    REQUIRE(history.row(0, row));
+    // Negative frequencies (upper bins) left of the center, DC in the middle.
+    CHECK(row[0] == 256 - 120);
+    CHECK(row[119] == 255);
+    CHECK(row[120] == 0);
+    CHECK(row[239] == 119);
+}
+
+TEST_CASE("The oldest rows make room.") {
+    constexpr size_t buffer_size = 2048;
+    WaterfallHistory history{width, buffer_size};
+    uint32_t seed = 2;
+    std::vector<Row> rows{};
+    for (size_t i = 0; i < 500; i++) {
+        // Varying code lengths, to wrap at every possible place.
+        rows.push_back(i % 3 ? noise_row(seed, 60, i % 240) : Row{});
+        history.push(rows.back());
+
+        REQUIRE(history.size() > 0);
+        Row out{};
+        for (size_t age = 0; age < history.size(); age++) {
+            REQUIRE(history.row(age, out));
+            REQUIRE(out == rows[rows.size() - 1 - age]);
+        }
+    }
+
+    // Noise floor rows take about half their raw size.
+    const auto rows_kept = history.size();
+    MESSAGE(rows_kept << " rows in " << buffer_size << " bytes");
+    CHECK(rows_kept > buffer_size / width);
+}
+
+TEST_SUITE_END();
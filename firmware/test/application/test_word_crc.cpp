@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "crc.hpp"
+#include "doctest.h"
+#include "word_crc.hpp"
+
+#include <array>
+
+namespace {
+
+constexpr size_t word_count = 63;  // The backup RAM image.
+using Words = std::array<uint32_t, word_count>;
+
+uint32_t full_crc(const Words& words) {
+    CRC<32> crc{0x04c11db7, 0xffffffff, 0xffffffff};
+    for (const auto word : words) {
+        crc.process_byte((word >> 0) & 0xff);
+        crc.process_byte((word >> 8) & 0xff);
+        crc.process_byte((word >> 16) & 0xff);
+        crc.process_byte((word >> 24) & 0xff);
+    }
+    return crc.checksum();
+}
+
+uint32_t lcg(uint32_t& state) {
+    state = state * 1664525 + 1013904223;
+    return state;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Word CRC");
+
+TEST_CASE("Updating one word matches the full CRC.") {
+    const WordCRC32<word_count> word_crc{};
+    Words words{};
+    uint32_t checksum = full_crc(words);
+
+    for (const size_t index : {size_t(0), size_t(1), size_t(31), word_count - 1}) {
+        CAPTURE(index);
+        const auto old_word = words[index];
+        words[index] = 0xdeadbeef ^ index;
+        checksum = word_crc.update(checksum, index, old_word, words[index]);
+        CHECK(checksum == full_crc(words));
+    }
+}
+
+TEST_CASE("Random changes in any order match the full CRC.") {
+    const WordCRC32<word_count> word_crc{};
+    uint32_t state = 1;
+    Words words{};
+    for (auto& word : words)
+        word = lcg(state);
+    uint32_t checksum = full_crc(words);
+
+    for (size_t round = 0; round < 200; round++) {
+        const size_t index = lcg(state) % word_count;
+        // Single bits as well as whole words.
+        const uint32_t new_word = (round & 1) ? lcg(state) : words[index] ^ (1U << (lcg(state) % 32));
+        checksum = word_crc.update(checksum, index, words[index], new_word);
+        words[index] = new_word;
+    }
+    CHECK(checksum == full_crc(words));
+}
+
+TEST_CASE("An unchanged word leaves the CRC alone.") {
+    const WordCRC32<word_count> word_crc{};
+    CHECK(word_crc.update(0x12345678, 7, 42, 42) == 0x12345678);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "work_tasks.hpp"
+
+#include <string>
+
+namespace {
+
+/* Runs the next queued task as a worker would. */
+bool run_next(WorkTasks& tasks, uint32_t start_ms, uint32_t finish_ms) {
+    auto task = tasks.start(start_ms);
+    if (!task)
+        return false;
+    task->work();
+    tasks.finish(*task, finish_ms);
+    return true;
+}
+
+/* Runs the 'done' of every finished task as the UI thread would. */
+size_t run_done(WorkTasks& tasks) {
+    size_t count = 0;
+    WorkTasks::Function done{};
+    while (tasks.take_finished(done)) {
+        if (done)
+            done();
+        count++;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Work tasks");
+
+TEST_CASE("Tasks run in the order they were posted.") {
+    WorkTasks tasks{};
+    std::string worked{};
+    std::string done{};
+    const int owner = 0;
+
+    for (const char c : std::string{"abcde"})
+        REQUIRE(tasks.post(&owner, [&worked, c]() { worked += c; }, [&done, c]() { done += c; }, 0));
+    CHECK(tasks.depth() == 5);
+
+    // Two workers: 'b' finishes before 'a', 'done' still runs in order.
+    auto a = tasks.start(1);
+    auto b = tasks.start(1);
+    REQUIRE(a);
+    REQUIRE(b);
+    b->work();
+    tasks.finish(*b, 2);
+    a->work();
+    tasks.finish(*a, 3);
+    while (run_next(tasks, 4, 5)) {
+    }
+
+    CHECK(worked == "bacde");
+    CHECK(run_done(tasks) == 5);
+    CHECK(done == "abcde");
+    CHECK(tasks.depth() == 0);
+    CHECK(tasks.stats().completed == 5);
+}
+
+TEST_CASE("A full table rejects tasks until one is done.") {
+    WorkTasks tasks{};
+    const int owner = 0;
+    for (size_t i = 0; i < WorkTasks::capacity; i++)
+        REQUIRE(tasks.post(&owner, []() {}, {}, 0));
+    CHECK_FALSE(tasks.post(&owner, []() {}, {}, 0));
+
+    // Finished tasks hold their slot until their 'done' was taken.
+    REQUIRE(run_next(tasks, 0, 0));
+    CHECK_FALSE(tasks.post(&owner, []() {}, {}, 0));
+    CHECK(run_done(tasks) == 1);
+    CHECK(tasks.post(&owner, []() {}, {}, 0));
+
+    CHECK(tasks.stats().posted == WorkTasks::capacity + 1);
+    CHECK(tasks.stats().rejected == 2);
+    CHECK(tasks.stats().max_depth == WorkTasks::capacity);
+}
+
+TEST_CASE("Cancel drops queued tasks and the 'done' of the others.") {
+    WorkTasks tasks{};
+    const int owner = 0;
+    const int other = 0;
+    int done = 0;
+    int other_done = 0;
+
+    REQUIRE(tasks.post(&owner, []() {}, [&done]() { done++; }, 0));  // Finished.
+    REQUIRE(tasks.post(&owner, []() {}, [&done]() { done++; }, 0));  // Running.
+    REQUIRE(tasks.post(&owner, []() { FAIL("cancelled task ran"); }, [&done]() { done++; }, 0));
+    REQUIRE(tasks.post(&other, []() {}, [&other_done]() { other_done++; }, 0));
+
+    REQUIRE(run_next(tasks, 0, 0));
+    auto running = tasks.start(0);
+    REQUIRE(running);
+    CHECK(tasks.running(&owner));
+    CHECK_FALSE(tasks.running(&other));
+
+    tasks.cancel(&owner);
+    CHECK(tasks.running(&owner));
+    CHECK(tasks.depth() == 2);
+
+    // Cancelling twice counts once.
+    tasks.cancel(&owner);
+    CHECK(tasks.stats().cancelled == 3);
+
+    tasks.finish(*running, 0);
+    CHECK_FALSE(tasks.running(&owner));
+    while (run_next(tasks, 0, 0)) {
+    }
+
+    CHECK(run_done(tasks) == 3);
+    CHECK(done == 0);
+    CHECK(other_done == 1);
+    CHECK(tasks.stats().completed == 1);
+    CHECK(tasks.depth() == 0);
+}
+
+TEST_CASE("Wait and run times.") {
+    WorkTasks tasks{};
+    const int owner = 0;
+    REQUIRE(tasks.post(&owner, []() {}, {}, 100));
+    REQUIRE(tasks.post(&owner, []() {}, {}, 110));
+
+    REQUIRE(run_next(tasks, 120, 150));  // Waited 20, ran 30.
+    REQUIRE(run_next(tasks, 150, 155));  // Waited 40, ran 5.
+    run_done(tasks);
+
+    const auto& stats = tasks.stats();
+    CHECK(stats.max_wait_ms == 40);
+    CHECK(stats.total_wait_ms == 60);
+    CHECK(stats.max_run_ms == 30);
+    CHECK(stats.total_run_ms == 35);
+    CHECK(stats.max_depth == 2);
+}
+
+TEST_SUITE_END();
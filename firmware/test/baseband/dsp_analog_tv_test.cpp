@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+#include "dsp_analog_tv.hpp"
+#include "doctest.h"
+
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace {
+
+constexpr size_t width = 120;
+constexpr size_t height = 180;
+using VideoSync = dsp::analog_tv::VideoSync<width, height>;
+
+constexpr float sync_tip = 1.0f;
+constexpr float blanking = 0.75f;
+constexpr float white = 0.125f;
+
+/* 0 black to 1 white at 'x' 0..1 across active line 'line' 0..286. */
+using Picture = std::function<float(size_t line, float x)>;
+
+/* PAL B/G as the envelope of the carrier, 1250 half lines a frame. Vertical
+ * sync starts at the start of line 0 and half way through line 312. */
+struct Transmitter {
+    Picture picture{};
+    double ppm{0.0};      // Line rate, fast.
+    double start{0.0};    // Into the frame, in samples.
+    float noise{0.0f};    // Peak, uniform.
+    float amplitude{1.0f};
+    uint32_t lcg{12345};
+
+    static bool in(const size_t h, const size_t first, const size_t last) {
+        return h >= first && h < last;
+    }
+
+    float level(const double t) const {
+        constexpr double frame = 2 * 625 * 64.0;
+        const double f = std::fmod(t, frame);
+        const size_t h = f / 64.0;
+        const double u = f - h * 64.0;
+        const size_t line = h / 2;
+        const double v = f - line * 128.0;
+
+        if (in(h, 0, 5) || in(h, 625, 630))
+            return (u < 54.6) ? sync_tip : blanking;
+        if (in(h, 5, 10) || in(h, 630, 635) || in(h, 620, 625) || in(h, 1245, 1250))
+            return (u < 4.7) ? sync_tip : blanking;
+        if (v < 9.4)
+            return sync_tip;
+
+        size_t active = 0;
+        if (line >= 23 && line < 310)
+            active = line - 23;
+        else if (line >= 335 && line < 622)
+            active = line - 335;
+        else
+            return blanking;
+        if (v < 21.0 || v >= 125.0)
+            return blanking;
+        return blanking - picture(active, (v - 21.0) / 104.0) * (blanking - white);
+    }
+
+    /* Sample n, averaged over the sample period. */
+    float operator()(const size_t n) {
+        constexpr size_t steps = 8;
+        float sum = 0.0f;
+        for (size_t k = 0; k < steps; k++)
+            sum += level((n + (k + 0.5) / steps) * (1.0 + ppm * 1e-6) + start);
+        lcg = lcg * 1664525 + 1013904223;
+        const float hiss = noise * ((lcg >> 8) / 16777216.0f - 0.5f) * 2.0f;
+        return std::max(amplitude * (sum / steps + hiss), 0.0f);
+    }
+};
+
+struct Field {
+    size_t sample;  // Handed over at.
+    VideoSync::Field info;
+    std::vector<uint8_t> pixels;
+};
+
+struct Receiver {
+    VideoSync sync{};
+    std::vector<uint8_t> buffer = std::vector<uint8_t>(width * height);
+    std::vector<Field> fields{};
+
+    void run(Transmitter& tx, const size_t first, const size_t count, const bool buffered = true) {
+        for (size_t n = first; n < first + count; n++) {
+            sync.set_field_buffer(buffered ? buffer.data() : nullptr);
+            sync.execute(tx(n), [&](const VideoSync::Field& field) {
+                fields.push_back({n, field, buffer});
+            });
+        }
+    }
+
+    /* Fields after the first few, while sync settles. */
+    std::vector<Field> settled() const {
+        return {fields.begin() + std::min<size_t>(3, fields.size()), fields.end()};
+    }
+};
+
+float vertical_bars(size_t, float x) {
+    return (x < 0.5f) ? 0.0f : 1.0f;
+}
+
+/* Column of the first pixel over half white. */
+size_t edge(const uint8_t* const row) {
+    size_t x = 0;
+    while (x < width && row[x] < 128)
+        x++;
+    return x;
+}
+
+/* Worst distance of the black to white edge of every row from the middle. */
+size_t edge_error(const Field& field) {
+    size_t worst = 0;
+    for (size_t y = 0; y < height; y++) {
+        const size_t x = edge(&field.pixels[y * width]);
+        worst = std::max(worst, (x > width / 2) ? x - width / 2 : width / 2 - x);
+    }
+    return worst;
+}
+
+constexpr size_t field_samples = 40000;
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Analog TV");
+
+TEST_CASE("Whole fields, one every 20ms") {
+    for (const double start : {0.0, 1234.5, 40000.0, 61111.1}) {
+        CAPTURE(start);
+        Transmitter tx{vertical_bars};
+        tx.start = start;
+        Receiver rx{};
+        rx.run(tx, 0, 25 * field_samples);
+        CHECK(rx.sync.line_locked());
+        CHECK(rx.sync.field_locked());
+
+        const auto fields = rx.settled();
+        REQUIRE(fields.size() >= 20);
+        for (size_t i = 0; i < fields.size(); i++) {
+            CAPTURE(i);
+            CHECK(fields[i].info.lines == height);
+            CHECK(fields[i].info.line_locked);
+            CHECK(fields[i].info.field_locked);
+            // 312 and 313 lines, in turn.
+            if (i > 0)
+                CHECK(std::abs(double(fields[i].sample) - double(fields[i - 1].sample) - field_samples) <= 65.0);
+        }
+    }
+}
+
+TEST_CASE("Pixels line up") {
+    SUBCASE("Columns") {
+        Transmitter tx{vertical_bars};
+        tx.start = 777.7;
+        Receiver rx{};
+        rx.run(tx, 0, 10 * field_samples);
+        for (const auto& field : rx.settled()) {
+            CHECK(edge_error(field) <= 1);
+            CHECK(field.pixels[10] < 16);
+            CHECK(field.pixels[width - 10] > 240);
+        }
+    }
+
+    SUBCASE("Rows") {
+        // Rows are active lines 287 / 180 apart.
+        Transmitter tx{[](size_t line, float) { return (line < 143) ? 1.0f : 0.0f; }};
+        Receiver rx{};
+        rx.run(tx, 0, 10 * field_samples);
+        for (const auto& field : rx.settled()) {
+            CHECK(field.pixels[89 * width + width / 2] > 240);
+            CHECK(field.pixels[90 * width + width / 2] < 16);
+        }
+    }
+}
+
+TEST_CASE("Lines follow the transmitter's clock") {
+    for (const double ppm : {-100.0, 100.0}) {
+        CAPTURE(ppm);
+        Transmitter tx{vertical_bars};
+        tx.ppm = ppm;
+        tx.amplitude = 0.3f;
+        Receiver rx{};
+        rx.run(tx, 0, 50 * field_samples);
+        const auto fields = rx.settled();
+        REQUIRE(fields.size() >= 45);
+        for (const auto& field : fields) {
+            CHECK(field.info.line_locked);
+            CHECK(edge_error(field) <= 1);
+        }
+    }
+}
+
+TEST_CASE("Noise") {
+    SUBCASE("A noisy signal still locks") {
+        Transmitter tx{vertical_bars};
+        tx.noise = 0.15f;
+        Receiver rx{};
+        rx.run(tx, 0, 20 * field_samples);
+        const auto fields = rx.settled();
+        REQUIRE(fields.size() >= 15);
+        for (const auto& field : fields) {
+            CHECK(field.info.line_locked);
+            CHECK(field.info.lines == height);
+            CHECK(edge_error(field) <= 3);
+        }
+    }
+
+    SUBCASE("Noise alone never does") {
+        VideoSync sync{};
+        std::vector<uint8_t> buffer(width * height);
+        uint32_t lcg = 1;
+        for (size_t n = 0; n < 10 * field_samples; n++) {
+            lcg = lcg * 1664525 + 1013904223;
+            sync.set_field_buffer(buffer.data());
+            sync.execute((lcg >> 8) / 16777216.0f, [&](const VideoSync::Field& field) {
+                CHECK_FALSE(field.line_locked);
+                CHECK_FALSE(field.field_locked);
+            });
+            REQUIRE_FALSE(sync.line_locked());
+        }
+        CHECK_FALSE(sync.field_locked());
+    }
+}
+
+TEST_CASE("Without a buffer, fields are skipped") {
+    Transmitter tx{vertical_bars};
+    Receiver rx{};
+    rx.run(tx, 0, 5 * field_samples + 15000, false);
+    CHECK(rx.fields.empty());
+
+    // Half way through a field: the next one is the first.
+    rx.run(tx, 5 * field_samples + 15000, 3 * field_samples);
+    REQUIRE(rx.fields.size() >= 2);
+    for (const auto& field : rx.fields) {
+        CHECK(field.sample > 6 * field_samples);
+        CHECK(field.info.lines == height);
+        CHECK(edge_error(field) <= 1);
+    }
+}
+
+TEST_SUITE_END();
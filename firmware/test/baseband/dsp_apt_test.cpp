@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "dsp_apt.hpp"
+#include "polyphase_resampler.hpp"
+#include "doctest.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using dsp::apt::LineSync;
+using dsp::apt::words_per_line;
+using Resampler = dsp::interpolation::PolyphaseResampler<52, 75>;
+
+constexpr uint32_t audio_rate = 12000;
+
+/* Word w of every line: syncs, spaces, a gradient for each image and grey
+ * telemetry, from 0 to 255. */
+uint8_t apt_word(const size_t w) {
+    constexpr uint8_t white = 230;
+    constexpr uint8_t black = 20;
+    if (w < 39)
+        return dsp::apt::sync_a_white(w) ? white : black;
+    if (w < 86)
+        return black;
+    if (w < 995)
+        return (w - 86) * 255 / 909;
+    if (w < 1040)
+        return 128;
+    if (w < 1079)
+        return dsp::apt::sync_b_white(w - 1040) ? white : black;
+    if (w < 1126)
+        return white;
+    if (w < 2035)
+        return 255 - (w - 1126) * 255 / 909;
+    return 128;
+}
+
+struct Result {
+    std::vector<std::vector<uint8_t>> lines{};
+    std::vector<bool> synced{};
+};
+
+/* APT at 12kHz as the envelope detector gives it: 'first_word' into a line,
+ * with the satellite clock 'ppm' fast, plus noise. Cut into lines. */
+Result decode(size_t lines, size_t first_word, double ppm, float noise = 0.0f) {
+    Resampler resampler{};
+    LineSync sync{};
+    Result result{};
+    std::vector<uint8_t> words(words_per_line);
+    uint32_t lcg = 12345;
+
+    const size_t samples = lines * audio_rate / 2;
+    for (size_t n = 0; n < samples; n++) {
+        const size_t word = first_word + size_t(n * 4160.0 * (1.0 + ppm * 1e-6) / audio_rate);
+        float sample = apt_word(word % words_per_line) / 255.0f;
+        lcg = lcg * 1664525 + 1013904223;
+        sample += noise * ((lcg >> 8) / 16777216.0f - 0.5f) * 2.0f;
+
+        resampler(sample, [&](const float v) {
+            const uint8_t level = (v >= 1.0f) ? 255 : (v <= 0.0f) ? 0 : uint8_t(v * 255.0f);
+            sync.set_line_buffer(words.data());
+            sync.execute(level, [&](const LineSync::Line& line) {
+                result.lines.emplace_back(line.words, line.words + words_per_line);
+                result.synced.push_back(line.synced);
+            });
+        });
+    }
+    return result;
+}
+
+/* How many words the line is off, -8..8, by the best match with the
+ * reference line. */
+int offset(const std::vector<uint8_t>& line) {
+    int best = 0;
+    double best_error = 1e30;
+    for (int shift = -8; shift <= 8; shift++) {
+        double error = 0.0;
+        for (size_t w = 8; w < words_per_line - 8; w++)
+            error += std::abs(int(line[w + shift]) - int(apt_word(w)));
+        if (error < best_error) {
+            best_error = error;
+            best = shift;
+        }
+    }
+    return best;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("NOAA APT");
+
+TEST_CASE("The resampler keeps a tone") {
+    for (const double frequency : {300.0, 1000.0, 2080.0}) {
+        CAPTURE(frequency);
+        Resampler resampler{};
+        std::vector<float> out{};
+        for (size_t n = 0; n < audio_rate; n++)
+            resampler(std::sin(2.0 * M_PI * frequency * n / audio_rate), [&](float v) { out.push_back(v); });
+        CHECK(out.size() == dsp::apt::sample_rate);
+
+        // Linear phase: delayed by half the filter, at the upsampled rate.
+        const double delay = (52 * 8 - 1) / 2.0 / (audio_rate * 52.0);
+        double max_error = 0.0;
+        for (size_t j = 100; j < out.size(); j++) {
+            const double t = double(j) / dsp::apt::sample_rate - delay;
+            max_error = std::max(max_error, std::abs(out[j] - std::sin(2.0 * M_PI * frequency * t)));
+        }
+        // Words alternating black and white droop a little.
+        CHECK(max_error < (frequency < 2000.0 ? 0.01 : 0.1));
+    }
+}
+
+TEST_CASE("Lines start on sync A") {
+    for (const size_t first_word : {0u, 17u, 1040u, 1500u, 2079u}) {
+        CAPTURE(first_word);
+        const auto result = decode(10, first_word, 0.0);
+        REQUIRE(result.lines.size() >= 8);
+        CHECK(result.synced.front());
+        for (const auto& line : result.lines)
+            CHECK(offset(line) == 0);
+    }
+}
+
+TEST_CASE("Lines follow a drifting clock") {
+    // 200ppm drifts 0.4 words a line, 40 over the pass.
+    for (const double ppm : {-200.0, 200.0}) {
+        CAPTURE(ppm);
+        const auto result = decode(100, 600, ppm);
+        REQUIRE(result.lines.size() >= 95);
+        size_t synced = 0;
+        for (size_t i = 0; i < result.lines.size(); i++) {
+            CAPTURE(i);
+            CHECK(std::abs(offset(result.lines[i])) <= 1);
+            synced += result.synced[i] ? 1 : 0;
+        }
+        CHECK(synced == result.lines.size());
+    }
+}
+
+TEST_CASE("Noise") {
+    SUBCASE("A noisy signal still locks") {
+        const auto result = decode(20, 300, 50.0, 0.6f);
+        REQUIRE(result.lines.size() >= 17);
+        size_t synced = 0;
+        for (size_t i = 0; i < result.lines.size(); i++)
+            synced += result.synced[i] ? 1 : 0;
+        CHECK(synced >= result.lines.size() * 3 / 4);
+        CHECK(std::abs(offset(result.lines.back())) <= 1);
+    }
+
+    SUBCASE("Noise alone never does") {
+        Resampler resampler{};
+        LineSync sync{};
+        uint32_t lcg = 1;
+        size_t lines = 0;
+        for (size_t n = 0; n < 10 * audio_rate; n++) {
+            lcg = lcg * 1664525 + 1013904223;
+            resampler((lcg >> 8) / 16777216.0f, [&](const float v) {
+                sync.execute(uint8_t(std::min(std::max(v, 0.0f), 1.0f) * 255.0f), [&](const LineSync::Line&) { lines++; });
+            });
+        }
+        CHECK_FALSE(sync.locked());
+        CHECK(lines == 0);
+    }
+}
+
+TEST_SUITE_END();
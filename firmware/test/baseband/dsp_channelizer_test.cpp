@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "dsp_channelizer.hpp"
+#include "doctest.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr size_t channel_count = 64;
+using Channelizer = dsp::channelizer::PolyphaseChannelizer<channel_count>;
+
+/* Tone at 'cycles' per sample, amplitude 100. */
+std::vector<complex8_t> tone(double cycles, size_t count) {
+    std::vector<complex8_t> samples{};
+    for (size_t n = 0; n < count; n++) {
+        const double phase = 2.0 * M_PI * cycles * n;
+        samples.push_back({int8_t(std::lround(100 * std::cos(phase))), int8_t(std::lround(100 * std::sin(phase)))});
+    }
+    return samples;
+}
+
+/* Average power per channel over all blocks but the first few, while the
+ * filter history fills up. */
+std::vector<double> channel_power(std::vector<complex8_t> samples) {
+    Channelizer channelizer{};
+    Channelizer::Channels out{};
+    std::vector<double> power(channel_count, 0.0);
+    size_t blocks = 0;
+
+    channelizer.execute(buffer_c8_t{samples.data(), samples.size(), 0}, [&]() {
+        if (++blocks <= Channelizer::taps_per_branch)
+            return;
+        channelizer.analyze(out);
+        for (size_t c = 0; c < channel_count; c++)
+            power[c] += std::norm(out[c]);
+    });
+    return power;
+}
+
+double db(double power_ratio) {
+    return 10.0 * std::log10(power_ratio);
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Polyphase channelizer");
+
+TEST_CASE("analyze() matches channel() for every channel") {
+    auto samples = tone(3.3 / channel_count, 16 * channel_count);
+    const auto noise = tone(-17.8 / channel_count, samples.size());
+    for (size_t n = 0; n < samples.size(); n++)
+        samples[n] = {int8_t(samples[n].real() / 2 + noise[n].real() / 2), int8_t(samples[n].imag() / 2 + noise[n].imag() / 2)};
+
+    Channelizer channelizer{};
+    Channelizer::Channels out{};
+    size_t blocks = 0;
+    channelizer.execute(buffer_c8_t{samples.data(), samples.size(), 0}, [&]() {
+        blocks++;
+        channelizer.analyze(out);
+        for (size_t c = 0; c < channel_count; c++) {
+            const auto expected = channelizer.channel(c);
+            CHECK(std::abs(out[c] - expected) <= 1e-3f * (1.0f + std::abs(expected)));
+        }
+    });
+    CHECK(blocks == 16);
+}
+
+TEST_CASE("A carrier on a channel center lands in that channel only") {
+    for (const int channel : {0, 5, -9, 31}) {
+        CAPTURE(channel);
+        const size_t index = channel & (channel_count - 1);
+        const auto power = channel_power(tone(double(channel) / channel_count, 64 * channel_count));
+
+        // Unity gain: a 100 amplitude carrier comes out at 100.
+        const double blocks = 64 - Channelizer::taps_per_branch;
+        CHECK(std::sqrt(power[index] / blocks) == doctest::Approx(100.0).epsilon(0.02));
+
+        for (size_t c = 0; c < channel_count; c++) {
+            if (c == index) continue;
+            const size_t distance = std::min((c - index) & (channel_count - 1), (index - c) & (channel_count - 1));
+            CAPTURE(c);
+            // Next door channels overlap a little at their edges. Further
+            // out, the spurs of the 8 bit input dominate.
+            CHECK(db(power[c] / power[index]) < (distance == 1 ? -30.0 : -45.0));
+        }
+    }
+}
+
+TEST_CASE("A carrier between two channels shows in both") {
+    const auto power = channel_power(tone(6.5 / channel_count, 64 * channel_count));
+    CHECK(db(power[6] / power[7]) == doctest::Approx(0.0).epsilon(0.5));
+    CHECK(db(power[6] / power[8]) > 20.0);
+}
+
+TEST_SUITE_END();
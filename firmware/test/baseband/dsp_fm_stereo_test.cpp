@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "dsp_fm_stereo.hpp"
+#include "doctest.h"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+constexpr uint32_t fs = 192000;
+constexpr size_t block_size = 128;
+constexpr double two_pi = 2.0 * M_PI;
+
+/* Builds a broadcast MPX block: 45% L+R, 45% L-R on 38kHz, 10% pilot. */
+struct MPXGenerator {
+    double pilot_hz = 19000.0;
+    double pilot_phase0 = 0.7;
+    double pilot_amplitude = 0.1;
+    double left_amplitude = 0.0;
+    double right_amplitude = 0.0;
+    double tone_hz = 1000.0;
+    size_t n = 0;
+
+    void fill(std::array<int16_t, block_size>& block) {
+        for (auto& sample : block) {
+            const double t = double(n++) / fs;
+            const double tone = std::sin(two_pi * tone_hz * t);
+            const double l = left_amplitude * tone;
+            const double r = right_amplitude * tone;
+            const double pilot_phase = two_pi * pilot_hz * t + pilot_phase0;
+            const double mpx = 0.45 * (l + r) +
+                               0.45 * (l - r) * std::sin(2.0 * pilot_phase) +
+                               pilot_amplitude * std::sin(pilot_phase);
+            sample = std::lround(mpx * 32767.0);
+        }
+    }
+};
+
+/* Amplitude of the component at tone_hz (signed, relative to sin phase 0). */
+struct ToneProjector {
+    double tone_hz = 1000.0;
+    double sin_acc = 0.0;
+    double cos_acc = 0.0;
+    size_t count = 0;
+
+    void feed(const std::array<int16_t, block_size>& block, size_t first_n) {
+        for (size_t i = 0; i < block.size(); i++) {
+            const double t = double(first_n + i) / fs;
+            sin_acc += block[i] * std::sin(two_pi * tone_hz * t);
+            cos_acc += block[i] * std::cos(two_pi * tone_hz * t);
+            count++;
+        }
+    }
+
+    double in_phase() const { return 2.0 * sin_acc / count / 32767.0; }
+    double quadrature() const { return 2.0 * cos_acc / count / 32767.0; }
+};
+
+/* Runs the decoder for the given number of blocks and projects the
+ * L-R output of the last quarter onto the test tone. */
+ToneProjector run(dsp::demodulate::FMStereo& stereo, MPXGenerator& gen, size_t blocks) {
+    std::array<int16_t, block_size> in{};
+    std::array<int16_t, block_size> out{};
+    ToneProjector projector{};
+
+    for (size_t b = 0; b < blocks; b++) {
+        const auto first_n = gen.n;
+        gen.fill(in);
+        stereo.execute({in.data(), in.size(), fs}, {out.data(), out.size(), fs});
+        if (b >= blocks - blocks / 4) {
+            projector.feed(out, first_n);
+        }
+    }
+    return projector;
+}
+
+}  // namespace
+
+TEST_CASE("FMStereo locks to pilot and recovers L-R for a left only tone") {
+    dsp::demodulate::FMStereo stereo{};
+    stereo.configure(fs);
+
+    MPXGenerator gen{};
+    gen.left_amplitude = 1.0;
+
+    // 1.5 seconds
+    const auto projector = run(stereo, gen, 2250);
+
+    CHECK(stereo.pilot_locked());
+    CHECK(stereo.pilot_level() == doctest::Approx(0.1).epsilon(0.1));
+    // L-R = L, scaled by 0.45 in the MPX and halved by the decoder.
+    CHECK(projector.in_phase() == doctest::Approx(0.225).epsilon(0.05));
+    CHECK(std::fabs(projector.quadrature()) < 0.02);
+}
+
+TEST_CASE("FMStereo recovers negative L-R for a right only tone") {
+    dsp::demodulate::FMStereo stereo{};
+    stereo.configure(fs);
+
+    MPXGenerator gen{};
+    gen.right_amplitude = 1.0;
+
+    const auto projector = run(stereo, gen, 2250);
+
+    CHECK(stereo.pilot_locked());
+    CHECK(projector.in_phase() == doctest::Approx(-0.225).epsilon(0.05));
+}
+
+TEST_CASE("FMStereo tracks a pilot that is slightly off frequency") {
+    dsp::demodulate::FMStereo stereo{};
+    stereo.configure(fs);
+
+    MPXGenerator gen{};
+    gen.pilot_hz = 19004.0;
+    gen.left_amplitude = 1.0;
+
+    const auto projector = run(stereo, gen, 3000);
+
+    CHECK(stereo.pilot_locked());
+    CHECK(projector.in_phase() == doctest::Approx(0.225).epsilon(0.05));
+}
+
+TEST_CASE("FMStereo does not lock without a pilot") {
+    dsp::demodulate::FMStereo stereo{};
+    stereo.configure(fs);
+
+    MPXGenerator gen{};
+    gen.pilot_amplitude = 0.0;
+    gen.left_amplitude = 1.0;
+
+    run(stereo, gen, 1500);
+
+    CHECK_FALSE(stereo.pilot_locked());
+}
+
+TEST_CASE("FMStereo matrix produces left and right, or mono when unlocked") {
+    dsp::demodulate::FMStereo stereo{};
+    stereo.configure(fs);
+
+    std::array<int16_t, 4> sum{1000, -1000, 30000, 0};
+    std::array<int16_t, 4> diff{250, 250, 5000, 0};
+
+    // Unlocked: right mirrors mono.
+    stereo.matrix({sum.data(), sum.size()}, {diff.data(), diff.size()});
+    CHECK(sum[0] == 1000);
+    CHECK(diff[0] == 1000);
+    CHECK(diff[2] == 30000);
+
+    MPXGenerator gen{};
+    run(stereo, gen, 1500);
+    REQUIRE(stereo.pilot_locked());
+
+    sum = {1000, -1000, 30000, 0};
+    diff = {250, 250, 5000, 0};
+    stereo.matrix({sum.data(), sum.size()}, {diff.data(), diff.size()});
+    CHECK(sum[0] == 1500);
+    CHECK(diff[0] == 500);
+    CHECK(sum[1] == -500);
+    CHECK(diff[1] == -1500);
+    CHECK(sum[2] == 32767);  // saturated
+    CHECK(diff[2] == 20000);
+}
+
+TEST_CASE("FMStereo per buffer cost") {
+    /* Host-side reference only: reports time per 128 sample (one baseband
+     * buffer at 192kHz) block so changes to the inner loop can be compared.
+     * On target, check the M4 load with the debug performance counter. */
+    dsp::demodulate::FMStereo stereo{};
+    stereo.configure(fs);
+
+    MPXGenerator gen{};
+    gen.left_amplitude = 1.0;
+    std::array<int16_t, block_size> in{};
+    std::array<int16_t, block_size> out{};
+    gen.fill(in);
+
+    constexpr size_t iterations = 20000;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        stereo.execute({in.data(), in.size(), fs}, {out.data(), out.size(), fs});
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto ns_per_block = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / iterations;
+
+    MESSAGE("FMStereo::execute: " << ns_per_block << " ns per 128 sample block");
+    CHECK(ns_per_block > 0);
+}
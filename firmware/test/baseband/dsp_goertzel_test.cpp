@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "dsp_goertzel.hpp"
+#include "tonesets.hpp"
+#include "doctest.h"
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t ctcss_rate = 1500;
+constexpr size_t ctcss_block = 200;
+using CTCSSBank = dsp::GoertzelBank<ctcss_tones.size()>;
+
+std::array<float, ctcss_tones.size()> ctcss_frequencies() {
+    std::array<float, ctcss_tones.size()> frequencies{};
+    for (size_t i = 0; i < ctcss_tones.size(); i++)
+        frequencies[i] = ctcss_tones[i] / 100.0f;
+    return frequencies;
+}
+
+void add_tone(std::vector<float>& samples, double frequency, uint32_t rate, float amplitude, size_t first = 0) {
+    for (size_t n = first; n < samples.size(); n++)
+        samples[n] += amplitude * std::sin(2.0 * M_PI * frequency * n / rate);
+}
+
+/* A voice around 'pitch' Hz: the fundamental wanders by +-15%, with a
+ * weaker second harmonic. */
+void add_speech(std::vector<float>& samples, double pitch, uint32_t rate, float amplitude) {
+    double phase = 0.0;
+    for (size_t n = 0; n < samples.size(); n++) {
+        const double f = pitch * (1.0 + 0.15 * std::sin(2.0 * M_PI * 3.1 * n / rate));
+        phase += 2.0 * M_PI * f / rate;
+        samples[n] += amplitude * (std::sin(phase) + 0.5f * std::sin(2.0 * phase + 1.0));
+    }
+}
+
+void add_noise(std::vector<float>& samples, float amplitude) {
+    uint32_t seed = 1;
+    for (auto& sample : samples) {
+        seed = seed * 1664525 + 1013904223;
+        sample += amplitude * (int32_t(seed) / 2147483648.0f);
+    }
+}
+
+/* best() of every window. */
+template <size_t N, size_t Blocks>
+std::vector<typename dsp::GoertzelBank<N, Blocks>::Detection> detections(dsp::GoertzelBank<N, Blocks>& bank, std::vector<float> samples) {
+    std::vector<typename dsp::GoertzelBank<N, Blocks>::Detection> result{};
+    bank.execute(buffer_f32_t{samples.data(), samples.size(), 0}, [&]() {
+        result.push_back(bank.best());
+    });
+    return result;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Goertzel bank");
+
+TEST_CASE("Matches the DFT over the window") {
+    constexpr std::array<float, 3> frequencies{100.0f, 123.4f, 250.3f};
+    dsp::GoertzelBank<3> bank{frequencies, ctcss_rate, 50};
+
+    std::vector<float> samples(330, 0.0f);
+    add_noise(samples, 1.0f);
+    add_tone(samples, 123.4, ctcss_rate, 0.5f);
+
+    size_t windows = 0;
+    bank.execute(buffer_f32_t{samples.data(), samples.size(), 0}, [&]() {
+        windows++;
+        const size_t end = (windows + 3) * 50;
+        double energy = 0.0;
+        for (size_t n = end - 200; n < end; n++)
+            energy += samples[n] * samples[n];
+        for (size_t i = 0; i < frequencies.size(); i++) {
+            std::complex<double> bin{};
+            for (size_t n = end - 200; n < end; n++)
+                bin += double(samples[n]) * std::polar(1.0, -2.0 * M_PI * frequencies[i] * n / ctcss_rate);
+            CHECK(bank.confidence(i) == doctest::Approx(2.0 * std::norm(bin) / (200 * energy)).epsilon(1e-3));
+        }
+    });
+    CHECK(windows == 3);
+}
+
+TEST_CASE("Every CTCSS tone is found, not its neighbours") {
+    CTCSSBank bank{ctcss_frequencies(), ctcss_rate, ctcss_block};
+    for (size_t i = 0; i < ctcss_tones.size(); i++) {
+        CAPTURE(ctcss_tones[i]);
+        std::vector<float> samples(ctcss_rate, 0.0f);
+        add_noise(samples, 0.05f);
+        add_tone(samples, ctcss_tones[i] / 100.0, ctcss_rate, 0.5f);
+
+        bank.reset();
+        for (const auto detection : detections(bank, samples)) {
+            CHECK(detection.index == i);
+            CHECK(detection.confidence > 0.9f);
+            if (i > 0) CHECK(bank.confidence(i - 1) < 0.1f);
+            if (i + 1 < ctcss_tones.size()) CHECK(bank.confidence(i + 1) < 0.1f);
+        }
+    }
+}
+
+TEST_CASE("Speech alone is not a tone, a tone under speech is") {
+    CTCSSBank bank{ctcss_frequencies(), ctcss_rate, ctcss_block};
+    for (const double pitch : {110.0, 150.0, 210.0}) {
+        CAPTURE(pitch);
+        std::vector<float> speech(3 * ctcss_rate, 0.0f);
+        add_speech(speech, pitch, ctcss_rate, 0.5f);
+        add_noise(speech, 0.05f);
+
+        bank.reset();
+        for (const auto detection : detections(bank, speech))
+            CHECK(detection.confidence < 0.25f);
+
+        auto keyed = speech;
+        add_tone(keyed, 88.5, ctcss_rate, 0.4f);
+        bank.reset();
+        for (const auto detection : detections(bank, keyed)) {
+            CHECK(detection.index == 8);
+            CHECK(detection.confidence > 0.25f);
+        }
+    }
+}
+
+TEST_CASE("The window slides one block at a time") {
+    CTCSSBank bank{ctcss_frequencies(), ctcss_rate, ctcss_block};
+    std::vector<float> samples(2 * ctcss_rate, 0.0f);
+    add_tone(samples, 100.0, ctcss_rate, 0.5f);
+    std::fill(samples.begin() + ctcss_rate, samples.end(), 0.0f);
+    add_tone(samples, 131.8, ctcss_rate, 0.5f, ctcss_rate);
+
+    // Windows end every 200 samples from sample 800 on; the tone changes
+    // at 1500, so the first window all on the new tone ends at 2400.
+    const auto found = detections(bank, samples);
+    REQUIRE(found.size() == 12);
+    for (size_t w = 0; w < found.size(); w++) {
+        CAPTURE(w);
+        const size_t end = 800 + 200 * w;
+        if (end <= ctcss_rate) {
+            CHECK(found[w].index == 12);
+            CHECK(found[w].confidence > 0.9f);
+        } else if (end >= ctcss_rate + 800) {
+            CHECK(found[w].index == 20);
+            CHECK(found[w].confidence > 0.9f);
+        } else {
+            CHECK(found[w].confidence < 0.9f);
+        }
+    }
+}
+
+TEST_CASE("DTMF keys") {
+    constexpr uint32_t rate = 8000;
+    const char* const keys = "0123456789ABCD#*";
+    for (size_t k = 0; k < 16; k++) {
+        CAPTURE(keys[k]);
+        const auto row_column = dtmf_deltas[k];
+        std::vector<float> samples(rate / 10, 0.0f);
+        add_noise(samples, 0.05f);
+        add_tone(samples, row_column[1] / double(TONES_DELTA_COEF(TONES_SAMPLERATE)), rate, 0.3f);
+        add_tone(samples, row_column[0] / double(TONES_DELTA_COEF(TONES_SAMPLERATE)), rate, 0.4f);
+
+        dsp::GoertzelBank<8> bank{dsp::dtmf_frequencies, rate, 100};
+        size_t windows = 0;
+        bank.execute(buffer_f32_t{samples.data(), samples.size(), 0}, [&]() {
+            windows++;
+            CHECK(dsp::dtmf_key(bank) == keys[k]);
+        });
+        CHECK(windows == 5);
+    }
+
+    // A single tone or a too weak column is not a key.
+    for (const float column_amplitude : {0.0f, 0.1f}) {
+        std::vector<float> samples(rate / 10, 0.0f);
+        add_tone(samples, 770.0, rate, 0.5f);
+        add_tone(samples, 1336.0, rate, column_amplitude);
+        dsp::GoertzelBank<8> bank{dsp::dtmf_frequencies, rate, 100};
+        bank.execute(buffer_f32_t{samples.data(), samples.size(), 0}, [&]() {
+            CHECK(dsp::dtmf_key(bank) == 0);
+        });
+    }
+}
+
+TEST_CASE("Benchmark") {
+    CTCSSBank bank{ctcss_frequencies(), ctcss_rate, ctcss_block};
+    std::vector<float> samples(60 * ctcss_rate, 0.0f);
+    add_tone(samples, 151.4, ctcss_rate, 0.5f);
+
+    size_t found = 0;
+    const auto start = std::chrono::steady_clock::now();
+    bank.execute(buffer_f32_t{samples.data(), samples.size(), 0}, [&]() {
+        found += bank.best().index == 24;
+    });
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    CHECK(found == samples.size() / ctcss_block - 3);
+    MESSAGE("50 CTCSS tones, 1 minute of audio at 1.5kHz: " << us << " us on the host, "
+                                                            << ctcss_tones.size() << " multiplies per sample");
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "dsp_iir.hpp"
+#include "dsp_iir_config.hpp"
+#include "doctest.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+
+/* Double precision Direct Form I reference. */
+struct ReferenceBiquad {
+    const iir_biquad_config_t& config;
+    double x1{0}, x2{0}, y1{0}, y2{0};
+
+    double execute(double x) {
+        const double y = config.b[0] * x + config.b[1] * x1 + config.b[2] * x2 - config.a[1] * y1 - config.a[2] * y2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+        return y;
+    }
+};
+
+struct Errors {
+    double fixed{0};
+    double single{0};
+};
+
+/* Runs the same int16_t signal through the fixed point and float biquads
+ * and returns their largest deviation from a double precision reference,
+ * in int16_t LSBs. */
+template <typename Signal>
+Errors max_errors(const iir_biquad_config_t& config, size_t count, Signal signal) {
+    ReferenceBiquad reference{config};
+    IIRBiquadFilter single{config};
+    IIRBiquadFixedFilter fixed{config};
+    constexpr int32_t shift = IIRBiquadFixedFilter::sample_shift;
+
+    Errors errors{};
+    for (size_t n = 0; n < count; n++) {
+        const int16_t x = signal(n);
+        const double expected = reference.execute(x);
+        const double actual_fixed = fixed.execute(x << shift) / double(1 << shift);
+        const double actual_single = single.execute(x / 32768.0f) * 32768.0;
+        errors.fixed = std::max(errors.fixed, std::fabs(expected - actual_fixed));
+        errors.single = std::max(errors.single, std::fabs(expected - actual_single));
+    }
+    return errors;
+}
+
+int16_t tone(size_t n, float hz, float fs, float amplitude) {
+    return amplitude * std::sin(2.0 * M_PI * hz * n / fs);
+}
+
+}  // namespace
+
+TEST_CASE("IIRBiquadFixedFilter tracks reference for 300Hz HPF at 24kHz") {
+    const auto errors = max_errors(audio_24k_hpf_300hz_config, 24000, [](size_t n) {
+        return static_cast<int16_t>(tone(n, 1000, 24000, 20000) + tone(n, 50, 24000, 8000));
+    });
+    CHECK(errors.fixed < 1.0);
+}
+
+TEST_CASE("IIRBiquadFixedFilter tracks reference for first order de-emphasis") {
+    const auto errors = max_errors(audio_24k_deemph_300_6_config, 24000, [](size_t n) {
+        return static_cast<int16_t>(tone(n, 3000, 24000, 30000));
+    });
+    CHECK(errors.fixed < 1.0);
+}
+
+TEST_CASE("IIRBiquadFixedFilter tracks reference for 30Hz HPF at 48kHz") {
+    // Poles very close to the unit circle; this is the hard case for both variants.
+    const auto errors = max_errors(audio_48k_hpf_30hz_config, 48000, [](size_t n) {
+        return static_cast<int16_t>(tone(n, 440, 48000, 16000) + 4000);
+    });
+    MESSAGE("30Hz HPF max error, fixed: " << errors.fixed << " LSB, float: " << errors.single << " LSB");
+    CHECK(errors.fixed < 2.0);
+}
+
+TEST_CASE("IIRBiquadFixedFilter HPF settles to zero on DC input") {
+    IIRBiquadFixedFilter fixed{audio_48k_hpf_30hz_config};
+    constexpr int32_t shift = IIRBiquadFixedFilter::sample_shift;
+
+    int32_t out = 0;
+    for (size_t n = 0; n < 48000; n++) {
+        out = fixed.execute(12345 << shift) >> shift;
+    }
+    CHECK(std::abs(out) <= 1);
+}
+
+TEST_CASE("IIRBiquadFixedFilter passthrough and reset") {
+    IIRBiquadFixedFilter fixed{iir_config_passthrough};
+    constexpr int32_t shift = IIRBiquadFixedFilter::sample_shift;
+
+    CHECK((fixed.execute(-32768 << shift) >> shift) == -32768);
+    CHECK((fixed.execute(32767 << shift) >> shift) == 32767);
+
+    fixed.configure(audio_24k_deemph_300_6_config);
+    fixed.execute(30000 << shift);
+    fixed.reset();
+    CHECK(fixed.execute(0) == 0);
+}
+
+TEST_CASE("IIRBiquadFilter single sample step matches block execute") {
+    IIRBiquadFilter block{audio_24k_hpf_300hz_config};
+    IIRBiquadFilter step{audio_24k_hpf_300hz_config};
+
+    std::array<float, 32> samples{};
+    for (size_t n = 0; n < samples.size(); n++) {
+        samples[n] = std::sin(n * 0.3f);
+    }
+    std::array<float, 32> expected = samples;
+    block.execute_in_place({expected.data(), expected.size()});
+
+    for (size_t n = 0; n < samples.size(); n++) {
+        CHECK(step.execute(samples[n]) == doctest::Approx(expected[n]));
+    }
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "fproto_harness.hpp"
+#include "doctest.h"
+
+#include <sstream>
+
+using namespace fproto_harness;
+
+namespace {
+
+/* Princeton (PT2262 style) frames: 24 bits, te = 390us. */
+void add_princeton(PulseStream& stream, uint32_t code, size_t repeats) {
+    constexpr uint32_t te = 390;
+    for (size_t r = 0; r < repeats; ++r) {
+        stream.push_back({false, te * 36});
+        for (int8_t bit = 23; bit >= 0; --bit) {
+            const bool one = (code >> bit) & 1;
+            stream.push_back({true, one ? te * 3 : te});
+            stream.push_back({false, one ? te : te * 3});
+        }
+        stream.push_back({true, te});
+    }
+    // Trailing gap completes the last frame.
+    stream.push_back({false, te * 36});
+}
+
+/* Random OOK-ish junk, mostly short pulses with the odd long gap. */
+void add_noise(PulseStream& stream, size_t edges, uint32_t seed) {
+    // xorshift32, deterministic across hosts.
+    uint32_t state = seed * 2654435761u + 1;
+    auto next = [&state](uint32_t lo, uint32_t hi) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return lo + state % (hi - lo + 1);
+    };
+
+    bool level = true;
+    for (size_t n = 0; n < edges; ++n) {
+        const bool gap = next(0, 19) == 0;
+        stream.push_back({level, gap ? next(2500, 30000) : next(50, 2500)});
+        level = !level;
+    }
+}
+
+PulseStream mixed_stream() {
+    PulseStream stream{};
+    add_noise(stream, 5000, 1);
+    add_princeton(stream, 0xA5C3F0, 4);
+    add_noise(stream, 5000, 2);
+    add_princeton(stream, 0x123456, 3);
+    add_noise(stream, 5000, 3);
+    return stream;
+}
+
+size_t count(const std::vector<Decode>& decodes, uint8_t sensor_type, uint64_t data) {
+    size_t n = 0;
+    for (const auto& d : decodes)
+        n += (d.sensor_type == sensor_type && d.data == data) ? 1 : 0;
+    return n;
+}
+
+}  // namespace
+
+TEST_CASE("FProtoEdgeBatch classifies durations into log2 buckets") {
+    CHECK(FProtoEdgeBatch::bucket(0) == 0);
+    CHECK(FProtoEdgeBatch::bucket(1) == 0);
+    CHECK(FProtoEdgeBatch::bucket(390) == 8);
+    CHECK(FProtoEdgeBatch::bucket(1023) == 9);
+    CHECK(FProtoEdgeBatch::bucket(1024) == 10);
+    CHECK(FProtoEdgeBatch::bucket(30000) == 14);
+
+    FProtoEdgeBatch batch{};
+    for (size_t n = 0; n + 1 < FProtoEdgeBatch::capacity; ++n)
+        CHECK_FALSE(batch.push(n & 1, n));
+    CHECK(batch.push(true, 1));
+    CHECK(batch.size() == FProtoEdgeBatch::capacity);
+}
+
+TEST_CASE("FProtoStartEnvelope covers the window it was given") {
+    FProtoStartEnvelope envelope{};
+    auto edge = [](bool level, uint32_t duration) {
+        return FProtoEdge{duration, level, FProtoEdgeBatch::bucket(duration)};
+    };
+
+    // Default: everything.
+    CHECK(envelope.matches(edge(true, 10)));
+    CHECK(envelope.matches(edge(false, 100000)));
+
+    // Princeton preamble window: low, 14040 +/- 10800.
+    envelope.set(false, 390 * 36, 300 * 36);
+    for (uint32_t d = 3241; d < 24840; d += 7)
+        REQUIRE(envelope.matches(edge(false, d)));
+    CHECK_FALSE(envelope.matches(edge(true, 14040)));
+    CHECK_FALSE(envelope.matches(edge(false, 390)));
+    CHECK_FALSE(envelope.matches(edge(false, 1170)));
+
+    envelope.set_min(true, 3000);
+    CHECK(envelope.matches(edge(true, 14040)));
+    CHECK(envelope.matches(edge(true, UINT32_MAX)));
+    CHECK_FALSE(envelope.matches(edge(true, 390)));
+}
+
+TEST_CASE("SubGhzDProtos batched dispatch decodes exactly like per edge feed") {
+    const auto stream = mixed_stream();
+
+    SubGhzDProtos per_edge{};
+    SubGhzDProtos batched{};
+    const auto expected = feed_per_edge(per_edge, stream);
+    const auto actual = feed_batched(batched, stream);
+
+    CHECK(count(expected, FPS_PRINCETON, 0xA5C3F0) >= 3);
+    CHECK(count(expected, FPS_PRINCETON, 0x123456) >= 2);
+    CHECK(actual == expected);
+}
+
+TEST_CASE("WeatherProtos batched dispatch decodes exactly like per edge feed") {
+    const auto stream = mixed_stream();
+
+    WeatherProtos per_edge{};
+    WeatherProtos batched{};
+    CHECK(feed_batched(batched, stream, 64) == feed_per_edge(per_edge, stream));
+}
+
+template <typename List>
+std::string cost_report(const List& list, uint8_t count, const PulseStream& stream) {
+    FProtoEdgeBatch batch{};
+    std::ostringstream out{};
+    double total_ns = 0;
+
+    for (uint8_t i = 0; i < count; ++i) {
+        auto proto = list.proto(i);
+        if (!proto) continue;
+
+        // How often the dispatcher actually calls this decoder.
+        size_t woken = 0;
+        for (const auto& pulse : stream) {
+            batch.clear();
+            batch.push(pulse.level, pulse.duration);
+            if (proto->wakes_on(batch[0])) ++woken;
+            proto->feed(pulse.level, pulse.duration);
+        }
+
+        const auto ns = ns_per_edge(*proto, stream);
+        total_ns += ns;
+        out << "  #" << int(i) << ": " << ns << " ns/edge, woken for "
+            << (100.0 * woken / stream.size()) << "% of edges\n";
+    }
+    out << "  all decoders: " << total_ns << " ns/edge\n";
+    return out.str();
+}
+
+TEST_CASE("fproto per decoder cost") {
+    /* Host-side reference only, like the other cost cases: reports the
+     * per-edge cost of each decoder and how often the dispatcher wakes it
+     * on a noisy stream. Compare before/after when touching a decoder. */
+    PulseStream stream{};
+    add_noise(stream, 20000, 7);
+
+    SubGhzDProtos subghzd{};
+    WeatherProtos weather{};
+    MESSAGE("SubGhzD decoders:\n" << cost_report(subghzd, FPS_COUNT, stream));
+    MESSAGE("Weather decoders:\n" << cost_report(weather, FPW_COUNT, stream));
+
+    std::vector<Decode> discard{};
+    drain(discard);
+
+    SubGhzDProtos per_edge{};
+    SubGhzDProtos batched{};
+    const auto start = std::chrono::steady_clock::now();
+    feed_per_edge(per_edge, stream);
+    const auto middle = std::chrono::steady_clock::now();
+    feed_batched(batched, stream, 64);
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto per_edge_ns = std::chrono::duration<double, std::nano>(middle - start).count() / stream.size();
+    const auto batched_ns = std::chrono::duration<double, std::nano>(end - middle).count() / stream.size();
+    MESSAGE("SubGhzDProtos per edge feed: " << per_edge_ns << " ns/edge, batched: " << batched_ns << " ns/edge");
+    CHECK(batched_ns > 0);
+}
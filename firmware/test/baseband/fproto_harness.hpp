@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __FPROTO_HARNESS_H__
+#define __FPROTO_HARNESS_H__
+
+/* Replays pulse streams through the fproto decoder lists on the host. */
+
+#include "fprotos/subghzdprotos.hpp"
+#include "fprotos/weatherprotos.hpp"
+#include "message.hpp"
+#include "portapack_shared_memory.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace fproto_harness {
+
+struct Pulse {
+    bool level;
+    uint32_t duration;  // us
+};
+
+using PulseStream = std::vector<Pulse>;
+
+/* A decoder hit, from either list. */
+struct Decode {
+    Message::ID id;
+    uint8_t sensor_type;
+    uint16_t bits;
+    uint64_t data;
+
+    bool operator==(const Decode& other) const {
+        return id == other.id && sensor_type == other.sensor_type &&
+               bits == other.bits && data == other.data;
+    }
+};
+
+/* Collects the decodes the lists posted to the application queue. */
+inline void drain(std::vector<Decode>& decodes) {
+    shared_memory.application_queue.handle([&decodes](Message* const message) {
+        if (message->id == Message::ID::SubGhzDData) {
+            const auto m = static_cast<const SubGhzDDataMessage*>(message);
+            decodes.push_back({message->id, m->sensorType, m->bits, m->data});
+        } else if (message->id == Message::ID::WeatherData) {
+            const auto m = static_cast<const WeatherDataMessage*>(message);
+            decodes.push_back({message->id, m->sensorType, 0, m->decode_data});
+        }
+    });
+}
+
+/* Feeds every edge to every decoder, like the processors used to. */
+inline std::vector<Decode> feed_per_edge(FProtoListGeneral& list, const PulseStream& stream) {
+    std::vector<Decode> decodes{};
+    for (const auto& pulse : stream) {
+        list.feed(pulse.level, pulse.duration);
+        drain(decodes);
+    }
+    return decodes;
+}
+
+/* Feeds edges through FProtoEdgeBatch in blocks of block_edges, like the processors do. */
+inline std::vector<Decode> feed_batched(FProtoListGeneral& list, const PulseStream& stream, size_t block_edges = 16) {
+    std::vector<Decode> decodes{};
+    FProtoEdgeBatch batch{};
+    for (size_t n = 0; n < stream.size(); ++n) {
+        const bool full = batch.push(stream[n].level, stream[n].duration);
+        if (full || (n + 1) % block_edges == 0 || n + 1 == stream.size()) {
+            list.feed(batch);
+            batch.clear();
+            drain(decodes);
+        }
+    }
+    return decodes;
+}
+
+/* Host time spent in one decoder's feed() per edge of the stream, in ns. */
+template <typename Proto>
+double ns_per_edge(Proto& proto, const PulseStream& stream, size_t passes = 20) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t pass = 0; pass < passes; ++pass) {
+        for (const auto& pulse : stream)
+            proto.feed(pulse.level, pulse.duration);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / (passes * stream.size());
+}
+
+}  // namespace fproto_harness
+
+#endif /*__FPROTO_HARNESS_H__*/
@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Replays the Flipper .sub files in subfiles/ through both protocol lists.
+ *
+ * To add a capture, drop the .sub file in subfiles/ and add a row to
+ * 'corpus' with the decode it must produce. The files are parsed with
+ * the same flipper_subfile.hpp readers the Flipper TX app uses. */
+
+#include "flipper_subfile.hpp"
+#include "fproto_harness.hpp"
+#include "mock_file.hpp"
+#include "doctest.h"
+
+#include <fstream>
+#include <sstream>
+
+using namespace fproto_harness;
+
+namespace {
+
+struct CorpusEntry {
+    const char* file;
+    Decode expected;
+};
+
+const CorpusEntry corpus[] = {
+    {"princeton_5a3c81.sub", {Message::ID::SubGhzDData, FPS_PRINCETON, 24, 0x5A3C81}},
+    {"came12_9b5.sub", {Message::ID::SubGhzDData, FPS_CAME, 12, 0x9B5}},
+    {"nexus_th_9a20d2f37.sub", {Message::ID::WeatherData, FPW_NexusTH, 0, 0x9A20D2F37}},
+};
+
+MockFile open_sub(const std::string& name) {
+    std::ifstream in{std::string{FPROTO_CORPUS_DIR} + "/" + name, std::ios::binary};
+    REQUIRE(in.good());
+    std::stringstream data{};
+    data << in.rdbuf();
+    return MockFile{data.str()};
+}
+
+/* Converts the file's signed durations to edges, merging same-level runs
+ * like the baseband sees them. */
+PulseStream load_sub(const std::string& name) {
+    auto f = open_sub(name);
+    auto metadata = read_flippersub_metadata(f);
+    REQUIRE(metadata.is_valid());
+
+    PulseStream stream{};
+    auto add = [&stream](int32_t duration) {
+        const bool level = duration > 0;
+        const uint32_t length = level ? duration : -duration;
+        if (!stream.empty() && stream.back().level == level)
+            stream.back().duration += length;
+        else
+            stream.push_back({level, length});
+    };
+
+    if (metadata->protocol == FLIPPER_PROTO_RAW) {
+        REQUIRE(seek_flipper_raw_first_data(f));
+        for (auto data = read_flipper_raw_next_data(f); data.is_valid(); data = read_flipper_raw_next_data(f))
+            add(*data);
+    } else {
+        REQUIRE(metadata->protocol == FLIPPER_PROTO_BINRAW);
+        REQUIRE(seek_flipper_binraw_first_data(f));
+        for (auto data = read_flipper_binraw_next_data(f); data.is_valid(); data = read_flipper_binraw_next_data(f)) {
+            for (int8_t bit = 7; bit >= 0; --bit)
+                add((get_flipper_binraw_bitvalue(*data, bit) ? 1 : -1) * metadata->te);
+        }
+    }
+    return stream;
+}
+
+bool contains(const std::vector<Decode>& decodes, const Decode& expected) {
+    for (const auto& d : decodes) {
+        if (d == expected) return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+TEST_CASE("Flipper .sub readers handle RAW and multi block BinRAW files") {
+    MockFile raw{
+        "Filetype: Flipper SubGhz RAW File\n"
+        "Frequency: 433920000\n"
+        "Protocol: RAW\n"
+        "RAW_Data: 100 -200 \n"
+        "RAW_Data: 300 -400"};
+    auto metadata = read_flippersub_metadata(raw);
+    REQUIRE(metadata.is_valid());
+    CHECK(metadata->center_frequency == 433920000);
+    CHECK(metadata->protocol == FLIPPER_PROTO_RAW);
+
+    REQUIRE(seek_flipper_raw_first_data(raw));
+    for (const int32_t expected : {100, -200, 300, -400}) {
+        auto data = read_flipper_raw_next_data(raw);
+        REQUIRE(data.is_valid());
+        CHECK(*data == expected);
+    }
+    // No trailing newline, must still stop.
+    CHECK_FALSE(read_flipper_raw_next_data(raw).is_valid());
+
+    MockFile binraw{
+        "Filetype: Flipper SubGhz Key File\n"
+        "Frequency: 315000000\n"
+        "Protocol: BinRAW\n"
+        "TE: 500\n"
+        "Bit_RAW: 16\n"
+        "Data_RAW: 01 FE\n"
+        "Bit_RAW: 8\n"
+        "Data_RAW: 80\n"};
+    metadata = read_flippersub_metadata(binraw);
+    REQUIRE(metadata.is_valid());
+    CHECK(metadata->protocol == FLIPPER_PROTO_BINRAW);
+    CHECK(metadata->te == 500);
+
+    REQUIRE(seek_flipper_binraw_first_data(binraw));
+    for (const uint8_t expected : {0x01, 0xFE, 0x80}) {
+        auto data = read_flipper_binraw_next_data(binraw);
+        REQUIRE(data.is_valid());
+        CHECK(*data == expected);
+    }
+    CHECK_FALSE(read_flipper_binraw_next_data(binraw).is_valid());
+}
+
+/* Both lists, fresh for every file, in the order the decodes come out. */
+template <typename Feed>
+std::vector<Decode> decode_all(const PulseStream& stream, Feed feed) {
+    SubGhzDProtos subghzd{};
+    WeatherProtos weather{};
+    auto decodes = feed(subghzd, stream);
+    const auto weather_decodes = feed(weather, stream);
+    decodes.insert(decodes.end(), weather_decodes.begin(), weather_decodes.end());
+    return decodes;
+}
+
+TEST_CASE("Flipper .sub corpus decodes") {
+    for (const auto& entry : corpus) {
+        CAPTURE(entry.file);
+        const auto stream = load_sub(entry.file);
+        REQUIRE(stream.size() > 0);
+
+        const auto decodes = decode_all(stream, [](FProtoListGeneral& list, const PulseStream& s) {
+            return feed_batched(list, s);
+        });
+        CHECK(contains(decodes, entry.expected));
+        CHECK(decodes == decode_all(stream, feed_per_edge));
+    }
+}
+
+template <typename List>
+std::string throughput_report(const List& list, uint8_t count, const PulseStream& stream) {
+    std::ostringstream out{};
+    for (uint8_t i = 0; i < count; ++i) {
+        auto proto = list.proto(i);
+        if (!proto) continue;
+        out << "  #" << int(i) << ": " << (1000.0 / ns_per_edge(*proto, stream)) << " Medges/s\n";
+    }
+    return out.str();
+}
+
+TEST_CASE("Flipper .sub corpus throughput per decoder") {
+    /* Host-side reference only: edges/s each decoder sustains over the whole corpus. */
+    PulseStream stream{};
+    for (const auto& entry : corpus) {
+        const auto file_stream = load_sub(entry.file);
+        stream.insert(stream.end(), file_stream.begin(), file_stream.end());
+    }
+
+    SubGhzDProtos subghzd{};
+    WeatherProtos weather{};
+    MESSAGE("SubGhzD decoders, " << stream.size() << " edges:\n" << throughput_report(subghzd, FPS_COUNT, stream));
+    MESSAGE("Weather decoders, " << stream.size() << " edges:\n" << throughput_report(weather, FPW_COUNT, stream));
+
+    std::vector<Decode> discard{};
+    drain(discard);
+    CHECK(stream.size() > 0);
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Stubs that let baseband code which posts messages to the application
+ * link and run on the dev machine. The shared memory block is a plain
+ * static here, so tests can drain application_queue to see what the
+ * code under test sent. */
+
+#include "portapack_shared_memory.hpp"
+
+/* ChibiOS mutex stubs, tests are single threaded. */
+void chMtxInit(Mutex*) {}
+bool_t chMtxTryLock(Mutex*) {
+    return true;
+}
+Mutex* chMtxUnlock(void) {
+    return nullptr;
+}
+
+void MessageQueue::signal() {}
+
+static SharedMemory test_shared_memory{};
+SharedMemory& shared_memory = test_shared_memory;
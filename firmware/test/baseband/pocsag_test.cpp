@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "pocsag_bch.hpp"
+#include "pocsag_bits.hpp"
+#include "doctest.h"
+
+#include <vector>
+
+using namespace pocsag;
+
+namespace {
+
+constexpr uint32_t fs = 24000;
+constexpr uint32_t address_codeword = bch::encode(0x12345 << 11);
+constexpr uint32_t message_codeword = bch::encode(0x80000000 | (0xABCDE << 11));
+
+/* Builds normalized POCSAG audio (+1 == '0', -1 == '1'): preamble,
+ * then the given number of batches of alternating address/message words. */
+std::vector<float> make_transmission(uint32_t baud, size_t batches, bool inverted = false) {
+    std::vector<bool> bits{};
+    for (size_t i = 0; i < 576; ++i)
+        bits.push_back((i & 1) == 0);
+
+    auto push_word = [&bits](uint32_t word) {
+        for (int8_t i = 31; i >= 0; --i)
+            bits.push_back((word >> i) & 1);
+    };
+
+    for (size_t b = 0; b < batches; ++b) {
+        push_word(CodewordExtractor::sync_codeword);
+        for (size_t i = 0; i < batch_size; ++i)
+            push_word((i & 1) ? message_codeword : address_codeword);
+    }
+
+    const size_t sample_count = bits.size() * fs / baud;
+    std::vector<float> audio(sample_count);
+    for (size_t n = 0; n < sample_count; ++n) {
+        const bool bit = bits[size_t(n) * baud / fs];
+        audio[n] = (bit != inverted) ? -1.0f : 1.0f;
+    }
+    return audio;
+}
+
+struct Receiver {
+    BitQueue bits{};
+    BitExtractor extractor{bits};
+    std::vector<batch_t> batches{};
+    CodewordExtractor words{
+        bits, [this](CodewordExtractor& words) {
+            batches.push_back(words.batch());
+        }};
+
+    Receiver() {
+        extractor.configure(fs);
+    }
+
+    /* Feeds the audio in 16 sample blocks like the baseband processor. */
+    void feed(std::vector<float>& audio) {
+        for (size_t n = 0; n + 16 <= audio.size(); n += 16) {
+            extractor.extract_bits({&audio[n], 16, fs});
+            words.process_bits();
+        }
+    }
+};
+
+}  // namespace
+
+TEST_CASE("bch::encode produces codewords with a zero syndrome and even parity") {
+    CHECK(bch::syndrome(address_codeword) == 0);
+    CHECK(bch::syndrome(CodewordExtractor::sync_codeword) == 0);
+    CHECK(bch::syndrome(CodewordExtractor::idle_codeword) == 0);
+    CHECK(bch::encode(CodewordExtractor::sync_codeword) == CodewordExtractor::sync_codeword);
+    CHECK(bch::encode(CodewordExtractor::idle_codeword) == CodewordExtractor::idle_codeword);
+}
+
+TEST_CASE("bch::correct fixes every single and double bit error") {
+    auto codeword = message_codeword;
+    CHECK(bch::correct(codeword) == 0);
+    CHECK(codeword == message_codeword);
+
+    for (uint8_t i = 0; i < 32; ++i) {
+        codeword = message_codeword ^ (1u << i);
+        CHECK(bch::correct(codeword) == 1);
+        CHECK(codeword == message_codeword);
+
+        for (uint8_t j = i + 1; j < 32; ++j) {
+            codeword = message_codeword ^ (1u << i) ^ (1u << j);
+            REQUIRE(bch::correct(codeword) == 2);
+            REQUIRE(codeword == message_codeword);
+        }
+    }
+}
+
+TEST_CASE("bch::correct reports three bit errors as uncorrectable and leaves the codeword as received") {
+    for (uint8_t i = 0; i < 32; ++i) {
+        for (uint8_t j = i + 1; j < 32; ++j) {
+            for (uint8_t k = j + 1; k < 32; ++k) {
+                const auto received = address_codeword ^ (1u << i) ^ (1u << j) ^ (1u << k);
+                auto codeword = received;
+                REQUIRE(bch::correct(codeword) == bch::uncorrectable);
+                REQUIRE(codeword == received);
+            }
+        }
+    }
+}
+
+TEST_CASE("BitQueue pushes a whole word in transmit order") {
+    BitQueue queue{};
+    queue.push(true);
+    queue.push(0x80000001, 32);
+    CHECK(queue.size() == 33);
+    CHECK(queue.pop() == true);
+    CHECK(queue.pop() == true);
+    for (size_t i = 0; i < 30; ++i)
+        CHECK(queue.pop() == false);
+    CHECK(queue.pop() == true);
+    CHECK(queue.size() == 0);
+}
+
+TEST_CASE("BitExtractor locks the right rate and batches are recovered") {
+    for (const uint32_t baud : {512u, 1200u, 2400u}) {
+        CAPTURE(baud);
+        Receiver rx{};
+        auto audio = make_transmission(baud, 3);
+        rx.feed(audio);
+
+        CHECK(rx.extractor.locked());
+        CHECK(rx.extractor.baud_rate() == baud);
+        REQUIRE(rx.batches.size() == 3);
+        for (const auto& batch : rx.batches) {
+            CHECK(batch[0] == address_codeword);
+            CHECK(batch[15] == message_codeword);
+        }
+    }
+}
+
+TEST_CASE("BitExtractor locks on inverted sync") {
+    Receiver rx{};
+    auto audio = make_transmission(1200, 1, /*inverted=*/true);
+    rx.feed(audio);
+
+    CHECK(rx.extractor.baud_rate() == 1200);
+    REQUIRE(rx.batches.size() == 1);
+    CHECK(rx.batches[0][0] == address_codeword);
+}
+
+TEST_CASE("BitExtractor does not lock on preamble alone") {
+    Receiver rx{};
+    auto audio = make_transmission(1200, 0);
+    rx.feed(audio);
+
+    CHECK_FALSE(rx.extractor.locked());
+    CHECK(rx.extractor.baud_rate() == 1200);
+    CHECK(rx.batches.empty());
+}
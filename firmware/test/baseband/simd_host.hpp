@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+#ifndef __SIMD_HOST_H__
+#define __SIMD_HOST_H__
+
+/* Portable stand-ins for the Cortex-M4 DSP instructions, for host builds
+ * of M4 code: force included (-include) after the CMSIS and LPC43xx
+ * headers have defined them as ARM assembly, it sends every later use
+ * here instead. Results match the instructions, not their timing. */
+
+#include <hal.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace simd_host {
+
+inline int32_t lo(const uint32_t v) { return int16_t(v); }
+inline int32_t hi(const uint32_t v) { return int16_t(v >> 16); }
+inline uint32_t ror(const uint32_t v, const uint32_t n) { return n ? (v >> n) | (v << (32 - n)) : v; }
+inline uint32_t pack(const int32_t low, const int32_t high) { return uint32_t(uint16_t(low)) | (uint32_t(uint16_t(high)) << 16); }
+
+inline int32_t ssat(const int64_t v, const uint32_t bits) {
+    const int64_t max = (int64_t(1) << (bits - 1)) - 1;
+    return std::clamp<int64_t>(v, -max - 1, max);
+}
+
+inline uint32_t pkhbt(const uint32_t a, const uint32_t b, const uint32_t sh) { return (a & 0xffff) | ((b << sh) & 0xffff0000); }
+inline uint32_t pkhtb(const uint32_t a, const uint32_t b, const uint32_t sh) { return (a & 0xffff0000) | (uint32_t(int32_t(b) >> sh) & 0xffff); }
+inline uint32_t qadd(const uint32_t a, const uint32_t b) { return ssat(int64_t(int32_t(a)) + int32_t(b), 32); }
+inline uint32_t qsub(const uint32_t a, const uint32_t b) { return ssat(int64_t(int32_t(a)) - int32_t(b), 32); }
+inline uint32_t qadd16(const uint32_t a, const uint32_t b) { return pack(ssat(lo(a) + lo(b), 16), ssat(hi(a) + hi(b), 16)); }
+inline uint32_t qsub16(const uint32_t a, const uint32_t b) { return pack(ssat(lo(a) - lo(b), 16), ssat(hi(a) - hi(b), 16)); }
+inline uint32_t rev16(const uint32_t v) { return ((v & 0x00ff00ff) << 8) | ((v >> 8) & 0x00ff00ff); }
+
+inline uint32_t smuad(const uint32_t a, const uint32_t b) { return lo(a) * lo(b) + hi(a) * hi(b); }
+inline uint32_t smuadx(const uint32_t a, const uint32_t b) { return lo(a) * hi(b) + hi(a) * lo(b); }
+inline uint32_t smusd(const uint32_t a, const uint32_t b) { return lo(a) * lo(b) - hi(a) * hi(b); }
+inline uint32_t smusdx(const uint32_t a, const uint32_t b) { return lo(a) * hi(b) - hi(a) * lo(b); }
+inline uint32_t smlad(const uint32_t a, const uint32_t b, const uint32_t acc) { return acc + smuad(a, b); }
+inline uint32_t smladx(const uint32_t a, const uint32_t b, const uint32_t acc) { return acc + smuadx(a, b); }
+inline uint32_t smlsd(const uint32_t a, const uint32_t b, const uint32_t acc) { return acc + smusd(a, b); }
+inline int64_t smlaldx(const uint32_t a, const uint32_t b, const int64_t acc) { return acc + int64_t(lo(a)) * hi(b) + int64_t(hi(a)) * lo(b); }
+inline int64_t smlsld(const uint32_t a, const uint32_t b, const int64_t acc) { return acc + int64_t(lo(a)) * lo(b) - int64_t(hi(a)) * hi(b); }
+inline int32_t smulbb(const uint32_t a, const uint32_t b) { return lo(a) * lo(b); }
+inline int32_t smulbt(const uint32_t a, const uint32_t b) { return lo(a) * hi(b); }
+inline int32_t smultb(const uint32_t a, const uint32_t b) { return hi(a) * lo(b); }
+inline int32_t smultt(const uint32_t a, const uint32_t b) { return hi(a) * hi(b); }
+inline int32_t smlabb(const uint32_t a, const uint32_t b, const uint32_t acc) { return acc + smulbb(a, b); }
+inline int32_t smlatb(const uint32_t a, const uint32_t b, const uint32_t acc) { return acc + smultb(a, b); }
+inline int32_t smmulr(const int32_t a, const int32_t b) { return (int64_t(a) * b + 0x80000000LL) >> 32; }
+
+inline uint32_t sxtb16(const uint32_t v, const uint32_t rotate = 0) {
+    const uint32_t r = ror(v, rotate);
+    return pack(int8_t(r), int8_t(r >> 16));
+}
+inline int32_t sxth(const uint32_t v, const uint32_t rotate) { return int16_t(ror(v, rotate)); }
+inline int32_t sxtah(const uint32_t n, const uint32_t m, const uint32_t rotate) { return n + int16_t(ror(m, rotate)); }
+inline uint32_t bfi(const uint32_t d, const uint32_t n, const uint32_t lsb, const uint32_t width) {
+    const uint32_t mask = ((width < 32) ? ((1u << width) - 1) : ~0u) << lsb;
+    return (d & ~mask) | ((n << lsb) & mask);
+}
+
+} /* namespace simd_host */
+
+#undef __SSAT
+#undef __PKHBT
+#undef __PKHTB
+#undef __QADD
+#undef __QSUB
+#undef __SMLSLD
+#undef __SXTB16
+
+#define __SSAT(v, bits) simd_host::ssat(v, bits)
+#define __PKHBT(...) simd_host::pkhbt(__VA_ARGS__)
+#define __PKHTB(...) simd_host::pkhtb(__VA_ARGS__)
+#define __QADD(...) simd_host::qadd(__VA_ARGS__)
+#define __QSUB(...) simd_host::qsub(__VA_ARGS__)
+#define __QADD16(...) simd_host::qadd16(__VA_ARGS__)
+#define __QSUB16(...) simd_host::qsub16(__VA_ARGS__)
+#define __REV16(...) simd_host::rev16(__VA_ARGS__)
+#define __SMUAD(...) simd_host::smuad(__VA_ARGS__)
+#define __SMUADX(...) simd_host::smuadx(__VA_ARGS__)
+#define __SMUSD(...) simd_host::smusd(__VA_ARGS__)
+#define __SMUSDX(...) simd_host::smusdx(__VA_ARGS__)
+#define __SMLAD(...) simd_host::smlad(__VA_ARGS__)
+#define __SMLADX(...) simd_host::smladx(__VA_ARGS__)
+#define __SMLSD(...) simd_host::smlsd(__VA_ARGS__)
+#define __SMLALDX(...) simd_host::smlaldx(__VA_ARGS__)
+#define __SMLSLD(...) simd_host::smlsld(__VA_ARGS__)
+#define __SMULBB(...) simd_host::smulbb(__VA_ARGS__)
+#define __SMULBT(...) simd_host::smulbt(__VA_ARGS__)
+#define __SMULTB(...) simd_host::smultb(__VA_ARGS__)
+#define __SMULTT(...) simd_host::smultt(__VA_ARGS__)
+#define __SMLABB(...) simd_host::smlabb(__VA_ARGS__)
+#define __SMLATB(...) simd_host::smlatb(__VA_ARGS__)
+#define __SMMULR(...) simd_host::smmulr(__VA_ARGS__)
+#define __SXTB16(...) simd_host::sxtb16(__VA_ARGS__)
+#define __SXTH(...) simd_host::sxth(__VA_ARGS__)
+#define __SXTAH(...) simd_host::sxtah(__VA_ARGS__)
+#define __BFI(...) simd_host::bfi(__VA_ARGS__)
+#define __SEV() ((void)0)
+
+#endif /*__SIMD_HOST_H__*/
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+/* The WFM receive path of proc_wfm_audio.cpp, mono and stereo, from the
+ * baseband buffer to the audio DMA buffer. Built with simd_host.hpp, see
+ * CMakeLists.txt. */
+
+#include "dsp_decimate.hpp"
+#include "dsp_demodulate.hpp"
+#include "dsp_fir_taps.hpp"
+#include "dsp_fm_stereo.hpp"
+#include "dsp_iir_config.hpp"
+#include "audio_output.hpp"
+#include "doctest.h"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+/* Audio goes to one DMA transfer that the test reads back. */
+namespace {
+std::array<audio::sample_t, 32> dma_buffer{};
+}  // namespace
+
+namespace audio::dma {
+audio::buffer_t tx_empty_buffer() {
+    return {dma_buffer.data(), dma_buffer.size()};
+}
+}  // namespace audio::dma
+
+namespace {
+
+constexpr uint32_t baseband_fs = 3072000;
+constexpr size_t buffer_size = 2048;
+constexpr double two_pi = 2.0 * M_PI;
+
+/* A station at fs/4, where the first decimator shifts it from, 75kHz
+ * deviation: 45% L+R, 45% L-R on 38kHz, 10% pilot. */
+std::vector<complex8_t> station(const double left, const double right, const size_t count) {
+    std::vector<complex8_t> samples(count);
+    double phase = 0.0;
+    for (size_t n = 0; n < count; n++) {
+        const double t = double(n) / baseband_fs;
+        const double tone = std::sin(two_pi * 1000.0 * t);
+        const double pilot = two_pi * 19000.0 * t;
+        const double mpx = 0.45 * (left + right) * tone +
+                           0.45 * (left - right) * tone * std::sin(2.0 * pilot) +
+                           0.1 * std::sin(pilot);
+        phase += two_pi * (baseband_fs / 4.0 + 75000.0 * mpx) / baseband_fs;
+        samples[n] = {int8_t(std::lround(100.0 * std::cos(phase))), int8_t(std::lround(100.0 * std::sin(phase)))};
+    }
+    return samples;
+}
+
+/* WidebandFMAudio::execute() and configure_wfm() without the spectrum
+ * displays. */
+struct WFMPath {
+    std::array<complex16_t, 512> dst{};
+    const buffer_c16_t dst_buffer{dst.data(), dst.size()};
+    const buffer_s16_t work_audio_buffer{(int16_t*)dst.data(), sizeof(dst) / sizeof(int16_t)};
+    std::array<int16_t, 128> stereo_audio{};
+    const buffer_s16_t stereo_audio_buffer{stereo_audio.data(), stereo_audio.size()};
+
+    dsp::decimate::FIRC8xR16x24FS4Decim4 decim_0{};
+    dsp::decimate::FIRC16xR16x16Decim2 decim_1{};
+    dsp::demodulate::FM demod{};
+    dsp::decimate::DecimateBy2CIC4Real audio_dec_1{};
+    dsp::decimate::DecimateBy2CIC4Real audio_dec_2{};
+    dsp::decimate::FIR64AndDecimateBy2Real audio_filter{};
+    dsp::demodulate::FMStereo stereo{};
+    dsp::decimate::DecimateBy2CIC4Real stereo_dec{};
+    dsp::decimate::FIR64AndDecimateBy2Real stereo_filter{};
+    AudioOutput audio_output{};
+    const bool stereo_enabled;
+
+    /* Sum of squares of each output channel. */
+    double power_left{0.0};
+    double power_right{0.0};
+
+    WFMPath(const bool stereo_enabled)
+        : stereo_enabled{stereo_enabled} {
+        decim_0.configure(taps_200k_wfm_decim_0.taps);
+        decim_1.configure(taps_200k_wfm_decim_1.taps);
+        demod.configure(baseband_fs / 8, 75000);
+        audio_filter.configure(taps_64_lp_156_198.taps);
+        audio_output.configure(audio_48k_hpf_30hz_config, audio_48k_deemph_2122_6_config);
+        stereo.configure(baseband_fs / 16, 1.2171f);
+        stereo_filter.configure(taps_64_lp_156_198.taps);
+    }
+
+    void execute(const buffer_c8_t& buffer) {
+        const auto decim_0_out = decim_0.execute(buffer, dst_buffer);
+        const auto channel = decim_1.execute(decim_0_out, dst_buffer);
+        const auto audio_oversampled = demod.execute(channel, work_audio_buffer);
+        const auto audio_4fs = audio_dec_1.execute(audio_oversampled, work_audio_buffer);
+        if (stereo_enabled) {
+            const auto diff_4fs = stereo.execute(audio_4fs, stereo_audio_buffer);
+            const auto diff_2fs = stereo_dec.execute(diff_4fs, stereo_audio_buffer);
+            stereo_filter.execute(diff_2fs, stereo_audio_buffer);
+        }
+        const auto audio_2fs = audio_dec_2.execute(audio_4fs, work_audio_buffer);
+        const auto audio = audio_filter.execute(audio_2fs, work_audio_buffer);
+        if (stereo_enabled) {
+            const buffer_s16_t stereo_diff{stereo_audio.data(), audio.count, audio.sampling_rate};
+            stereo.matrix(audio, stereo_diff);
+            audio_output.write(audio, stereo_diff);
+        } else {
+            audio_output.write(audio);
+        }
+    }
+
+    void measure() {
+        for (const auto& sample : dma_buffer) {
+            power_left += double(sample.left) * sample.left;
+            power_right += double(sample.right) * sample.right;
+        }
+    }
+};
+
+/* Nanoseconds per baseband buffer, with a left only station, best of a
+ * few runs to keep the scheduler out of it. */
+double time_per_buffer(const bool stereo_enabled) {
+    const auto samples = station(1.0, 0.0, 100 * buffer_size);
+    WFMPath path{stereo_enabled};
+    double best = 0.0;
+
+    for (size_t run = 0; run < 5; run++) {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t first = 0; first < samples.size(); first += buffer_size)
+            path.execute({const_cast<complex8_t*>(&samples[first]), buffer_size, baseband_fs});
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / (samples.size() / buffer_size);
+        if (run == 0 || ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("WFM path");
+
+TEST_CASE("A left only station comes out on the left") {
+    const auto samples = station(1.0, 0.0, 1500 * buffer_size);  // 1s
+    for (const bool stereo_enabled : {false, true}) {
+        CAPTURE(stereo_enabled);
+        WFMPath path{stereo_enabled};
+        for (size_t first = 0; first < samples.size(); first += buffer_size) {
+            path.execute({const_cast<complex8_t*>(&samples[first]), buffer_size, baseband_fs});
+            // The last quarter, after the pilot lock.
+            if (first >= samples.size() * 3 / 4)
+                path.measure();
+        }
+        CHECK(path.power_left > 0.0);
+        if (stereo_enabled) {
+            CHECK(path.stereo.pilot_locked());
+            CHECK(10.0 * std::log10(path.power_left / path.power_right) > 20.0);
+        } else {
+            CHECK(path.power_left == path.power_right);
+        }
+    }
+}
+
+TEST_CASE("Time per buffer, mono and stereo") {
+    /* Host reference only: the ratio is what carries over to the M4, which
+     * has 136k cycles (204MHz) for each 2048 sample buffer at 3.072MHz. */
+    const double mono = time_per_buffer(false);
+    const double stereo = time_per_buffer(true);
+    const double budget = 1e9 * buffer_size / baseband_fs;
+    MESSAGE("WFM path per 2048 sample buffer: mono " << mono << " ns, stereo " << stereo << " ns (+"
+                                                      << 100.0 * (stereo - mono) / mono << "%), real time " << budget << " ns");
+    CHECK(mono > 0.0);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,332 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "host_display.hpp"
+
+#include "portapack.hpp"
+#include "portapack_hal.hpp"
+
+#include <cstdio>
+
+namespace host_display {
+
+namespace {
+
+/* ILI9341 commands lcd::ILI9341 uses. */
+constexpr uint8_t column_address_set = 0x2a;
+constexpr uint8_t page_address_set = 0x2b;
+constexpr uint8_t memory_write = 0x2c;
+constexpr uint8_t memory_read = 0x2e;
+constexpr uint8_t vertical_scrolling_definition = 0x33;
+constexpr uint8_t vertical_scrolling_start_address = 0x37;
+
+uint16_t be16(const uint8_t* p) {
+    return (p[0] << 8) | p[1];
+}
+
+/* Just enough PNG: one IDAT of stored (uncompressed) deflate blocks. */
+class PNGWriter {
+   public:
+    explicit PNGWriter(std::FILE* f)
+        : f{f} {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (size_t k = 0; k < 8; k++)
+                c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+            crc_table[n] = c;
+        }
+    }
+
+    void signature() {
+        static constexpr uint8_t bytes[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+        std::fwrite(bytes, 1, sizeof(bytes), f);
+    }
+
+    void chunk(const char* type, const std::vector<uint8_t>& data) {
+        std::vector<uint8_t> body(type, type + 4);
+        body.insert(body.end(), data.begin(), data.end());
+        put32(data.size());
+        std::fwrite(body.data(), 1, body.size(), f);
+        put32(crc(body));
+    }
+
+    static void append32(std::vector<uint8_t>& v, uint32_t value) {
+        for (int shift = 24; shift >= 0; shift -= 8)
+            v.push_back(value >> shift);
+    }
+
+    /* zlib stream of stored blocks. */
+    static std::vector<uint8_t> zlib_stored(const std::vector<uint8_t>& raw) {
+        std::vector<uint8_t> out{0x78, 0x01};
+        size_t offset = 0;
+        do {
+            const size_t length = std::min<size_t>(raw.size() - offset, 0xffff);
+            const bool last = offset + length == raw.size();
+            out.push_back(last ? 1 : 0);
+            out.push_back(length & 0xff);
+            out.push_back(length >> 8);
+            out.push_back(~length & 0xff);
+            out.push_back((~length >> 8) & 0xff);
+            out.insert(out.end(), raw.begin() + offset, raw.begin() + offset + length);
+            offset += length;
+        } while (offset < raw.size());
+
+        uint32_t a = 1, b = 0;
+        for (const auto byte : raw) {
+            a = (a + byte) % 65521;
+            b = (b + a) % 65521;
+        }
+        append32(out, (b << 16) | a);
+        return out;
+    }
+
+   private:
+    std::FILE* f;
+    std::array<uint32_t, 256> crc_table{};
+
+    void put32(uint32_t value) {
+        std::vector<uint8_t> v{};
+        append32(v, value);
+        std::fwrite(v.data(), 1, v.size(), f);
+    }
+
+    uint32_t crc(const std::vector<uint8_t>& data) const {
+        uint32_t c = 0xffffffff;
+        for (const auto byte : data)
+            c = crc_table[(c ^ byte) & 0xff] ^ (c >> 8);
+        return c ^ 0xffffffff;
+    }
+};
+
+}  // namespace
+
+void Framebuffer::command(uint8_t command) {
+    counters.commands++;
+    current_command = command;
+    parameter_index = 0;
+
+    switch (command) {
+        case memory_write:
+            cursor_x = column_start;
+            cursor_y = page_start;
+            break;
+
+        case memory_read:
+            cursor_x = column_start;
+            cursor_y = page_start;
+            read_bytes.clear();
+            read_index = 0;
+            // The first read after the command is a dummy.
+            read_bytes.push_back(0);
+            read_bytes.push_back(0);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void Framebuffer::write(uint16_t data) {
+    if (current_command != memory_write) {
+        parameter(data);
+        return;
+    }
+
+    if (cursor_x < width && cursor_y < height) {
+        auto& m = frame_memory[cursor_y * width + cursor_x];
+        if (m == data)
+            counters.unchanged_writes++;
+        m = data;
+    }
+    counters.pixel_writes++;
+    advance_cursor();
+}
+
+uint16_t Framebuffer::read() {
+    if (current_command != memory_read)
+        return 0;
+
+    while (read_bytes.size() - read_index < 2)
+        queue_read_pixel();
+    const auto word = be16(&read_bytes[read_index]);
+    read_index += 2;
+    return word;
+}
+
+void Framebuffer::reset() {
+    std::fill(frame_memory.begin(), frame_memory.end(), 0);
+    scroll_top = 0;
+    scroll_height = height;
+    scroll_start = 0;
+    counters.reset();
+}
+
+ui::Color Framebuffer::memory(ui::Point p) const {
+    return frame_memory[p.y() * width + p.x()];
+}
+
+ui::Color Framebuffer::pixel(ui::Point p) const {
+    auto y = p.y();
+    if (y >= scroll_top && y < scroll_top + scroll_height) {
+        const int32_t start = (scroll_start - scroll_top) % scroll_height;
+        y = scroll_top + (y - scroll_top + start + scroll_height) % scroll_height;
+    }
+    return memory({p.x(), y});
+}
+
+bool Framebuffer::write_png(const std::string& path) const {
+    auto f = std::fopen(path.c_str(), "wb");
+    if (!f)
+        return false;
+
+    std::vector<uint8_t> raw{};
+    raw.reserve(height * (1 + width * 3));
+    for (ui::Coord y = 0; y < height; y++) {
+        raw.push_back(0);  // No filter.
+        for (ui::Coord x = 0; x < width; x++) {
+            auto c = pixel({x, y});
+            raw.push_back(c.r());
+            raw.push_back(c.g());
+            raw.push_back(c.b());
+        }
+    }
+
+    std::vector<uint8_t> header{};
+    PNGWriter::append32(header, width);
+    PNGWriter::append32(header, height);
+    header.insert(header.end(), {8, 2, 0, 0, 0});  // 8 bit RGB.
+
+    PNGWriter png{f};
+    png.signature();
+    png.chunk("IHDR", header);
+    png.chunk("IDAT", PNGWriter::zlib_stored(raw));
+    png.chunk("IEND", {});
+    return std::fclose(f) == 0;
+}
+
+void Framebuffer::parameter(uint8_t value) {
+    if (parameter_index >= parameters.size())
+        return;
+    parameters[parameter_index++] = value;
+
+    switch (current_command) {
+        case column_address_set:
+            if (parameter_index == 4) {
+                column_start = be16(&parameters[0]);
+                column_end = be16(&parameters[2]);
+                counters.window_sets++;
+            }
+            break;
+
+        case page_address_set:
+            if (parameter_index == 4) {
+                page_start = be16(&parameters[0]);
+                page_end = be16(&parameters[2]);
+                counters.window_sets++;
+            }
+            break;
+
+        case vertical_scrolling_definition:
+            if (parameter_index == 6) {
+                scroll_top = be16(&parameters[0]);
+                scroll_height = be16(&parameters[2]);
+            }
+            break;
+
+        case vertical_scrolling_start_address:
+            if (parameter_index == 2)
+                scroll_start = be16(&parameters[0]);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* Column first, wrapping to the start of the window like the controller. */
+void Framebuffer::advance_cursor() {
+    if (++cursor_x <= column_end)
+        return;
+    cursor_x = column_start;
+    if (++cursor_y > page_end)
+        cursor_y = page_start;
+}
+
+/* Memory reads come back as 8 bit R, G, B. */
+void Framebuffer::queue_read_pixel() {
+    ui::Color c = (cursor_x < width && cursor_y < height) ? memory({cursor_x, cursor_y}) : ui::Color{};
+    read_bytes.push_back(c.r());
+    read_bytes.push_back(c.g());
+    read_bytes.push_back(c.b());
+    counters.pixel_reads++;
+    advance_cursor();
+}
+
+Framebuffer& framebuffer() {
+    static Framebuffer instance{};
+    return instance;
+}
+
+} /* namespace host_display */
+
+namespace portapack {
+
+DeviceType device_type = DEV_PORTAPACK;
+
+IO io{
+    portapack::gpio_dir,
+    portapack::gpio_lcd_rdx,
+    portapack::gpio_lcd_wrx,
+    portapack::gpio_io_stbx,
+    portapack::gpio_addr,
+    portapack::gpio_lcd_te,
+    portapack::gpio_dfu,
+};
+
+lcd::ILI9341 display;
+
+void IO::lcd_command(const uint32_t value) {
+    host_display::framebuffer().command(value);
+}
+
+void IO::lcd_write_data(const uint32_t value) {
+    host_display::framebuffer().write(value);
+}
+
+uint32_t IO::lcd_read_data() {
+    return host_display::framebuffer().read();
+}
+
+void IO::lcd_read_bytes(uint8_t* byte, size_t byte_count) {
+    for (size_t i = 0; i < byte_count; i += 2) {
+        const auto word = lcd_read_data();
+        byte[i] = word >> 8;
+        if (i + 1 < byte_count)
+            byte[i + 1] = word;
+    }
+}
+
+void IO::lcd_reset_state(const bool) {}
+
+void IO::update_cached_values() {}
+
+} /* namespace portapack */
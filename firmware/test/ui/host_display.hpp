@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef __HOST_DISPLAY_H__
+#define __HOST_DISPLAY_H__
+
+#include "ui.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace host_display {
+
+/* Bus traffic since the last reset(). */
+struct Counters {
+    size_t commands{0};
+    size_t window_sets{0};  // Column or page address sets.
+    size_t pixel_writes{0};
+    size_t unchanged_writes{0};  // Pixel writes of the color already there.
+    size_t pixel_reads{0};
+
+    void reset() { *this = {}; }
+};
+
+/* Emulated ILI9341 behind portapack::io on the host: decodes the commands
+ * lcd::ILI9341 sends and keeps its RGB565 frame memory. */
+class Framebuffer {
+   public:
+    static constexpr ui::Dim width = 240;
+    static constexpr ui::Dim height = 320;
+
+    Counters counters{};
+
+    void command(uint8_t command);
+    void write(uint16_t data);
+    uint16_t read();
+
+    /* Clears the frame memory and the scroll settings. */
+    void reset();
+
+    /* Frame memory, as written. */
+    ui::Color memory(ui::Point p) const;
+
+    /* What the panel shows there, with vertical scrolling applied. */
+    ui::Color pixel(ui::Point p) const;
+
+    /* Writes what the panel shows as an 8 bit RGB PNG. */
+    bool write_png(const std::string& path) const;
+
+   private:
+    std::vector<uint16_t> frame_memory = std::vector<uint16_t>(width * height, 0);
+
+    uint8_t current_command{0};
+    size_t parameter_index{0};
+    std::array<uint8_t, 6> parameters{};
+
+    ui::Coord column_start{0};
+    ui::Coord column_end{width - 1};
+    ui::Coord page_start{0};
+    ui::Coord page_end{height - 1};
+    ui::Coord cursor_x{0};
+    ui::Coord cursor_y{0};
+
+    uint16_t scroll_top{0};
+    uint16_t scroll_height{height};
+    uint16_t scroll_start{0};
+
+    std::vector<uint8_t> read_bytes{};
+    size_t read_index{0};
+
+    void parameter(uint8_t value);
+    void advance_cursor();
+    void queue_read_pixel();
+};
+
+/* The one behind portapack::io and portapack::display. */
+Framebuffer& framebuffer();
+
+} /* namespace host_display */
+
+#endif /*__HOST_DISPLAY_H__*/
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "host_event_loop.hpp"
+
+#include "event_m0.hpp"
+#include "ui_painter.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <functional>
+
+namespace host_event_loop {
+
+namespace {
+
+using MessageHandler = std::function<void(Message* const p)>;
+
+std::array<MessageHandler, toUType(Message::ID::MAX)>& handlers() {
+    static std::array<MessageHandler, toUType(Message::ID::MAX)> map{};
+    return map;
+}
+
+}  // namespace
+
+Screen::Screen()
+    : View{{0, 0, ui::screen_width, ui::screen_height}} {
+    set_style(ui::Theme::getInstance()->bg_darkest);
+}
+
+ui::Context& Screen::context() const {
+    return context_;
+}
+
+void Screen::show(ui::View& view) {
+    add_child(&view);
+    view.set_parent_rect({0, status_bar_height, ui::screen_width, ui::screen_height - status_bar_height});
+    view.focus();
+}
+
+void send(Message* const message) {
+    auto& handler = handlers()[toUType(message->id)];
+    if (handler)
+        handler(message);
+}
+
+host_display::Counters frame(ui::Widget& top) {
+    auto& counters = host_display::framebuffer().counters;
+    counters.reset();
+
+    DisplayFrameSyncMessage message{};
+    send(&message);
+
+    ui::Painter painter{};
+    painter.paint_widget_tree(&top);
+    return counters;
+}
+
+} /* namespace host_event_loop */
+
+MessageHandlerRegistration::MessageHandlerRegistration(
+    const Message::ID message_id,
+    std::function<void(Message* const p)>&& callback)
+    : message_id{message_id} {
+    host_event_loop::handlers()[toUType(message_id)] = std::move(callback);
+}
+
+MessageHandlerRegistration::~MessageHandlerRegistration() {
+    host_event_loop::handlers()[toUType(message_id)] = nullptr;
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef __HOST_EVENT_LOOP_H__
+#define __HOST_EVENT_LOOP_H__
+
+#include "host_display.hpp"
+#include "message.hpp"
+#include "theme.hpp"
+#include "ui_widget.hpp"
+
+namespace host_event_loop {
+
+/* Stands in for SystemView: root of the widget tree and owner of the
+ * focus context, showing one app view below the status bar. */
+class Screen : public ui::View {
+   public:
+    static constexpr ui::Dim status_bar_height = 16;
+
+    Screen();
+
+    ui::Context& context() const override;
+
+    /* Lays the view out like NavigationView would and focuses it. */
+    void show(ui::View& view);
+
+   private:
+    mutable ui::Context context_{};
+};
+
+/* Calls the handler registered for the message, like the M0 event loop. */
+void send(Message* const message);
+
+/* One display frame of the M0 event loop: frame sync, then repaint of the
+ * dirty widgets under 'top'. Returns the bus traffic of the frame. */
+host_display::Counters frame(ui::Widget& top);
+
+} /* namespace host_event_loop */
+
+#endif /*__HOST_EVENT_LOOP_H__*/
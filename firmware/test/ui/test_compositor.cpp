@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "doctest.h"
+#include "host_event_loop.hpp"
+
+#include "ui_btngrid.hpp"
+#include "ui_painter.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace ui;
+
+namespace {
+
+std::vector<uint16_t> screen_contents() {
+    std::vector<uint16_t> pixels{};
+    for (Coord y = 0; y < screen_height; y++) {
+        for (Coord x = 0; x < screen_width; x++)
+            pixels.push_back(host_display::framebuffer().pixel({x, y}).v);
+    }
+    return pixels;
+}
+
+/* What the screen should show: every visible widget painted in full, in
+ * tree order, without the compositor. */
+void paint_everything(Widget* w, Painter& painter) {
+    if (w->hidden())
+        return;
+    w->paint(painter);
+    for (const auto child : w->children())
+        paint_everything(child, painter);
+}
+
+std::vector<uint16_t> reference_contents(Widget& top) {
+    host_display::framebuffer().reset();
+    Painter painter{};
+    paint_everything(&top, painter);
+    return screen_contents();
+}
+
+uint32_t area(const Rect& r) {
+    return r.width() * r.height();
+}
+
+class Launcher : public BtnGridView {
+   public:
+    Launcher() {
+        on_populate();
+    }
+
+   private:
+    void on_populate() override {
+        for (size_t i = 0; i < 9; i++)
+            add_item({"App " + std::to_string(i), Color::green(), nullptr, nullptr});
+    }
+};
+
+/* A panel with a label on top and a second label fully under a third. */
+class Panel : public View {
+   public:
+    Panel() {
+        set_style(Theme::getInstance()->bg_dark);
+        add_children({&label, &hidden_label, &covering_label});
+    }
+
+    Text label{{8, 8, 80, 16}, "Label"};
+    Text hidden_label{{8, 40, 80, 16}, "Hidden"};
+    Text covering_label{{0, 32, 120, 32}, "Covering"};
+};
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Compositor");
+
+TEST_CASE("DamageRegion merges overlapping rectangles") {
+    DamageRegion damage{};
+    damage.add({0, 0, 10, 10});
+    damage.add({20, 0, 10, 10});
+    damage.add({});
+    CHECK(damage.size() == 2);
+    CHECK(damage.area() == 200);
+
+    // Bridges both: all three become one.
+    damage.add({5, 5, 20, 2});
+    REQUIRE(damage.size() == 1);
+    CHECK(damage.begin()->left() == 0);
+    CHECK(damage.begin()->right() == 30);
+    CHECK(damage.area() == 300);
+
+    CHECK(damage.intersects({29, 9, 5, 5}));
+    CHECK_FALSE(damage.intersects({30, 0, 5, 5}));
+
+    damage.clear();
+    CHECK(damage.size() == 0);
+    CHECK(damage.area() == 0);
+}
+
+TEST_CASE("DamageRegion merges the closest rectangles when full") {
+    DamageRegion damage{};
+    for (size_t i = 0; i < DamageRegion::capacity; i++)
+        damage.add({Coord(i * 30), 0, 10, 10});
+    CHECK(damage.size() == DamageRegion::capacity);
+
+    // Next to the last one.
+    damage.add({Coord((DamageRegion::capacity - 1) * 30), 12, 10, 10});
+    CHECK(damage.size() == DamageRegion::capacity);
+    CHECK(damage.area() == (DamageRegion::capacity - 1) * 100 + 10 * 22);
+
+    // Disjoint, as every rectangle it covers is merged into it.
+    for (auto a = damage.begin(); a != damage.end(); a++) {
+        for (auto b = a + 1; b != damage.end(); b++)
+            CHECK(a->intersect(*b).is_empty());
+    }
+}
+
+TEST_CASE("Frames show what painting everything would") {
+    host_display::framebuffer().reset();
+    host_event_loop::Screen screen{};
+    Launcher view{};
+    screen.show(view);
+
+    host_event_loop::frame(screen);
+    CHECK(screen_contents() == reference_contents(screen));
+
+    for (const int delta : {1, 1, 3, -2}) {
+        CAPTURE(delta);
+        host_display::framebuffer().reset();
+        screen.set_dirty();
+        host_event_loop::frame(screen);
+
+        view.on_encoder(delta);
+        host_event_loop::frame(screen);
+        CHECK(screen_contents() == reference_contents(screen));
+    }
+}
+
+TEST_CASE("Fills stay inside the damage and out from under opaque widgets") {
+    host_display::framebuffer().reset();
+    host_event_loop::Screen screen{};
+    Panel panel{};
+    screen.show(panel);
+
+    Painter painter{};
+    screen.set_dirty();
+    painter.paint_widget_tree(&screen);
+    const auto& first = painter.frame_stats();
+    CHECK(first.damaged_area == area(screen.screen_rect()));
+    CHECK(first.occluded == 1);
+    CHECK(first.painted == 4);
+    // The panel fill leaves the labels out, the hidden label fills nothing.
+    CHECK(first.filled_area == area(screen.screen_rect()) + area(panel.screen_rect()));
+    CHECK(screen_contents() == reference_contents(screen));
+
+    // The panel is opaque once painted: the screen fill leaves it out and
+    // every pixel is filled once.
+    screen.set_dirty();
+    painter.paint_widget_tree(&screen);
+    CHECK(painter.frame_stats().filled_area == area(screen.screen_rect()));
+
+    panel.label.set("Changed");
+    painter.paint_widget_tree(&screen);
+    const auto& update = painter.frame_stats();
+    CHECK(update.damaged_area == area(panel.label.screen_rect()));
+    CHECK(update.filled_area == area(panel.label.screen_rect()));
+    CHECK(update.painted == 1);
+    CHECK(screen_contents() == reference_contents(screen));
+
+    // Nothing dirty, nothing painted.
+    const auto before = host_display::framebuffer().counters.pixel_writes;
+    painter.paint_widget_tree(&screen);
+    CHECK(host_display::framebuffer().counters.pixel_writes == before);
+}
+
+TEST_SUITE_END();
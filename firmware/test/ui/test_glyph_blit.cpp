@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "doctest.h"
+#include "host_display.hpp"
+#include "portapack.hpp"
+#include "ui_painter.hpp"
+#include "ui_font_fixed_5x8.hpp"
+#include "ui_font_fixed_8x16.hpp"
+
+#include <chrono>
+#include <string>
+
+using namespace ui;
+using portapack::display;
+
+namespace {
+
+constexpr Color background_fill{0x1234};
+
+host_display::Framebuffer& reset_framebuffer() {
+    auto& fb = host_display::framebuffer();
+    fb.reset();
+    display.fill_rectangle(display.screen_rect(), background_fill);
+    fb.counters.reset();
+    return fb;
+}
+
+bool bit(const Glyph& glyph, size_t i) {
+    return glyph.pixels()[i >> 3] & (1U << (i & 7));
+}
+
+size_t set_pixels(const Glyph& glyph) {
+    size_t count = 0;
+    for (int i = 0; i < glyph.w() * glyph.h(); i++)
+        count += bit(glyph, i);
+    return count;
+}
+
+/* Horizontal runs of set pixels. */
+size_t runs(const Glyph& glyph) {
+    size_t count = 0;
+    for (int y = 0; y < glyph.h(); y++) {
+        for (int x = 0; x < glyph.w(); x++) {
+            const size_t i = y * glyph.w() + x;
+            if (bit(glyph, i) && (x == 0 || !bit(glyph, i - 1)))
+                count++;
+        }
+    }
+    return count;
+}
+
+/* Checks every dot of the glyph drawn at 'p', one pixel per bit before. */
+void check_glyph(const host_display::Framebuffer& fb, Point p, const Glyph& glyph, Color fg, Color bg, int zoom = 1) {
+    const bool transparent = bg.v == Color::magenta().v;
+    for (int y = 0; y < glyph.h() * zoom; y++) {
+        for (int x = 0; x < glyph.w() * zoom; x++) {
+            const Point at{p.x() + x, p.y() + y};
+            if (!display.screen_rect().contains(at))
+                continue;
+            const bool set = bit(glyph, (y / zoom) * glyph.w() + x / zoom);
+            const auto expected = set ? fg : (transparent ? background_fill : bg);
+            CAPTURE(x);
+            CAPTURE(y);
+            REQUIRE(fb.memory(at).v == expected.v);
+        }
+    }
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Glyph blitter");
+
+TEST_CASE("Opaque glyphs are one window, every pixel written once.") {
+    for (const auto font : {&font::fixed_5x8, &font::fixed_8x16}) {
+        for (const char c : std::string{"Ag%.~"}) {
+            CAPTURE(c);
+            auto& fb = reset_framebuffer();
+            const auto glyph = font->glyph(c);
+            display.draw_glyph({20, 30}, glyph, Color::white(), Color::blue());
+            CHECK(fb.counters.window_sets == 2);
+            CHECK(fb.counters.pixel_writes == size_t(glyph.w() * glyph.h()));
+            check_glyph(fb, {20, 30}, glyph, Color::white(), Color::blue());
+        }
+    }
+}
+
+TEST_CASE("Transparent glyphs are one window per run of set pixels.") {
+    for (const auto font : {&font::fixed_5x8, &font::fixed_8x16}) {
+        for (const char c : std::string{"Ag%.~"}) {
+            CAPTURE(c);
+            auto& fb = reset_framebuffer();
+            const auto glyph = font->glyph(c);
+            display.draw_glyph({20, 30}, glyph, Color::white(), Color::magenta());
+            CHECK(fb.counters.window_sets == 2 * runs(glyph));
+            CHECK(fb.counters.pixel_writes == set_pixels(glyph));
+            check_glyph(fb, {20, 30}, glyph, Color::white(), Color::magenta());
+        }
+    }
+}
+
+TEST_CASE("Zoomed and clipped glyphs.") {
+    const auto glyph = font::fixed_8x16.glyph('W');
+    for (const auto bg : {Color::blue(), Color::magenta()}) {
+        auto& fb = reset_framebuffer();
+        display.draw_glyph({10, 10}, glyph, Color::white(), bg, 3);
+        check_glyph(fb, {10, 10}, glyph, Color::white(), bg, 3);
+
+        // Partly off the right and bottom edges.
+        display.draw_glyph({236, 312}, glyph, Color::yellow(), bg, 2);
+        check_glyph(fb, {236, 312}, glyph, Color::yellow(), bg, 2);
+        display.draw_glyph({234, 100}, glyph, Color::yellow(), bg);
+        check_glyph(fb, {234, 100}, glyph, Color::yellow(), bg);
+    }
+}
+
+TEST_CASE("Glyph colors follow the color pair and the dark cover.") {
+    const auto glyph = font::fixed_8x16.glyph('x');
+    auto& fb = reset_framebuffer();
+    const Color pairs[][2] = {{Color::white(), Color::black()}, {Color::black(), Color::white()}, {Color::green(), Color::red()}, {Color::white(), Color::black()}};
+    for (const auto& pair : pairs) {
+        display.draw_glyph({0, 0}, glyph, pair[0], pair[1]);
+        check_glyph(fb, {0, 0}, glyph, pair[0], pair[1]);
+    }
+
+    portapack::io.dark_cover_enabled = true;
+    portapack::io.brightness = 1;
+    display.draw_glyph({0, 0}, glyph, Color::white(), Color::black());
+    portapack::io.dark_cover_enabled = false;
+    portapack::io.brightness = 0;
+    check_glyph(fb, {0, 0}, glyph, Color{0x7bef}, Color::black());
+
+    display.draw_glyph({0, 0}, glyph, Color::white(), Color::black());
+    check_glyph(fb, {0, 0}, glyph, Color::white(), Color::black());
+}
+
+TEST_CASE("Benchmark") {
+    const std::string line{"The quick brown fox jumps ov"};
+    constexpr size_t lines = 20;
+
+    for (const auto background : {Color::black(), Color::magenta()}) {
+        const Style style{font::fixed_8x16, background, Color::white()};
+        auto& fb = reset_framebuffer();
+        Painter painter{};
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < lines; i++)
+            painter.draw_string({0, Coord(i * 16)}, style, line);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        const auto glyphs = lines * line.size();
+        MESSAGE(std::string{background.v == Color::magenta().v ? "Transparent" : "Opaque"}
+                << " text: " << fb.counters.window_sets / 2.0 / glyphs << " windows, "
+                << fb.counters.pixel_writes / glyphs << " pixels, "
+                << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / glyphs << " ns per glyph on the host");
+        // One window per set pixel before.
+        CHECK(fb.counters.window_sets / 2 < fb.counters.pixel_writes / 2);
+    }
+}
+
+TEST_SUITE_END();
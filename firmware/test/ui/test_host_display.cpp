@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "doctest.h"
+#include "host_display.hpp"
+#include "portapack.hpp"
+#include "ui_painter.hpp"
+#include "ui_font_fixed_8x16.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace ui;
+using portapack::display;
+
+namespace {
+
+host_display::Framebuffer& reset_framebuffer() {
+    auto& fb = host_display::framebuffer();
+    fb.reset();
+    return fb;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Host display");
+
+TEST_CASE("fill_rectangle sets one window and writes its area.") {
+    auto& fb = reset_framebuffer();
+    display.fill_rectangle({10, 20, 30, 4}, Color::red());
+
+    CHECK(fb.counters.window_sets == 2);
+    CHECK(fb.counters.pixel_writes == 30 * 4);
+    CHECK(fb.memory({10, 20}).v == Color::red().v);
+    CHECK(fb.memory({39, 23}).v == Color::red().v);
+    CHECK(fb.memory({40, 23}).v == Color::black().v);
+    CHECK(fb.memory({10, 24}).v == Color::black().v);
+}
+
+TEST_CASE("fill_rectangle is clipped to the screen.") {
+    auto& fb = reset_framebuffer();
+    display.fill_rectangle({230, 310, 20, 20}, Color::blue());
+    CHECK(fb.counters.pixel_writes == 10 * 10);
+    CHECK(fb.memory({239, 319}).v == Color::blue().v);
+}
+
+TEST_CASE("Rewriting the same color is counted as unchanged.") {
+    auto& fb = reset_framebuffer();
+    display.fill_rectangle({0, 0, 8, 8}, Color::green());
+    display.fill_rectangle({4, 4, 8, 8}, Color::green());
+    CHECK(fb.counters.pixel_writes == 128);
+    CHECK(fb.counters.unchanged_writes == 16);
+}
+
+TEST_CASE("read_pixels returns what draw_pixels wrote.") {
+    auto& fb = reset_framebuffer();
+    const std::array<Color, 6> colors{Color::red(), Color::green(), Color::blue(),
+                                      Color::white(), Color::yellow(), Color::magenta()};
+    display.draw_pixels({100, 100, 3, 2}, colors);
+
+    std::array<ColorRGB888, 6> read{};
+    display.read_pixels({100, 100, 3, 2}, read);
+    CHECK(fb.counters.pixel_reads == 6);
+    for (size_t i = 0; i < colors.size(); i++) {
+        CAPTURE(i);
+        CHECK(Color(read[i].r, read[i].g, read[i].b).v == colors[i].v);
+    }
+}
+
+TEST_CASE("One 8x16 character is one window of 128 pixels.") {
+    auto& fb = reset_framebuffer();
+    Painter painter{};
+    const Style style{ui::font::fixed_8x16, Color::black(), Color::white()};
+    painter.draw_string({0, 0}, style, "AB");
+
+    CHECK(fb.counters.window_sets == 2 * 2);
+    CHECK(fb.counters.pixel_writes == 2 * 8 * 16);
+}
+
+TEST_CASE("Vertical scrolling moves the shown lines, not the memory.") {
+    auto& fb = reset_framebuffer();
+    display.scroll_set_area(16, 320);
+    display.scroll_set_position(0);
+    display.fill_rectangle({0, 16, 240, 1}, Color::red());
+    display.fill_rectangle({0, 17, 240, 1}, Color::green());
+    CHECK(fb.pixel({0, 16}).v == Color::red().v);
+
+    display.scroll_set_position(1);
+    CHECK(fb.memory({0, 16}).v == Color::red().v);
+    CHECK(fb.pixel({0, 16}).v == Color::green().v);
+    CHECK(fb.pixel({0, 319}).v == Color::red().v);
+
+    display.scroll_disable();
+    CHECK(fb.pixel({0, 16}).v == Color::red().v);
+}
+
+TEST_CASE("write_png writes a 240x320 RGB image.") {
+    auto& fb = reset_framebuffer();
+    display.fill_rectangle({0, 0, 240, 160}, Color::cyan());
+
+    const std::string path = "host_display_test.png";
+    REQUIRE(fb.write_png(path));
+
+    std::ifstream f{path, std::ios::binary};
+    const std::vector<uint8_t> png{std::istreambuf_iterator<char>(f), {}};
+    std::remove(path.c_str());
+
+    REQUIRE(png.size() > 240 * 320 * 3);
+    const std::vector<uint8_t> signature_and_ihdr{
+        0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n',
+        0, 0, 0, 13, 'I', 'H', 'D', 'R',
+        0, 0, 0, 240, 0, 0, 1, 64, 8, 2};
+    CHECK(std::equal(signature_and_ihdr.begin(), signature_and_ihdr.end(), png.begin()));
+}
+
+TEST_SUITE_END();
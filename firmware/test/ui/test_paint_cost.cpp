@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 PortaPack Mayhem contributors
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "doctest.h"
+#include "host_event_loop.hpp"
+
+#include "bitmap.hpp"
+#include "ui_about_simple.hpp"
+#include "ui_btngrid.hpp"
+#include "ui_navigation.hpp"
+
+#include <cstdlib>
+#include <string>
+
+using namespace ui;
+using host_display::Counters;
+
+/* Reports the bus traffic of painting views from the apps, frame by
+ * frame, the way the M0 event loop drives them. Set UI_TEST_PNG_DIR to
+ * keep a screenshot of each. */
+namespace {
+
+constexpr size_t screen_pixels = 240 * 320;
+
+void report(const std::string& name, const Counters& c, size_t frames = 1) {
+    MESSAGE(name << ": " << c.pixel_writes / frames << " pixels ("
+                 << 100 * c.pixel_writes / frames / screen_pixels << "% of the screen, "
+                 << 100 * c.unchanged_writes / std::max<size_t>(c.pixel_writes, 1) << "% unchanged), "
+                 << c.window_sets / frames << " window sets per frame");
+}
+
+void screenshot(const std::string& name) {
+    if (const auto dir = std::getenv("UI_TEST_PNG_DIR"))
+        host_display::framebuffer().write_png(std::string{dir} + "/" + name + ".png");
+}
+
+Counters& operator+=(Counters& total, const Counters& c) {
+    total.commands += c.commands;
+    total.window_sets += c.window_sets;
+    total.pixel_writes += c.pixel_writes;
+    total.unchanged_writes += c.unchanged_writes;
+    total.pixel_reads += c.pixel_reads;
+    return total;
+}
+
+/* Main menu like grid of app buttons. */
+class Launcher : public BtnGridView {
+   public:
+    Launcher() {
+        on_populate();
+    }
+
+   private:
+    void on_populate() override {
+        const Bitmap* icons[] = {&bitmap_icon_adsb, &bitmap_icon_add};
+        for (size_t i = 0; i < 12; i++)
+            add_item({"App " + std::to_string(i), Color::green(), icons[i & 1], nullptr});
+    }
+};
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Paint cost");
+
+TEST_CASE("AboutView") {
+    host_display::framebuffer().reset();
+    host_event_loop::Screen screen{};
+    NavigationView nav{};
+    AboutView view{nav};
+    screen.show(view);
+
+    const auto first = host_event_loop::frame(screen);
+    report("About, first frame", first);
+    screenshot("about");
+    // Everything is drawn at least once.
+    CHECK(first.pixel_writes >= screen_pixels);
+
+    // The credits roll one line every 60 frames.
+    Counters rolling{};
+    constexpr size_t frames = 240;
+    for (size_t i = 0; i < frames; i++)
+        rolling += host_event_loop::frame(screen);
+    report("About, rolling", rolling, frames);
+    CHECK(rolling.pixel_writes > 0);
+    CHECK(rolling.pixel_writes < frames * screen_pixels / 10);
+}
+
+TEST_CASE("Button grid") {
+    host_display::framebuffer().reset();
+    host_event_loop::Screen screen{};
+    Launcher view{};
+    screen.show(view);
+
+    const auto first = host_event_loop::frame(screen);
+    report("Grid, first frame", first);
+    screenshot("grid");
+    CHECK(first.pixel_writes >= screen_pixels);
+
+    // Idle frames paint nothing.
+    CHECK(host_event_loop::frame(screen).pixel_writes == 0);
+
+    view.on_encoder(1);
+    const auto move = host_event_loop::frame(screen);
+    report("Grid, highlight move", move);
+    CHECK(move.pixel_writes > 0);
+    CHECK(move.pixel_writes < first.pixel_writes);
+}
+
+TEST_SUITE_END();
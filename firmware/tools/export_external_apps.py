@@ -26,6 +26,7 @@ import os
 import sys
 import struct
 import subprocess
+import image_blocks
 from external_app_info import maximum_application_size
 from external_app_info import external_apps_address_start
 from external_app_info import external_apps_address_end
@@ -35,10 +36,10 @@ PortaPack external app image creator
 This script is used in the build process and should never be run manually.
 See firmware/application/CMakeLists.txt > COMMAND ${EXPORT_EXTERNAL_APP_IMAGES}
 
-Usage: <command> <project source dir> <binary dir> <cmake objcopy path> <list of external image prefixes>
+Usage: <command> <project source dir> <binary dir> <cmake objcopy path> <lz4 path> <list of external image prefixes>
 """
 
-if len(sys.argv) < 4:
+if len(sys.argv) < 5:
 	print(usage_message)
 	sys.exit(-1)
 
@@ -88,13 +89,14 @@ def patch_image(path, image_data, search_address, replace_address):
 project_source_dir = sys.argv[1]   #/portapack-mayhem/firmware/application
 binary_dir = sys.argv[2]           #/portapack-mayhem/build/firmware/application
 cmake_objcopy = sys.argv[3]
+lz4 = sys.argv[4]
 
 memory_location_header_position = 0
 externalAppEntry_header_position = 4
 m4_app_tag_header_position = 76
 m4_app_offset_header_position = 80
 
-for external_image_prefix in sys.argv[4:]:
+for external_image_prefix in sys.argv[5:]:
 
 	# COMMAND ${CMAKE_OBJCOPY} -v -O binary ${PROJECT_NAME}.elf ${PROJECT_NAME}_ext_pacman.bin --only-section=.external_app_pacman
 	himg = "{}/external_app_{}.himg".format(binary_dir, external_image_prefix)
@@ -129,8 +131,6 @@ for external_image_prefix in sys.argv[4:]:
 	print(chunk_tag)
 	print("{}/../baseband/{}.bin".format(binary_dir, chunk_tag))
 	m4_image = read_image("{}/../baseband/{}.bin".format(binary_dir, chunk_tag))
-	app_image_len = len(external_application_image)
-	external_application_image += m4_image
 
 	if (len(m4_image) % 4) != 0:
 		print("m4 file size not divideable by 4")
@@ -139,14 +139,18 @@ for external_image_prefix in sys.argv[4:]:
 	replace_address = 0x10080000 + len(m4_image)
 	search_address = int.from_bytes(external_application_image[externalAppEntry_header_position:externalAppEntry_header_position+4], byteorder='little') & 0xFFFF0000
 	external_application_image = patch_image(himg, external_application_image, search_address, replace_address)
+	app_image_len = len(external_application_image)
 
 	external_application_image[memory_location_header_position:memory_location_header_position+4] = replace_address.to_bytes(4, byteorder='little')
 	external_application_image[m4_app_offset_header_position:m4_app_offset_header_position+4] = app_image_len.to_bytes(4, byteorder='little')
 
-	if (len(external_application_image) > maximum_application_size) != 0:
-		print("application {} can not exceed 32kb: {} bytes used".format(external_image_prefix, len(external_application_image)))
+	# Both share the M4 code RAM once loaded.
+	if (len(external_application_image) + len(m4_image) > maximum_application_size) != 0:
+		print("application {} can not exceed 32kb: {} bytes used".format(external_image_prefix, len(external_application_image) + len(m4_image)))
 		sys.exit(-1)
 
+	external_application_image += image_blocks.pack(m4_image, lz4, image_blocks.external_app_block_size)
+
 	checksum = 0
 	for i in range(0, len(external_application_image), 4):
 		checksum += external_application_image[i] + (external_application_image[i + 1] << 8) + (external_application_image[i + 2] << 16) + (external_application_image[i + 3] << 24)
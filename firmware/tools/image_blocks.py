@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2026 PortaPack Mayhem contributors
+#
+# This file is part of PortaPack.
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+# Packs baseband images into the stream of independently LZ4 compressed
+# blocks that firmware/application/image_blocks.hpp unpacks.
+
+import struct
+import subprocess
+import zlib
+
+stored_flag = 0x80000000
+
+# SPI flash is memory mapped, so bigger blocks only cost the compression
+# ratio. External apps read theirs from the SD card into a buffer per block.
+spi_flash_block_size = 8192
+external_app_block_size = 2048
+
+def compress_block(lz4, data):
+	frame = subprocess.run([lz4, '-9', '-c', '-q', '--no-frame-crc', '-'], input=bytes(data), stdout=subprocess.PIPE, check=True).stdout
+
+	# Frame header: magic, FLG, BD, optional content size and dictionary
+	# ID, header checksum.
+	flags = frame[4]
+	offset = 7 + (8 if flags & 8 else 0) + (4 if flags & 1 else 0)
+	block_size = struct.unpack_from('<I', frame, offset)[0]
+	if block_size & stored_flag:
+		return None
+	block = frame[offset + 4:offset + 4 + block_size]
+	if struct.unpack_from('<I', frame, offset + 4 + block_size)[0] != 0:
+		raise ValueError('lz4 split a {} byte image block'.format(len(data)))
+	return block
+
+def pack(data, lz4, block_size):
+	data = bytes(data)
+	stream = bytearray(struct.pack('<3I', len(data), block_size, zlib.crc32(data) & 0xffffffff))
+	for offset in range(0, len(data), block_size):
+		raw = data[offset:offset + block_size]
+		block = compress_block(lz4, raw)
+		if block is None or len(block) >= len(raw):
+			stream += struct.pack('<I', len(raw) | stored_flag) + raw
+		else:
+			# unlz4_len() reads 2 bytes past the block as a match offset.
+			stream += struct.pack('<I', len(block)) + block + b'\0\0'
+		while len(stream) & 3:
+			stream.append(0)
+	return stream
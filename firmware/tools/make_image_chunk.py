@@ -23,11 +23,13 @@
 
 import sys
 import struct
+import image_blocks
 
 usage_message = """
 PortaPack image chunk writer
 
-Usage: <command> <input_binary> <four-characer tag> <output_tagged_binary>
+Usage: <command> <input_binary> <four-characer tag> <output_tagged_binary> <lz4 path>
+       <command> <output_terminator_binary>
 """
 
 def read_image(path):
@@ -41,24 +43,15 @@ def write_image(data, path):
 	f.write(data)
 	f.close()
 
-if len(sys.argv) == 4:
+if len(sys.argv) == 5:
 	input_image = read_image(sys.argv[1])
-	input_image = bytearray(input_image)
 	tag = tuple(map(ord, sys.argv[2]))
 	output_path = sys.argv[3]
-
-	if input_image[4] & 8 == 8:
-		input_image = input_image[15:]
-	else:
-		input_image = input_image[7:]
-
-	if (len(input_image) & 3) != 0:
-		for i in range(4 - (len(input_image) & 3)):
-			input_image.append(0)
+	stream = image_blocks.pack(input_image, sys.argv[4], image_blocks.spi_flash_block_size)
 
 	output_image = bytearray()
-	output_image += struct.pack('<4BI', tag[0], tag[1], tag[2], tag[3], len(input_image) - 4)
-	output_image += input_image
+	output_image += struct.pack('<4BI', tag[0], tag[1], tag[2], tag[3], len(stream))
+	output_image += stream
 	write_image(output_image, output_path)
 
 elif len(sys.argv) == 2:
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2026 PortaPack Mayhem contributors
+#
+# This file is part of PortaPack.
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+# Converts packet logs (*.PKT, see firmware/application/packet_log.hpp)
+# to CSV or JSON.
+#
+#   packet_log_export.py ADSB.PKT > adsb.csv
+#   packet_log_export.py --json ADSB.PKT > adsb.json
+#
+# ADS-B RX writes LOGS/ADSB.PKT instead of ADSB.TXT with log_packed=1 in
+# SETTINGS/rx_adsb.ini.
+
+import argparse
+import csv
+import datetime
+import json
+import struct
+import sys
+
+MAGIC = b"PPLOG"
+HEADER_SIZE = 6
+EPOCH = datetime.datetime(2000, 1, 1)
+
+# Must match packet_log::Type and the field ids in packet_log.hpp.
+TYPES = {
+    1: "ADSB",
+}
+
+FIELDS = {
+    "ADSB": {
+        1: "icao",
+        2: "callsign",
+        3: "squawk",
+        4: "altitude",
+        5: "latitude",
+        6: "longitude",
+        7: "velocity_type",
+        8: "heading",
+        9: "speed_type",
+        10: "speed",
+        11: "vertical_rate",
+        12: "sil",
+    },
+}
+
+def degrees(value):
+    """Int fields are in 1e-7 degrees."""
+    return value / 1e7 if isinstance(value, int) else value
+
+
+FORMATS = {
+    "icao": lambda value: "%06X" % value,
+    "latitude": degrees,
+    "longitude": degrees,
+}
+
+
+def record_size(data, at):
+    """Size of a good record at 'at', or 0."""
+    if len(data) - at < HEADER_SIZE + 1:
+        return 0
+    size = HEADER_SIZE + data[at + 1] + 1
+    if len(data) - at < size or sum(data[at:at + size]) & 0xff != 0xff:
+        return 0
+
+    payload = data[at + HEADER_SIZE:at + size - 1]
+    if data[at] == 0:
+        return size if payload[:len(MAGIC)] == MAGIC and len(payload) > len(MAGIC) else 0
+    if not payload or payload[0] + 1 > len(payload):
+        return 0
+    return size if parse_fields(payload[1 + payload[0]:]) is not None else 0
+
+
+def parse_fields(data):
+    """List of (id, value), or None if damaged."""
+    fields = []
+    at = 0
+    while at < len(data):
+        tag = data[at]
+        kind, field_id = tag >> 6, tag & 0x3f
+        at += 1
+        if kind == 0:
+            value, shift = 0, 0
+            while True:
+                if at >= len(data) or shift > 28:
+                    return None
+                byte = data[at]
+                at += 1
+                value |= (byte & 0x7f) << shift
+                shift += 7
+                if not byte & 0x80:
+                    break
+            fields.append((field_id, (value >> 1) ^ -(value & 1)))
+        elif kind == 1:
+            if at >= len(data) or at + 1 + data[at] > len(data):
+                return None
+            length = data[at]
+            fields.append((field_id, data[at + 1:at + 1 + length].decode("latin-1")))
+            at += 1 + length
+        elif kind == 2:
+            if at + 4 > len(data):
+                return None
+            # As many digits as a float has.
+            fields.append((field_id, float("%.7g" % struct.unpack_from("<f", data, at)[0])))
+            at += 4
+        else:
+            return None
+    return fields
+
+
+def records(data, stats):
+    """Good data records, skipping damaged data up to the next Sync record."""
+    at = 0
+    while at < len(data):
+        size = record_size(data, at)
+        if size == 0:
+            start = at
+            at = data.find(MAGIC, at + 1 + HEADER_SIZE)
+            while at != -1 and not (data[at - HEADER_SIZE] == 0 and record_size(data, at - HEADER_SIZE)):
+                at = data.find(MAGIC, at + 1)
+            at = len(data) if at == -1 else at - HEADER_SIZE
+            stats["skipped"] += at - start
+            continue
+
+        record_type = data[at]
+        seconds = struct.unpack_from("<I", data, at + 2)[0]
+        payload = data[at + HEADER_SIZE:at + size - 1]
+        at += size
+        if record_type == 0:
+            stats["syncs"] += 1
+            continue
+
+        type_name = TYPES.get(record_type, "TYPE%d" % record_type)
+        names = FIELDS.get(type_name, {})
+        row = {
+            "time": (EPOCH + datetime.timedelta(seconds=seconds)).isoformat(),
+            "type": type_name,
+            "raw": payload[1:1 + payload[0]].hex().upper(),
+        }
+        for field_id, value in parse_fields(payload[1 + payload[0]:]):
+            name = names.get(field_id, "field%d" % field_id)
+            row[name] = FORMATS[name](value) if name in FORMATS else value
+        yield row
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert PortaPack packet logs to CSV or JSON.")
+    parser.add_argument("files", nargs="+", help="packet log files (.PKT)")
+    parser.add_argument("--json", action="store_true", help="JSON lines instead of CSV")
+    args = parser.parse_args()
+
+    rows = []
+    for name in args.files:
+        with open(name, "rb") as f:
+            data = f.read()
+        stats = {"skipped": 0, "syncs": 0}
+        file_rows = list(records(data, stats))
+        rows += file_rows
+        print("%s: %d records, %d damaged bytes skipped" % (name, len(file_rows), stats["skipped"]), file=sys.stderr)
+
+    if args.json:
+        for row in rows:
+            print(json.dumps(row))
+        return
+
+    columns = ["time", "type", "raw"]
+    for row in rows:
+        columns += [c for c in row if c not in columns]
+    writer = csv.DictWriter(sys.stdout, fieldnames=columns, lineterminator="\n")
+    writer.writeheader()
+    writer.writerows(rows)
+
+
+if __name__ == "__main__":
+    main()